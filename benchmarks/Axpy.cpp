@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "Benchmark.hpp"
+using namespace El;
+
+// Y := alpha X + Y, which is local when X and Y are distributed alike and
+// otherwise redistributes X
+namespace {
+
+template<typename T>
+void Benchmark
+( bench::Reporter& reporter, const bench::Options& opts,
+  const Grid& g, const string& gridName, const string& typeName,
+  const vector<Int>& ms, const vector<Int>& ns,
+  const vector<bench::DistPair>& xDists, const vector<bench::DistPair>& yDists )
+{
+    const T alpha = TypeTraits<T>::One();
+    for( const Int m : ms )
+    for( const Int n : ns )
+    for( const auto& xDist : xDists )
+    {
+        auto X = bench::MakeDistMatrix<T>( g, xDist );
+        Uniform( *X, m, n );
+        for( const auto& yDist : yDists )
+        {
+            auto Y = bench::MakeDistMatrix<T>( g, yDist );
+            Zeros( *Y, m, n );
+            auto result = bench::Measure( g, opts, [&]()
+              { Axpy( alpha, *X, *Y ); } );
+            result.params =
+              { {"type",typeName}, {"grid",gridName}, {"m",m}, {"n",n},
+                {"x",bench::DistPairToString(xDist)},
+                {"y",bench::DistPairToString(yDist)} };
+            result.flops = bench::FlopsPerFMA<T>()*double(m)*n;
+            // X and Y are read and Y is written
+            result.bytes = 3*double(m*n)*sizeof(T);
+            reporter.Add( result );
+        }
+    }
+}
+
+} // namespace <anon>
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const auto opts = bench::CommonInput();
+        const auto ms = bench::ParseList<Int>
+          (Input("--m","matrix heights",string("4000")));
+        const auto ns = bench::ParseList<Int>
+          (Input("--n","matrix widths",string("4000")));
+        const auto xDists = bench::ParseDistPairs
+          (Input("--x","distributions of X (e.g., MC/MR) or all",
+                 string("MC/MR,STAR/STAR")));
+        const auto yDists = bench::ParseDistPairs
+          (Input("--y","distributions of Y (e.g., MC/MR) or all",
+                 string("MC/MR")));
+        ProcessInput();
+
+        bench::Reporter reporter( "Axpy", opts );
+        bench::ForEachGrid( opts, [&]( const Grid& g, const string& gridName )
+        {
+            bench::ForEachType( opts.types,
+              [&]( auto tag, const string& typeName )
+              {
+                  Benchmark<typename decltype(tag)::type>
+                  ( reporter, opts, g, gridName, typeName,
+                    ms, ns, xDists, yDists );
+              } );
+        } );
+        reporter.Finish();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
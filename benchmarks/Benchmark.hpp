@@ -0,0 +1,431 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARKS_BENCHMARK_HPP
+#define EL_BENCHMARKS_BENCHMARK_HPP
+
+#include <El.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// The driver shared by the benchmarks. Each benchmark is an MPI program
+// which sweeps over the Cartesian product of comma-separated parameter
+// lists, e.g.,
+//
+//   mpirun -np 4 ./GemmBenchmark --m 1000,2000 --types float,double
+//     --gridHeights 1,2 --format json --output gemm.json
+//
+// Each configuration is run '--warmups' times untimed and then '--reps'
+// times, with each repetition starting from a barrier. The time of a
+// repetition is the maximum over the processes; the minimum, median, and
+// maximum of these times are reported along with the smallest and largest
+// median time of a single process. The rates are those of the median time,
+// and the bytes communicated (summed over the processes) are counted with
+// mpi::CollectCommStats over one further run.
+
+namespace El {
+namespace bench {
+
+inline vector<string> SplitList( const string& list )
+{
+    vector<string> items;
+    std::istringstream is( list );
+    string item;
+    while( std::getline( is, item, ',' ) )
+        if( !item.empty() )
+            items.push_back( item );
+    return items;
+}
+
+template<typename T>
+vector<T> ParseList( const string& list )
+{
+    vector<T> values;
+    for( const auto& item : SplitList(list) )
+    {
+        std::istringstream is( item );
+        T value;
+        if( !(is >> value) )
+            LogicError("Could not parse \"",item,"\"");
+        values.push_back( value );
+    }
+    return values;
+}
+
+// Options
+// =======
+
+struct Options
+{
+    Int reps, warmups;
+    string format, output;
+    vector<string> types;
+    vector<int> gridHeights;
+    bool colMajor;
+};
+
+// Read the options shared by the benchmarks (before ProcessInput)
+inline Options CommonInput( const string& defaultTypes="float,double" )
+{
+    Options opts;
+    opts.reps = Input("--reps","timed repetitions",Int(10));
+    opts.warmups = Input("--warmups","untimed repetitions",Int(1));
+    opts.format = Input("--format","output format: csv/json",string("csv"));
+    opts.output =
+      Input("--output","output file (stdout if empty)",string(""));
+    opts.types = SplitList
+      (Input("--types","float,double,complex-float,complex-double",
+             defaultTypes));
+    opts.gridHeights = ParseList<int>
+      (Input("--gridHeights","process grid heights (0 for squarest)",
+             string("0")));
+    opts.colMajor = Input("--colMajor","column-major ordering?",true);
+    return opts;
+}
+
+// Distribution pairs are written as, e.g., "MC/MR" or "STAR/VR"; "all" lists
+// every elemental distribution
+struct DistPair
+{
+    Dist colDist, rowDist;
+};
+
+// Unlike DistToString, spells out STAR and CIRC
+inline string DistName( Dist dist )
+{
+    if( dist == STAR )
+        return "STAR";
+    if( dist == CIRC )
+        return "CIRC";
+    return DistToString( dist );
+}
+
+inline Dist NameToDist( const string& name )
+{
+    if( name == "STAR" )
+        return STAR;
+    if( name == "CIRC" )
+        return CIRC;
+    return StringToDist( name );
+}
+
+inline string DistPairToString( const DistPair& dists )
+{ return DistName(dists.colDist)+"/"+DistName(dists.rowDist); }
+
+inline vector<DistPair> ParseDistPairs( const string& list )
+{
+    if( list == "all" )
+        return
+        { {CIRC,CIRC}, {MC,MR}, {MC,STAR}, {MD,STAR}, {MR,MC}, {MR,STAR},
+          {STAR,MC}, {STAR,MD}, {STAR,MR}, {STAR,STAR}, {STAR,VC},
+          {STAR,VR}, {VC,STAR}, {VR,STAR} };
+    vector<DistPair> pairs;
+    for( const auto& item : SplitList(list) )
+    {
+        const auto slash = item.find('/');
+        if( slash == string::npos )
+            LogicError("Expected a distribution pair such as MC/MR: ",item);
+        pairs.push_back
+        ( DistPair{ NameToDist(item.substr(0,slash)),
+                    NameToDist(item.substr(slash+1)) } );
+    }
+    return pairs;
+}
+
+template<typename T>
+unique_ptr<ElementalMatrix<T>>
+MakeDistMatrix( const Grid& g, const DistPair& dists )
+{
+    const Dist colDist = dists.colDist, rowDist = dists.rowDist;
+#define GUARD(CDIST,RDIST,WRAP) \
+    colDist == CDIST && rowDist == RDIST && WRAP == ELEMENT
+#define PAYLOAD(CDIST,RDIST,WRAP) \
+    return unique_ptr<ElementalMatrix<T>>(new DistMatrix<T,CDIST,RDIST>(g));
+#include <El/macros/GuardAndPayload.h>
+#undef GUARD
+#undef PAYLOAD
+    LogicError("Invalid distribution ",DistPairToString(dists));
+    return nullptr;
+}
+
+// Sweeps
+// ======
+
+template<typename T>
+struct TypeTag { typedef T type; };
+
+// Call f(TypeTag<T>(),name) for each of the named datatypes
+template<typename Function>
+void ForEachType( const vector<string>& types, Function f )
+{
+    for( const auto& type : types )
+    {
+        if( type == "float" )
+            f( TypeTag<float>(), type );
+        else if( type == "double" )
+            f( TypeTag<double>(), type );
+        else if( type == "complex-float" )
+            f( TypeTag<Complex<float>>(), type );
+        else if( type == "complex-double" )
+            f( TypeTag<Complex<double>>(), type );
+        else
+            LogicError("Unknown datatype ",type);
+    }
+}
+
+// Call f(grid,name) for each of the requested grid heights which divide
+// the number of processes
+template<typename Function>
+void ForEachGrid( const Options& opts, Function f )
+{
+    for( int height : opts.gridHeights )
+    {
+        mpi::Comm comm = mpi::NewWorldComm();
+        const int commSize = mpi::Size( comm );
+        if( height == 0 )
+            height = Grid::DefaultHeight( commSize );
+        if( height < 1 || commSize % height != 0 )
+        {
+            if( mpi::Rank(comm) == 0 )
+                std::cerr << "Skipping grid height " << height << " with "
+                          << commSize << " processes" << std::endl;
+            continue;
+        }
+        const GridOrder order = opts.colMajor ? COLUMN_MAJOR : ROW_MAJOR;
+        const Grid g( std::move(comm), height, order );
+        f( g, std::to_string(g.Height())+"x"+std::to_string(g.Width()) );
+    }
+}
+
+// Measurement
+// ===========
+
+struct Param
+{
+    string name, value;
+    bool numeric;
+
+    Param( string name_, string value_ )
+    : name(std::move(name_)), value(std::move(value_)), numeric(false) { }
+    Param( string name_, Int value_ )
+    : name(std::move(name_)), value(std::to_string(value_)), numeric(true)
+    { }
+};
+
+struct Result
+{
+    vector<Param> params;
+    // The floating-point operations and the bytes of the operands of one
+    // repetition
+    double flops=0, bytes=0;
+    double commBytes=0;
+    // The time of each repetition (the maximum over the processes)
+    vector<double> seconds;
+    // The extreme median times of single processes
+    double minRankSeconds=0, maxRankSeconds=0;
+};
+
+inline double Median( vector<double> values )
+{
+    if( values.empty() )
+        return 0;
+    std::sort( values.begin(), values.end() );
+    const size_t half = values.size()/2;
+    return values.size() % 2 ? values[half] :
+                               (values[half-1]+values[half])/2;
+}
+
+inline double TotalBytesSent()
+{
+    double bytes = 0;
+    for( const auto& stats : mpi::GetCommStats() )
+        bytes += stats.bytesSent;
+    return bytes;
+}
+
+template<typename Operation>
+Result Measure( const Grid& g, const Options& opts, Operation op )
+{
+    mpi::Comm const& comm = g.ViewingComm();
+    SyncInfo<Device::CPU> syncInfo;
+    for( Int rep=0; rep<opts.warmups; ++rep )
+        op();
+
+    Result result;
+    result.seconds.resize( opts.reps );
+    Timer timer;
+    for( Int rep=0; rep<opts.reps; ++rep )
+    {
+        mpi::Barrier( comm );
+        timer.Start();
+        op();
+        result.seconds[rep] = timer.Stop();
+    }
+    const double rankSeconds = Median( result.seconds );
+    result.minRankSeconds =
+      mpi::AllReduce( rankSeconds, mpi::MIN, comm, syncInfo );
+    result.maxRankSeconds =
+      mpi::AllReduce( rankSeconds, mpi::MAX, comm, syncInfo );
+    if( opts.reps > 0 )
+        mpi::AllReduce
+        ( result.seconds.data(), opts.reps, mpi::MAX, comm, syncInfo );
+
+    const bool collecting = mpi::CollectCommStats();
+    mpi::SetCollectCommStats( true );
+    const double bytesBefore = TotalBytesSent();
+    op();
+    const double bytesSent = TotalBytesSent() - bytesBefore;
+    mpi::SetCollectCommStats( collecting );
+    result.commBytes = mpi::AllReduce( bytesSent, comm, syncInfo );
+    return result;
+}
+
+// Output
+// ======
+
+// Collects the results of a benchmark and writes them from the root of
+// mpi::COMM_WORLD: CSV rows as they arrive, or a JSON document at Finish
+class Reporter
+{
+public:
+    Reporter( const string& benchmark, const Options& opts )
+    : benchmark_(benchmark), json_(opts.format == "json"),
+      root_(mpi::Rank(mpi::COMM_WORLD) == 0)
+    {
+        if( opts.format != "csv" && opts.format != "json" )
+            LogicError("Unknown output format ",opts.format);
+        if( root_ && !opts.output.empty() )
+        {
+            file_.open( opts.output.c_str() );
+            if( !file_.is_open() )
+                RuntimeError("Could not open ",opts.output);
+        }
+    }
+
+    void Add( const Result& result )
+    {
+        if( !root_ )
+            return;
+        if( json_ )
+            results_.push_back( result );
+        else
+            WriteCSV( result );
+    }
+
+    void Finish()
+    {
+        if( root_ && json_ )
+            WriteJSON();
+        Stream().flush();
+    }
+
+private:
+    std::ostream& Stream()
+    { return file_.is_open() ? file_ : std::cout; }
+
+    void WriteCSV( const Result& result )
+    {
+        std::ostream& os = Stream();
+        if( !wroteHeader_ )
+        {
+            os << "benchmark";
+            for( const auto& param : result.params )
+                os << ',' << param.name;
+            os << ",processes,reps,flops,bytes,comm_bytes,time_min,"
+                  "time_median,time_max,rank_time_min,rank_time_max,"
+                  "gflops,gbytes_per_s\n";
+            wroteHeader_ = true;
+        }
+        os << benchmark_;
+        for( const auto& param : result.params )
+            os << ',' << param.value;
+        const Stats stats( result );
+        os << std::setprecision(6) << ',' << mpi::Size(mpi::COMM_WORLD)
+           << ',' << result.seconds.size() << ',' << result.flops << ','
+           << result.bytes << ',' << result.commBytes << ',' << stats.min
+           << ',' << stats.median << ',' << stats.max << ','
+           << result.minRankSeconds << ',' << result.maxRankSeconds << ','
+           << stats.gflops << ',' << stats.gbytes << '\n';
+        os.flush();
+    }
+
+    void WriteJSON()
+    {
+        std::ostream& os = Stream();
+        os << std::setprecision(6)
+           << "{\n  \"benchmark\": \"" << benchmark_ << "\",\n"
+           << "  \"processes\": " << mpi::Size(mpi::COMM_WORLD) << ",\n"
+           << "  \"results\": [";
+        for( size_t i=0; i<results_.size(); ++i )
+        {
+            const Result& result = results_[i];
+            const Stats stats( result );
+            os << (i == 0 ? "\n" : ",\n") << "    {";
+            for( const auto& param : result.params )
+            {
+                os << '"' << param.name << "\": ";
+                if( param.numeric )
+                    os << param.value << ", ";
+                else
+                    os << '"' << param.value << "\", ";
+            }
+            os << "\"reps\": " << result.seconds.size()
+               << ", \"flops\": " << result.flops
+               << ", \"bytes\": " << result.bytes
+               << ", \"comm_bytes\": " << result.commBytes
+               << ", \"time\": {\"min\": " << stats.min
+               << ", \"median\": " << stats.median
+               << ", \"max\": " << stats.max << "}"
+               << ", \"rank_time\": {\"min\": " << result.minRankSeconds
+               << ", \"max\": " << result.maxRankSeconds << "}"
+               << ", \"gflops\": " << stats.gflops
+               << ", \"gbytes_per_s\": " << stats.gbytes << "}";
+        }
+        os << "\n  ]\n}\n";
+    }
+
+    struct Stats
+    {
+        double min=0, median=0, max=0, gflops=0, gbytes=0;
+
+        explicit Stats( const Result& result )
+        {
+            if( result.seconds.empty() )
+                return;
+            min = *std::min_element
+              ( result.seconds.begin(), result.seconds.end() );
+            max = *std::max_element
+              ( result.seconds.begin(), result.seconds.end() );
+            median = Median( result.seconds );
+            if( median > 0 )
+            {
+                gflops = result.flops/(1.e9*median);
+                gbytes = result.bytes/(1.e9*median);
+            }
+        }
+    };
+
+    string benchmark_;
+    bool json_, root_;
+    bool wroteHeader_=false;
+    std::ofstream file_;
+    vector<Result> results_;
+};
+
+// The floating-point operations of a multiply-add of type T
+template<typename T>
+double FlopsPerFMA() { return IsComplex<T>::value ? 8 : 2; }
+
+} // namespace bench
+} // namespace El
+
+#endif // ifndef EL_BENCHMARKS_BENCHMARK_HPP
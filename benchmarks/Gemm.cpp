@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "Benchmark.hpp"
+using namespace El;
+
+namespace {
+
+GemmAlgorithm StringToGemmAlgorithm( const string& alg )
+{
+    if( alg == "default" ) return GEMM_DEFAULT;
+    if( alg == "summa-a" ) return GEMM_SUMMA_A;
+    if( alg == "summa-b" ) return GEMM_SUMMA_B;
+    if( alg == "summa-c" ) return GEMM_SUMMA_C;
+    if( alg == "summa-c-pipelined" ) return GEMM_SUMMA_C_PIPELINED;
+    if( alg == "summa-dot" ) return GEMM_SUMMA_DOT;
+    if( alg == "cannon" ) return GEMM_CANNON;
+    if( alg == "auto" ) return GEMM_AUTO;
+    LogicError("Unknown Gemm algorithm ",alg);
+    return GEMM_DEFAULT;
+}
+
+// Why an algorithm cannot run on the given problem and grid, or an empty
+// string if it can
+string Unsupported
+( const string& alg, Orientation orientA, Orientation orientB, Int k,
+  Int numLayers, const Grid& g )
+{
+    if( alg == "cannon" )
+    {
+        if( orientA != NORMAL || orientB != NORMAL )
+            return "Cannon's algorithm is only implemented for NN";
+        if( g.Height() != g.Width() )
+            return "Cannon's algorithm requires a square grid";
+        if( k % g.Height() != 0 )
+            return "Cannon's algorithm requires k to be a multiple of the "
+                   "grid height";
+    }
+    if( alg == "2.5d" && (numLayers < 1 || g.Size() % numLayers != 0) )
+        return "the number of layers must divide the grid size";
+    return "";
+}
+
+template<typename T>
+void Benchmark
+( bench::Reporter& reporter, const bench::Options& opts,
+  const Grid& g, const string& gridName, const string& typeName,
+  const vector<Int>& ms, const vector<Int>& ns, const vector<Int>& ks,
+  const vector<string>& orients, const vector<string>& algs,
+  const vector<Int>& nbs, const vector<Int>& layers )
+{
+    const T alpha = TypeTraits<T>::One(), beta = TypeTraits<T>::Zero();
+    for( const Int m : ms )
+    for( const Int n : ns )
+    for( const Int k : ks )
+    for( const auto& orient : orients )
+    {
+        if( orient.size() != 2 )
+            LogicError("Expected a pair of orientations such as NT: ",orient);
+        const Orientation orientA = CharToOrientation(orient[0]);
+        const Orientation orientB = CharToOrientation(orient[1]);
+        DistMatrix<T> A(g), B(g), C(g);
+        if( orientA == NORMAL )
+            Uniform( A, m, k );
+        else
+            Uniform( A, k, m );
+        if( orientB == NORMAL )
+            Uniform( B, k, n );
+        else
+            Uniform( B, n, k );
+        Zeros( C, m, n );
+
+        for( const auto& alg : algs )
+        {
+            // The 2.5D algorithm is swept over the numbers of layers
+            const bool replicated = ( alg == "2.5d" );
+            const GemmAlgorithm algorithm =
+              replicated ? GEMM_DEFAULT : StringToGemmAlgorithm( alg );
+            for( const Int numLayers : replicated ? layers : vector<Int>{1} )
+            {
+                const string reason =
+                  Unsupported( alg, orientA, orientB, k, numLayers, g );
+                if( !reason.empty() )
+                {
+                    if( g.Rank() == 0 )
+                        std::cerr << "Skipping " << alg << " with "
+                                  << numLayers << " layers for " << orient
+                                  << " on a " << gridName << " grid: "
+                                  << reason << std::endl;
+                    continue;
+                }
+                for( const Int nb : nbs )
+                {
+                    SetBlocksize( nb );
+                    auto result = bench::Measure( g, opts, [&]()
+                      {
+                          if( replicated )
+                              Gemm25D
+                              ( orientA, orientB, alpha, A, B, beta, C,
+                                numLayers );
+                          else
+                              Gemm
+                              ( orientA, orientB, alpha, A, B, beta, C,
+                                algorithm );
+                      } );
+                    result.params =
+                      { {"type",typeName}, {"grid",gridName}, {"m",m},
+                        {"n",n}, {"k",k}, {"orient",orient},
+                        {"algorithm",alg}, {"layers",numLayers},
+                        {"nb",nb} };
+                    result.flops = bench::FlopsPerFMA<T>()*double(m)*n*k;
+                    result.bytes = double(m*k+k*n+m*n)*sizeof(T);
+                    reporter.Add( result );
+                }
+            }
+        }
+    }
+}
+
+} // namespace <anon>
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const auto opts = bench::CommonInput();
+        const auto ms = bench::ParseList<Int>
+          (Input("--m","heights of C",string("1000")));
+        const auto ns = bench::ParseList<Int>
+          (Input("--n","widths of C",string("1000")));
+        const auto ks = bench::ParseList<Int>
+          (Input("--k","inner dimensions",string("1000")));
+        const auto orients = bench::SplitList
+          (Input("--orients","orientations of A and B (e.g., NN,TN)",
+                 string("NN")));
+        const auto algs = bench::SplitList
+          (Input("--algs",
+                 "default,auto,summa-a,summa-b,summa-c,summa-c-pipelined,"
+                 "summa-dot,cannon,2.5d",string("default")));
+        const auto nbs = bench::ParseList<Int>
+          (Input("--nb","algorithmic blocksizes",string("128")));
+        const auto layers = bench::ParseList<Int>
+          (Input("--layers","numbers of layers for 2.5d",string("2")));
+        ProcessInput();
+
+        bench::Reporter reporter( "Gemm", opts );
+        bench::ForEachGrid( opts, [&]( const Grid& g, const string& gridName )
+        {
+            bench::ForEachType( opts.types,
+              [&]( auto tag, const string& typeName )
+              {
+                  Benchmark<typename decltype(tag)::type>
+                  ( reporter, opts, g, gridName, typeName,
+                    ms, ns, ks, orients, algs, nbs, layers );
+              } );
+        } );
+        reporter.Finish();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "Benchmark.hpp"
+using namespace El;
+
+namespace {
+
+template<typename T>
+void Benchmark
+( bench::Reporter& reporter, const bench::Options& opts,
+  const Grid& g, const string& gridName, const string& typeName,
+  const vector<Int>& ms, const vector<Int>& ns, const vector<string>& orients )
+{
+    const T alpha = TypeTraits<T>::One(), beta = TypeTraits<T>::Zero();
+    for( const Int m : ms )
+    for( const Int n : ns )
+    for( const auto& orient : orients )
+    {
+        if( orient.size() != 1 )
+            LogicError("Expected an orientation such as N: ",orient);
+        const Orientation orientA = CharToOrientation(orient[0]);
+        const Int xHeight = ( orientA == NORMAL ? n : m );
+        const Int yHeight = ( orientA == NORMAL ? m : n );
+        DistMatrix<T> A(g), x(g), y(g);
+        Uniform( A, m, n );
+        Uniform( x, xHeight, 1 );
+        Zeros( y, yHeight, 1 );
+
+        auto result = bench::Measure( g, opts, [&]()
+          { Gemv( orientA, alpha, A, x, beta, y ); } );
+        result.params =
+          { {"type",typeName}, {"grid",gridName}, {"m",m}, {"n",n},
+            {"orient",orient} };
+        result.flops = bench::FlopsPerFMA<T>()*double(m)*n;
+        result.bytes = double(m*n+m+n)*sizeof(T);
+        reporter.Add( result );
+    }
+}
+
+} // namespace <anon>
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const auto opts = bench::CommonInput();
+        const auto ms = bench::ParseList<Int>
+          (Input("--m","heights of A",string("4000")));
+        const auto ns = bench::ParseList<Int>
+          (Input("--n","widths of A",string("4000")));
+        const auto orients = bench::SplitList
+          (Input("--orients","orientations of A (N,T,C)",string("N,T")));
+        ProcessInput();
+
+        bench::Reporter reporter( "Gemv", opts );
+        bench::ForEachGrid( opts, [&]( const Grid& g, const string& gridName )
+        {
+            bench::ForEachType( opts.types,
+              [&]( auto tag, const string& typeName )
+              {
+                  Benchmark<typename decltype(tag)::type>
+                  ( reporter, opts, g, gridName, typeName, ms, ns, orients );
+              } );
+        } );
+        reporter.Finish();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
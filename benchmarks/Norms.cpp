@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "Benchmark.hpp"
+using namespace El;
+
+namespace {
+
+template<typename T>
+void Benchmark
+( bench::Reporter& reporter, const bench::Options& opts,
+  const Grid& g, const string& gridName, const string& typeName,
+  const vector<Int>& ms, const vector<Int>& ns,
+  const vector<bench::DistPair>& dists, const vector<string>& norms )
+{
+    typedef Base<T> Real;
+    for( const Int m : ms )
+    for( const Int n : ns )
+    for( const auto& dist : dists )
+    {
+        auto A = bench::MakeDistMatrix<T>( g, dist );
+        Uniform( *A, m, n );
+        for( const auto& norm : norms )
+        {
+            // The column and row two-norms are only provided for [MC,MR]
+            // matrices here
+            const bool lineNorms = norm == "column-two" || norm == "row-two";
+            if( lineNorms && (dist.colDist != MC || dist.rowDist != MR) )
+                continue;
+
+            Real value;
+            std::function<void()> op;
+            if( norm == "frobenius" )
+                op = [&]() { value = FrobeniusNorm( *A ); };
+            else if( norm == "entrywise-one" )
+                op = [&]() { value = EntrywiseNorm( *A, Real(1) ); };
+            else if( norm == "column-two" )
+            {
+                auto& AMCMR = static_cast<const DistMatrix<T>&>( *A );
+                DistMatrix<Real,MR,STAR> columnNorms(g);
+                op = [&AMCMR,columnNorms]() mutable
+                     { ColumnTwoNorms( AMCMR, columnNorms ); };
+            }
+            else if( norm == "row-two" )
+            {
+                auto& AMCMR = static_cast<const DistMatrix<T>&>( *A );
+                DistMatrix<Real,MC,STAR> rowNorms(g);
+                op = [&AMCMR,rowNorms]() mutable
+                     { RowTwoNorms( AMCMR, rowNorms ); };
+            }
+            else
+                LogicError("Unknown norm ",norm);
+
+            auto result = bench::Measure( g, opts, op );
+            result.params =
+              { {"type",typeName}, {"grid",gridName}, {"m",m}, {"n",n},
+                {"dist",bench::DistPairToString(dist)}, {"norm",norm} };
+            // A multiply-add per entry for the sums of squares, otherwise
+            // one addition per entry
+            const bool squares = norm != "entrywise-one";
+            result.flops =
+              (squares ? bench::FlopsPerFMA<T>() : 1)*double(m)*n;
+            result.bytes = double(m*n)*sizeof(T);
+            reporter.Add( result );
+        }
+    }
+}
+
+} // namespace <anon>
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const auto opts = bench::CommonInput();
+        const auto ms = bench::ParseList<Int>
+          (Input("--m","matrix heights",string("4000")));
+        const auto ns = bench::ParseList<Int>
+          (Input("--n","matrix widths",string("4000")));
+        const auto dists = bench::ParseDistPairs
+          (Input("--dists","distributions (e.g., MC/MR) or all",
+                 string("MC/MR")));
+        const auto norms = bench::SplitList
+          (Input("--norms",
+                 "frobenius,entrywise-one,column-two,row-two",
+                 string("frobenius,entrywise-one,column-two,row-two")));
+        ProcessInput();
+
+        bench::Reporter reporter( "Norms", opts );
+        bench::ForEachGrid( opts, [&]( const Grid& g, const string& gridName )
+        {
+            bench::ForEachType( opts.types,
+              [&]( auto tag, const string& typeName )
+              {
+                  Benchmark<typename decltype(tag)::type>
+                  ( reporter, opts, g, gridName, typeName,
+                    ms, ns, dists, norms );
+              } );
+        } );
+        reporter.Finish();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "Benchmark.hpp"
+using namespace El;
+
+namespace {
+
+template<typename T>
+void Benchmark
+( bench::Reporter& reporter, const bench::Options& opts,
+  const Grid& g, const string& gridName, const string& typeName,
+  const vector<Int>& ms, const vector<Int>& ns,
+  const vector<bench::DistPair>& froms, const vector<bench::DistPair>& tos,
+  bool conjugate )
+{
+    for( const Int m : ms )
+    for( const Int n : ns )
+    for( const auto& from : froms )
+    {
+        auto A = bench::MakeDistMatrix<T>( g, from );
+        Uniform( *A, m, n );
+        for( const auto& to : tos )
+        {
+            auto B = bench::MakeDistMatrix<T>( g, to );
+            auto result = bench::Measure( g, opts, [&]()
+              { Transpose( *A, *B, conjugate ); } );
+            result.params =
+              { {"type",typeName}, {"grid",gridName}, {"m",m}, {"n",n},
+                {"from",bench::DistPairToString(from)},
+                {"to",bench::DistPairToString(to)},
+                {"conjugate",conjugate ? "true" : "false"} };
+            result.bytes = double(m*n)*sizeof(T);
+            reporter.Add( result );
+        }
+    }
+}
+
+} // namespace <anon>
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const auto opts = bench::CommonInput();
+        const auto ms = bench::ParseList<Int>
+          (Input("--m","heights of A",string("2000")));
+        const auto ns = bench::ParseList<Int>
+          (Input("--n","widths of A",string("2000")));
+        const auto froms = bench::ParseDistPairs
+          (Input("--from","distributions of A (e.g., MC/MR) or all",
+                 string("MC/MR")));
+        const auto tos = bench::ParseDistPairs
+          (Input("--to","distributions of B (e.g., MR/MC) or all",
+                 string("MC/MR,MR/MC")));
+        const bool conjugate = Input("--conjugate","conjugate?",false);
+        ProcessInput();
+
+        bench::Reporter reporter( "Transpose", opts );
+        bench::ForEachGrid( opts, [&]( const Grid& g, const string& gridName )
+        {
+            bench::ForEachType( opts.types,
+              [&]( auto tag, const string& typeName )
+              {
+                  Benchmark<typename decltype(tag)::type>
+                  ( reporter, opts, g, gridName, typeName,
+                    ms, ns, froms, tos, conjugate );
+              } );
+        } );
+        reporter.Finish();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -83,6 +83,161 @@ void AllReduce(AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op)
     AllReduce(A.Matrix(), comm, op);
 }
 
+/** @brief A pending AllReduceAsync of a matrix.
+ *
+ *  Non-contiguous matrices are reduced through a packed copy, which is
+ *  unpacked into the matrix when the request completes.
+ *
+ *  With HYDROGEN_ENSURE_HOST_MPI_BUFFERS, device buffers are staged
+ *  through the host, and the staging buffers do not outlive the call. GPU
+ *  matrices are then reduced with the blocking collective, so the request
+ *  has already completed when it is returned.
+ */
+template <typename T>
+class AllReduceRequest
+{
+public:
+    AllReduceRequest() = default;
+    AllReduceRequest(AllReduceRequest<T>&& other)
+        : request_(std::move(other.request_)),
+          packed_(std::move(other.packed_)),
+          target_(other.target_), active_(other.active_)
+    {
+        other.active_ = false;
+    }
+    AllReduceRequest<T>& operator=(AllReduceRequest<T>&& other)
+    {
+        if (this != &other)
+        {
+            Wait();
+            request_ = std::move(other.request_);
+            packed_ = std::move(other.packed_);
+            target_ = other.target_;
+            active_ = other.active_;
+            other.active_ = false;
+        }
+        return *this;
+    }
+    ~AllReduceRequest()
+    {
+        // Destructors are implicitly noexcept
+        try { Wait(); }
+        catch (std::exception const& e) { ReportException(e); }
+    }
+
+    /** @brief Whether the reduction is still pending. */
+    bool Active() const noexcept { return active_; }
+
+    /** @brief Complete the reduction if it has finished. */
+    bool Test()
+    {
+        if (!active_)
+            return true;
+        if (!mpi::Test(request_))
+            return false;
+        Wait();
+        return true;
+    }
+
+    /** @brief Block until the reduction has completed. */
+    void Wait()
+    {
+        if (!active_)
+            return;
+        active_ = false;
+        mpi::Wait(request_);
+        if (packed_)
+        {
+            Copy(*packed_, *target_);
+            packed_.reset();
+        }
+    }
+
+private:
+    template <typename S, Device D, typename>
+    friend AllReduceRequest<S>
+    AllReduceAsync(Matrix<S,D>& A, mpi::Comm const& comm, mpi::Op op);
+
+    mpi::Request<T> request_;
+    unique_ptr<AbstractMatrix<T>> packed_;
+    AbstractMatrix<T>* target_ = nullptr;
+    bool active_ = false;
+};
+
+template <typename T, Device D, typename>
+AllReduceRequest<T>
+AllReduceAsync(Matrix<T,D>& A, mpi::Comm const& comm, mpi::Op op)
+{
+    EL_DEBUG_CSE
+    AllReduceRequest<T> request;
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int size = height*width;
+    if(mpi::Size(comm) == 1 || size == 0)
+        return request;
+
+    SyncInfo<D> syncInfoA = SyncInfoFromMatrix(A);
+    T* buffer = A.Buffer();
+    if(height != A.LDim())
+    {
+        // Pack
+        auto packed = MakeUnique<Matrix<T,D>>(height, width);
+        SetSyncInfo(*packed, syncInfoA);
+        copy::util::InterleaveMatrix(
+            height, width,
+            A.LockedBuffer(),  1, A.LDim(),
+            packed->Buffer(), 1, height, syncInfoA);
+        buffer = packed->Buffer();
+        request.packed_ = std::move(packed);
+    }
+
+    mpi::IAllReduce(buffer, size, op, comm, request.request_, syncInfoA);
+    request.target_ = &A;
+    request.active_ = true;
+    return request;
+}
+
+template <typename T, Device D,typename,typename>
+AllReduceRequest<T>
+AllReduceAsync(Matrix<T,D>& A, mpi::Comm const& comm, mpi::Op op)
+{
+    LogicError("AllReduceAsync: Bad type/device combination!");
+    return AllReduceRequest<T>();
+}
+
+template <typename T>
+AllReduceRequest<T>
+AllReduceAsync(AbstractMatrix<T>& A, mpi::Comm const& comm, mpi::Op op)
+{
+    switch (A.GetDevice())
+    {
+    case Device::CPU:
+        return AllReduceAsync(
+            static_cast<Matrix<T,Device::CPU>&>(A), comm, op);
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        return AllReduceAsync(
+            static_cast<Matrix<T,Device::GPU>&>(A), comm, op);
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("AllReduceAsync: Bad device!");
+    }
+    return AllReduceRequest<T>();
+}
+
+template<typename T>
+AllReduceRequest<T>
+AllReduceAsync(AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op)
+{
+    EL_DEBUG_CSE
+    if(mpi::Size(comm) == 1)
+        return AllReduceRequest<T>();
+    if(!A.Participating())
+        return AllReduceRequest<T>();
+
+    return AllReduceAsync(A.Matrix(), comm, op);
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -93,6 +248,10 @@ void AllReduce(AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op)
   EL_EXTERN template void AllReduce \
   (AbstractMatrix<T>& A, mpi::Comm const& comm, mpi::Op op); \
   EL_EXTERN template void AllReduce \
+  (AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op); \
+  EL_EXTERN template AllReduceRequest<T> AllReduceAsync \
+  (AbstractMatrix<T>& A, mpi::Comm const& comm, mpi::Op op); \
+  EL_EXTERN template AllReduceRequest<T> AllReduceAsync \
   (AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op);
 
 #define EL_ENABLE_HALF
@@ -52,6 +52,8 @@ void Axpy(S alphaS, const Matrix<T,Device::CPU>& X, Matrix<T,Device::CPU>& Y)
     const T* XBuf = X.LockedBuffer();
           T* YBuf = Y.Buffer();
 
+    auto syncInfoX = SyncInfoFromMatrix(X), syncInfoY = SyncInfoFromMatrix(Y);
+    auto syncHelper = MakeMultiSync(syncInfoY, syncInfoX);
 
     // If X and Y are vectors, we can allow one to be a column and the other
     // to be a row. Otherwise we force X and Y to be the same dimension.
@@ -66,9 +68,12 @@ void Axpy(S alphaS, const Matrix<T,Device::CPU>& X, Matrix<T,Device::CPU>& Y)
           if (XLength != YLength)
               LogicError("Nonconformal Axpy");
        )
-        EL_PARALLEL_FOR
-        for(Int i=0; i<XLength; ++i)
-            YBuf[i*YStride] += alpha*XBuf[i*XStride];
+        RunOnStream(syncInfoY, [=]
+        {
+            EL_PARALLEL_FOR
+            for(Int i=0; i<XLength; ++i)
+                YBuf[i*YStride] += alpha*XBuf[i*XStride];
+        });
     }
     else
     {
@@ -76,21 +81,27 @@ void Axpy(S alphaS, const Matrix<T,Device::CPU>& X, Matrix<T,Device::CPU>& Y)
         // memory. Otherwise iterate over double loop.
         if (ldX == mX && ldY == mX)
         {
-            EL_PARALLEL_FOR
-            for(Int i=0; i<mX*nX; ++i)
-                YBuf[i] += alpha*XBuf[i];
+            RunOnStream(syncInfoY, [=]
+            {
+                EL_PARALLEL_FOR
+                for(Int i=0; i<mX*nX; ++i)
+                    YBuf[i] += alpha*XBuf[i];
+            });
         }
         else
         {
-            EL_PARALLEL_FOR
-            for(Int j=0; j<nX; ++j)
+            RunOnStream(syncInfoY, [=]
             {
-                EL_SIMD
-                for(Int i=0; i<mX; ++i)
+                EL_PARALLEL_FOR
+                for(Int j=0; j<nX; ++j)
                 {
-                    YBuf[i+j*ldY] += alpha*XBuf[i+j*ldX];
+                    EL_SIMD
+                    for(Int i=0; i<mX; ++i)
+                    {
+                        YBuf[i+j*ldY] += alpha*XBuf[i+j*ldX];
+                    }
                 }
-            }
+            });
         }
     }
 }
@@ -25,14 +25,17 @@ void InterleaveMatrixUpdate(
     T alpha, Int height, Int width,
     T const* A, Int colStrideA, Int rowStrideA,
     T* B, Int colStrideB, Int rowStrideB,
-    SyncInfo<Device::CPU>)
+    SyncInfo<Device::CPU> syncInfo)
 {
-    // TODO: Add OpenMP parallelization and/or optimize
-    for( Int j=0; j<width; ++j )
-        blas::Axpy(
-            height, alpha,
-            &A[rowStrideA*j], colStrideA,
-            &B[rowStrideB*j], colStrideB);
+    RunOnStream(syncInfo, [=]
+    {
+        // TODO: Add OpenMP parallelization and/or optimize
+        for( Int j=0; j<width; ++j )
+            blas::Axpy(
+                height, alpha,
+                &A[rowStrideA*j], colStrideA,
+                &B[rowStrideB*j], colStrideB);
+    });
 }
 
 #ifdef HYDROGEN_HAVE_CUDA
@@ -25,7 +25,25 @@ void Broadcast_impl( Matrix<T,D>& A, mpi::Comm const& comm, int rank )
     const Int size = height*width;
     SyncInfo<D> syncInfoA = SyncInfoFromMatrix(A);
 
-    if( height == A.LDim() )
+    // Within a node, the root copies its matrix into a shared window (which
+    // spans the segments of all of the processes) and the others copy it out
+    T* sharedBuf = copy::util::SharedPortions<T,D>
+      ( comm, (size+commSize-1)/commSize, syncInfoA );
+    if( sharedBuf )
+    {
+        if( commRank == rank )
+            copy::util::InterleaveMatrix(
+                height, width,
+                A.LockedBuffer(), 1, A.LDim(),
+                sharedBuf,        1, height, syncInfoA);
+        mpi::SharedWindowSync( comm );
+        if( commRank != rank )
+            copy::util::InterleaveMatrix(
+                height,     width,
+                sharedBuf,  1, height,
+                A.Buffer(), 1, A.LDim(), syncInfoA);
+    }
+    else if( height == A.LDim() )
     {
         mpi::Broadcast(A.Buffer(), size, rank, comm, syncInfoA);
     }
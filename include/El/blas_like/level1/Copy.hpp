@@ -15,6 +15,7 @@
 
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
+#include <El/blas_like/level1/Copy/RedistPlan.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
 
 namespace El {
@@ -76,37 +77,43 @@ void Copy( const Matrix<T>& A, Matrix<T>& B )
     const T* EL_RESTRICT ABuf = A.LockedBuffer();
           T* EL_RESTRICT BBuf = B.Buffer();
 
-    if( ldA == height && ldB == height )
+    auto syncInfoA = SyncInfoFromMatrix(A), syncInfoB = SyncInfoFromMatrix(B);
+    auto syncHelper = MakeMultiSync(syncInfoB, syncInfoA);
+
+    RunOnStream(syncInfoB, [=]
     {
+        if( ldA == height && ldB == height )
+        {
 #ifdef _OPENMP
 #if defined(HYDROGEN_HAVE_OMP_TASKLOOP)
-        const Int numThreads = omp_get_num_threads();
-        #pragma omp taskloop default(shared)
-        for(Int thread = 0; thread < numThreads; ++thread)
-        {
-#else
-        #pragma omp parallel
-        {
             const Int numThreads = omp_get_num_threads();
-            const Int thread = omp_get_thread_num();
+            #pragma omp taskloop default(shared)
+            for(Int thread = 0; thread < numThreads; ++thread)
+            {
+#else
+            #pragma omp parallel
+            {
+                const Int numThreads = omp_get_num_threads();
+                const Int thread = omp_get_thread_num();
 #endif
-            const Int chunk = (size + numThreads - 1) / numThreads;
-            const Int start = Min(chunk * thread, size);
-            const Int end = Min(chunk * (thread + 1), size);
-            MemCopy( &BBuf[start], &ABuf[start], end - start );
-        }
+                const Int chunk = (size + numThreads - 1) / numThreads;
+                const Int start = Min(chunk * thread, size);
+                const Int end = Min(chunk * (thread + 1), size);
+                MemCopy( &BBuf[start], &ABuf[start], end - start );
+            }
 #else
-        MemCopy( BBuf, ABuf, size );
+            MemCopy( BBuf, ABuf, size );
 #endif
-    }
-    else
-    {
-        EL_PARALLEL_FOR
-        for( Int j=0; j<width; ++j )
+        }
+        else
         {
-            MemCopy(&BBuf[j*ldB], &ABuf[j*ldA], height);
+            EL_PARALLEL_FOR
+            for( Int j=0; j<width; ++j )
+            {
+                MemCopy(&BBuf[j*ldB], &ABuf[j*ldA], height);
+            }
         }
-    }
+    });
 }
 
 #ifdef HYDROGEN_HAVE_CUDA
@@ -45,9 +45,17 @@ void AllGather
             const Int maxLocalHeight = MaxLength(height,colStride);
             const Int maxLocalWidth = MaxLength(width,rowStride);
             const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-            simple_buffer<T,D> buf((distStride+1)*portionSize, syncInfoB);
-            T* sendBuf = buf.data();
-            T* recvBuf = buf.data() + portionSize;
+
+            // Within a node, each process packs into its portion of a shared
+            // window and unpacks directly from the portions of the others
+            T* sharedBuf =
+              util::SharedPortions<T,D>
+              ( A.DistComm(), portionSize, syncInfoB );
+            simple_buffer<T,D> buf
+            ( sharedBuf ? 0 : (distStride+1)*portionSize, syncInfoB );
+            T* sendBuf = ( sharedBuf ? sharedBuf + A.DistRank()*portionSize
+                                     : buf.data() );
+            T* recvBuf = ( sharedBuf ? sharedBuf : buf.data() + portionSize );
 
 #if 0
             simple_buffer<T,D1> send_buffer(portionSize);
@@ -63,9 +71,12 @@ void AllGather
                 syncInfoB);
 
             // Communicate
-            mpi::AllGather(
-                sendBuf, portionSize, recvBuf, portionSize, A.DistComm(),
-                syncInfoB);
+            if( sharedBuf )
+                mpi::SharedWindowSync( A.DistComm() );
+            else
+                mpi::AllGather(
+                    sendBuf, portionSize, recvBuf, portionSize, A.DistComm(),
+                    syncInfoB);
 
             // Unpack
             util::StridedUnpack(
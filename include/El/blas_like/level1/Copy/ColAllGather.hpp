@@ -64,9 +64,16 @@ void ColAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                 const Int localWidth = A.LocalWidth();
                 const Int portionSize = mpi::Pad(maxLocalHeight*localWidth);
 
-                simple_buffer<T,D> buffer((colStride+1)*portionSize, syncInfoB);
-                T* sendBuf = buffer.data();
-                T* recvBuf = buffer.data() + portionSize;
+                // Within a node, pack into our portion of a shared window
+                T* sharedBuf =
+                    util::SharedPortions<T,D>(
+                        A.ColComm(), portionSize, syncInfoB);
+                simple_buffer<T,D> buffer(
+                    sharedBuf ? 0 : (colStride+1)*portionSize, syncInfoB);
+                T* sendBuf = (sharedBuf ? sharedBuf + A.ColRank()*portionSize
+                                        : buffer.data());
+                T* recvBuf = (sharedBuf ? sharedBuf
+                                        : buffer.data() + portionSize);
 
                 // Pack
                 util::InterleaveMatrix(
@@ -75,9 +82,12 @@ void ColAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                     sendBuf,          1, A.LocalHeight(), syncInfoB);
 
                 // Communicate
-                mpi::AllGather(
-                    sendBuf, portionSize, recvBuf, portionSize, A.ColComm(),
-                    syncInfoB);
+                if (sharedBuf)
+                    mpi::SharedWindowSync(A.ColComm());
+                else
+                    mpi::AllGather(
+                        sendBuf, portionSize, recvBuf, portionSize,
+                        A.ColComm(), syncInfoB);
 
                 // Unpack
                 util::ColStridedUnpack(
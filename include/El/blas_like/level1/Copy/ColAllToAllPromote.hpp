@@ -50,9 +50,21 @@ void ColAllToAllPromote
         }
         else
         {
-            simple_buffer<T,D> buffer(2*colStrideUnion*portionSize, syncInfoB);
-            T* firstBuf  = buffer.data();
-            T* secondBuf = buffer.data() + colStrideUnion*portionSize;
+            // Within a node, each process packs its portions into its
+            // segment of a shared window, and unpacks the portions meant for
+            // it directly from the segments of the others
+            const Int segmentSize = colStrideUnion*portionSize;
+            T* sharedBuf =
+              util::SharedPortions<T,D>
+              ( A.PartialUnionColComm(), segmentSize, syncInfoB );
+            simple_buffer<T,D> buffer
+            ( sharedBuf ? 0 : 2*segmentSize, syncInfoB );
+            const Int colRankUnion = A.PartialUnionColRank();
+            T* firstBuf  = ( sharedBuf ? sharedBuf + colRankUnion*segmentSize
+                                       : buffer.data() );
+            T* secondBuf = ( sharedBuf ? sharedBuf + colRankUnion*portionSize
+                                       : buffer.data() + segmentSize );
+            const Int recvStride = ( sharedBuf ? segmentSize : portionSize );
 
             // Pack
             util::RowStridedPack(
@@ -62,10 +74,13 @@ void ColAllToAllPromote
                 firstBuf,         portionSize, syncInfoB);
 
             // Simultaneously Gather in columns and Scatter in rows
-            mpi::AllToAll(
-                firstBuf,  portionSize,
-                secondBuf, portionSize, A.PartialUnionColComm(),
-                syncInfoB);
+            if( sharedBuf )
+                mpi::SharedWindowSync( A.PartialUnionColComm() );
+            else
+                mpi::AllToAll(
+                    firstBuf,  portionSize,
+                    secondBuf, portionSize, A.PartialUnionColComm(),
+                    syncInfoB);
 
             // Unpack
             util::PartialColStridedUnpack(
@@ -73,7 +88,7 @@ void ColAllToAllPromote
                 A.ColAlign(), colStride,
                 colStrideUnion, colStridePart, colRankPart,
                 B.ColShift(),
-                secondBuf,  portionSize,
+                secondBuf,  recvStride,
                 B.Buffer(), B.LDim(), syncInfoB);
         }
     }
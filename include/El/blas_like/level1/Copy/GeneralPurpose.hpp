@@ -14,159 +14,288 @@ namespace El
 namespace copy
 {
 
-template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
-void Helper
-(const AbstractDistMatrix<S>& A,
-        AbstractDistMatrix<T>& B)
+// A maximal set of consecutive local rows (or columns) of one distribution
+// which are all owned by the same process row (or column) of another
+struct Run
 {
-    EL_DEBUG_CSE
+    Int localBeg;
+    Int length;
+};
 
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
-    const Int height = A.Height();
-    const Int width = A.Width();
-    const Grid& g = B.Grid();
-    B.Resize(height, width);
-    Zero(B);
-    const bool BPartic = B.Participating();
-    const int BRoot = B.Root();
+// Partition the local indices [0,localSize) by the process (out of
+// 'numOwners') that owns the corresponding global index in the other
+// distribution. Local indices are increasing in the global index for any
+// block-cyclic distribution, so the runs of each owner visit its global
+// indices in increasing order. The sending and receiving processes can
+// therefore each enumerate the same (column-major) order independently,
+// and only the payload needs to be exchanged.
+template<typename GlobalFunc,typename OwnerFunc>
+vector<vector<Run>> RunsByOwner
+(Int localSize, int numOwners, GlobalFunc global, OwnerFunc owner)
+{
+    vector<vector<Run>> runs(numOwners);
+    int lastOwner = -1;
+    for(Int loc=0; loc<localSize; ++loc)
+    {
+        const int o = owner(global(loc));
+        if (o == lastOwner)
+            ++runs[o].back().length;
+        else
+            runs[o].push_back(Run{loc,1});
+        lastOwner = o;
+    }
+    return runs;
+}
 
-    const bool includeViewers = (A.Grid() != B.Grid());
+inline Int RunsLength(const vector<Run>& runs)
+{
+    Int length = 0;
+    for(const auto& run : runs)
+        length += run.length;
+    return length;
+}
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
+template<typename S,typename T>
+void CastCopy(T* dest, const S* source, Int numEntries)
+{
+    for(Int k=0; k<numEntries; ++k)
+        dest[k] = Caster<S,T>::Cast(source[k]);
+}
 
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
-    if (A.RedundantRank() == 0)
-    {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
-
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
-        for(Int iLoc=0; iLoc<localHeight; ++iLoc)
-        {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
-        }
+template<typename T>
+void CastCopy(T* dest, const T* source, Int numEntries)
+{ MemCopy(dest, source, numEntries); }
 
-        remoteEntries.reserve(localHeight*localWidth);
-        distOwners.reserve(localHeight*localWidth);
-        for(Int jLoc=0; jLoc<localWidth; ++jLoc)
-        {
-            const Int j = A.GlobalCol(jLoc);
-            const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = (BPartic && ownerCol == rowRank);
-            for(Int iLoc=0; iLoc<localHeight; ++iLoc)
-            {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = (BPartic && ownerRow == colRank);
-                const S& alpha = A.GetLocal(iLoc,jLoc);
-                if (noRedundant && isLocalRow && isLocalCol)
-                {
-                    B.SetLocal(localRow,localCol,Caster<S,T>::Cast(alpha));
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    (Entry<S>{localRow,localCol,alpha});
-                    distOwners.push_back(ownerRow + colStride*ownerCol);
-                }
-            }
-        }
-    }
+// The communication schedule for redistributing A into B, which must
+// already have been resized to A's dimensions. The schedule only depends
+// upon the distributions, dimensions, alignments, and grids of A and B,
+// and so it can be reused for any pair of matrices which match them
+// (see RedistPlan).
+struct RedistSchedule
+{
+    bool includeViewers=false;
+    mpi::Comm const* comm=nullptr;
 
     // We will first push to redundant rank 0 of B
-    const int redundantRootB = 0;
+    static const int redundantRootB = 0;
+
+    int colStrideA=1, rowStrideA=1, colStrideB=1, rowStrideB=1;
+    vector<vector<Run>> rowRunsTo, colRunsTo, rowRunsFrom, colRunsFrom;
+    vector<int> sendCounts, sendOffs, sendRanks;
+    vector<int> recvCounts, recvOffs, recvRanks;
+    Int totalSend=0, totalRecv=0;
+    bool receiving=false;
 
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    vector<int> sendCounts, owners(totalSend);
-    if (includeViewers)
+    RedistSchedule() { }
+
+    template<typename S,typename T>
+    RedistSchedule
+    (const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B)
     {
-        const int viewingSize = mpi::Size(g.ViewingComm());
-        const int distBSize = mpi::Size(B.DistComm());
+        EL_DEBUG_CSE
+        const Grid& g = B.Grid();
+        includeViewers = (A.Grid() != B.Grid());
+        comm = (includeViewers ? &g.ViewingComm() : &g.VCComm());
+        const int commSize = mpi::Size(*comm);
 
-        vector<int> distBToViewing(distBSize);
-        for(int distBRank=0; distBRank<distBSize; ++distBRank)
-        {
-            const int vcOwner =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
-            distBToViewing[distBRank] = g.VCToViewing(vcOwner);
-        }
+        auto commRank = [&](const Grid& grid, int vcRank)
+          { return includeViewers ? grid.VCToViewing(vcRank) : vcRank; };
+        auto sourceRank = [&](int distRank)
+          {
+              return commRank
+                (A.Grid(),
+                 A.Grid().CoordsToVC
+                 (A.ColDist(), A.RowDist(), distRank, A.Root(), 0));
+          };
+        auto targetRank = [&](int distRank)
+          {
+              return commRank
+                (g,
+                 g.CoordsToVC
+                 (B.ColDist(), B.RowDist(), distRank, B.Root(),
+                  redundantRootB));
+          };
 
-        sendCounts.resize(viewingSize,0);
-        for(Int k=0; k<totalSend; ++k)
+        // Compute the send schedule
+        // =========================
+        colStrideB = B.ColStride();
+        rowStrideB = B.RowStride();
+        sendCounts.assign(commSize, 0);
+        if (A.Participating() && A.RedundantRank() == 0)
         {
-            owners[k] = distBToViewing[distOwners[k]];
-            ++sendCounts[owners[k]];
+            rowRunsTo = RunsByOwner
+              (A.LocalHeight(), colStrideB,
+               [&](Int iLoc) { return A.GlobalRow(iLoc); },
+               [&](Int i) { return B.RowOwner(i); });
+            colRunsTo = RunsByOwner
+              (A.LocalWidth(), rowStrideB,
+               [&](Int jLoc) { return A.GlobalCol(jLoc); },
+               [&](Int j) { return B.ColOwner(j); });
+            sendRanks.resize(colStrideB*rowStrideB);
+            for(int q=0; q<colStrideB*rowStrideB; ++q)
+            {
+                sendRanks[q] = targetRank(q);
+                sendCounts[sendRanks[q]] =
+                  RunsLength(rowRunsTo[q % colStrideB]) *
+                  RunsLength(colRunsTo[q / colStrideB]);
+            }
         }
-    }
-    else
-    {
-        if (!g.InGrid())
-            return;
 
-        const int distBSize = mpi::Size(B.DistComm());
-        vector<int> distBToVC(distBSize);
-        for(int distBRank=0; distBRank<distBSize; ++distBRank)
+        // Compute the receive schedule
+        // ============================
+        colStrideA = A.ColStride();
+        rowStrideA = A.RowStride();
+        recvCounts.assign(commSize, 0);
+        receiving = B.Participating() && B.RedundantRank() == redundantRootB;
+        if (receiving)
         {
-            distBToVC[distBRank] =
-              g.CoordsToVC
-              (B.ColDist(),B.RowDist(),distBRank,BRoot,redundantRootB);
+            rowRunsFrom = RunsByOwner
+              (B.LocalHeight(), colStrideA,
+               [&](Int iLoc) { return B.GlobalRow(iLoc); },
+               [&](Int i) { return A.RowOwner(i); });
+            colRunsFrom = RunsByOwner
+              (B.LocalWidth(), rowStrideA,
+               [&](Int jLoc) { return B.GlobalCol(jLoc); },
+               [&](Int j) { return A.ColOwner(j); });
+            recvRanks.resize(colStrideA*rowStrideA);
+            for(int p=0; p<colStrideA*rowStrideA; ++p)
+            {
+                recvRanks[p] = sourceRank(p);
+                recvCounts[recvRanks[p]] =
+                  RunsLength(rowRunsFrom[p % colStrideA]) *
+                  RunsLength(colRunsFrom[p / colStrideA]);
+            }
         }
 
-        const int vcSize = mpi::Size(g.VCComm());
-        sendCounts.resize(vcSize,0);
-        for(Int k=0; k<totalSend; ++k)
+        totalSend = Scan(sendCounts, sendOffs);
+        totalRecv = Scan(recvCounts, recvOffs);
+    }
+
+    // Pack the local entries of A into a buffer of length totalSend
+    template<typename S>
+    void Pack(const Matrix<S,Device::CPU>& ALoc, S* sendBuf) const
+    {
+        EL_DEBUG_CSE
+        const S* ABuf = ALoc.LockedBuffer();
+        const Int ALDim = ALoc.LDim();
+        for(size_t q=0; q<sendRanks.size(); ++q)
         {
-            owners[k] = distBToVC[distOwners[k]];
-            ++sendCounts[owners[k]];
+            S* buf = &sendBuf[sendOffs[sendRanks[q]]];
+            const auto& rowRuns = rowRunsTo[q % colStrideB];
+            for(const auto& colRun : colRunsTo[q / colStrideB])
+                for(Int jLoc=colRun.localBeg;
+                    jLoc<colRun.localBeg+colRun.length; ++jLoc)
+                    for(const auto& rowRun : rowRuns)
+                    {
+                        MemCopy
+                        (buf, &ABuf[rowRun.localBeg+jLoc*ALDim],
+                         rowRun.length);
+                        buf += rowRun.length;
+                    }
         }
     }
-    SwapClear(distOwners);
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan(sendCounts, sendOffs);
-    vector<Entry<S>> sendBuf;
-    FastResize(sendBuf, totalSend);
-    auto offs = sendOffs;
-    for(Int k=0; k<totalSend; ++k)
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear(remoteEntries);
-    SwapClear(owners);
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll(
-        sendBuf, sendCounts, sendOffs,
-        includeViewers ? g.ViewingComm(): g.VCComm());
-    if (BPartic)
+
+    // Unpack a buffer of length totalRecv into the local entries of B
+    template<typename S,typename T>
+    void Unpack(const S* recvBuf, Matrix<T,Device::CPU>& BLoc) const
     {
-        if (B.RedundantRank() == redundantRootB)
+        EL_DEBUG_CSE
+        if (!receiving)
+            return;
+        T* BBuf = BLoc.Buffer();
+        const Int BLDim = BLoc.LDim();
+        for(size_t p=0; p<recvRanks.size(); ++p)
         {
-            Int recvBufSize = recvBuf.size();
-            for(Int k=0; k<recvBufSize; ++k)
-            {
-                const auto& entry = recvBuf[k];
-                B.SetLocal(entry.i,entry.j,Caster<S,T>::Cast(entry.value));
-            }
+            const S* buf = &recvBuf[recvOffs[recvRanks[p]]];
+            const auto& rowRuns = rowRunsFrom[p % colStrideA];
+            for(const auto& colRun : colRunsFrom[p / colStrideA])
+                for(Int jLoc=colRun.localBeg;
+                    jLoc<colRun.localBeg+colRun.length; ++jLoc)
+                    for(const auto& rowRun : rowRuns)
+                    {
+                        CastCopy
+                        (&BBuf[rowRun.localBeg+jLoc*BLDim], buf,
+                         rowRun.length);
+                        buf += rowRun.length;
+                    }
         }
-        El::Broadcast(B, B.RedundantComm(), redundantRootB);
     }
+};
+
+// The runs are packed from, and unpacked into, host memory. These return
+// the host view of the local matrix, staging it through 'host' if it lives
+// on the GPU.
+template<typename S>
+const Matrix<S,Device::CPU>& HostLocal
+(const AbstractDistMatrix<S>& A, Matrix<S,Device::CPU>& host)
+{
+    if (A.GetLocalDevice() == Device::CPU)
+        return static_cast<const Matrix<S,Device::CPU>&>(A.LockedMatrix());
+#ifdef HYDROGEN_HAVE_CUDA
+    Copy(A.LockedMatrix(), host);
+#endif // HYDROGEN_HAVE_CUDA
+    return host;
+}
+
+template<typename T>
+Matrix<T,Device::CPU>& HostLocal
+(AbstractDistMatrix<T>& B, Matrix<T,Device::CPU>& host)
+{
+    if (B.GetLocalDevice() == Device::CPU)
+        return static_cast<Matrix<T,Device::CPU>&>(B.Matrix());
+    host.Resize(B.LocalHeight(), B.LocalWidth());
+    return host;
+}
+
+// Copy the unpacked host entries back to the device (if necessary) and
+// broadcast them to the redundant copies of B
+template<typename T>
+void FinishRedist
+(const RedistSchedule& schedule,
+ const Matrix<T,Device::CPU>& host, AbstractDistMatrix<T>& B)
+{
+#ifdef HYDROGEN_HAVE_CUDA
+    if (B.GetLocalDevice() != Device::CPU && schedule.receiving)
+        Copy(host, B.Matrix());
+#endif // HYDROGEN_HAVE_CUDA
+    if (B.Participating())
+        El::Broadcast(B, B.RedundantComm(), schedule.redundantRootB);
+}
+
+// Redistribute between two arbitrary block-cyclic distributions (including
+// block sizes, alignments, cuts, and grids). The local rows and columns are
+// grouped into runs by their owners in the other distribution, contiguous
+// pieces of local columns are packed directly into the send buffer, and the
+// receivers unpack by enumerating the matching runs of their own local
+// matrix.
+template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
+void Helper
+(const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B)
+{
+    EL_DEBUG_CSE
+
+    // TODO: Decide whether S or T should be used as the transmission type
+    //       based upon which is smaller. Transmit S by default.
+    B.Resize(A.Height(), A.Width());
+    if (A.Grid() == B.Grid() && !B.Grid().InGrid())
+        return;
+    const RedistSchedule schedule(A, B);
+
+    Matrix<S,Device::CPU> AHost;
+    Matrix<T,Device::CPU> BHost;
+    vector<S> sendBuf(schedule.totalSend);
+    schedule.Pack(HostLocal(A, AHost), sendBuf.data());
+
+    vector<S> recvBuf(schedule.totalRecv);
+    mpi::AllToAll(
+        sendBuf.data(), schedule.sendCounts.data(), schedule.sendOffs.data(),
+        recvBuf.data(), schedule.recvCounts.data(), schedule.recvOffs.data(),
+        *schedule.comm, SyncInfo<Device::CPU>{});
+    SwapClear(sendBuf);
+    auto& BLoc = HostLocal(B, BHost);
+    schedule.Unpack(recvBuf.data(), BLoc);
+    FinishRedist(schedule, BLoc, B);
 }
 
 template<typename S,typename T,typename>
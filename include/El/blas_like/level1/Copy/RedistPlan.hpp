@@ -0,0 +1,157 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTPLAN_HPP
+#define EL_BLAS_COPY_REDISTPLAN_HPP
+
+namespace El
+{
+
+/** @class RedistPlan
+ *  @brief A reusable redistribution from one distributed matrix to another.
+ *
+ *  The communication schedule, the pack and unpack buffers, and a set of
+ *  persistent MPI requests are set up once, when the plan is constructed,
+ *  and each call to Execute only packs, communicates, and unpacks. A plan
+ *  can be executed on any pair of matrices whose distributions,
+ *  dimensions, alignments, block sizes, cuts, roots, and grids match those
+ *  it was constructed from, e.g., the identically-shaped iterates of an
+ *  iterative solver.
+ *
+ *  Construction and execution are collective over the union of the grids
+ *  of A and B, and the grids must outlive the plan.
+ */
+template<typename T>
+class RedistPlan
+{
+public:
+    /** Plan the redistribution of A into B. As with Copy, B is resized to
+     *  the dimensions of A, but its alignments are left as is. */
+    RedistPlan(const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B)
+    : distA_(A), distB_(B), height_(A.Height()), width_(A.Width())
+    {
+        EL_DEBUG_CSE
+        B.Resize(height_, width_);
+        distB_ = El::DistData(B);
+        active_ = (A.Grid() != B.Grid() || B.Grid().InGrid());
+        if (!active_)
+            return;
+
+        schedule_ = copy::RedistSchedule(A, B);
+        mpi::Dup(*schedule_.comm, comm_);
+        sendBuf_.resize(schedule_.totalSend);
+        recvBuf_.resize(schedule_.totalRecv);
+
+        // A collective is preferable once most pairs of processes exchange
+        // data; otherwise only the nonempty messages are started. Every
+        // process must make the same choice, so it depends upon the total
+        // number of pairs rather than upon the local peers.
+        const int commSize = mpi::Size(comm_);
+        int numPeers = 0;
+        for (int q=0; q<commSize; ++q)
+            if (schedule_.sendCounts[q] != 0 || schedule_.recvCounts[q] != 0)
+                ++numPeers;
+        MPI_Datatype type = mpi::TypeMap<T>();
+#if MPI_VERSION >= 4
+        const int totalPeers =
+          mpi::AllReduce(numPeers, mpi::SUM, comm_, SyncInfo<Device::CPU>{});
+        if (2*Int(totalPeers) > Int(commSize)*commSize)
+        {
+            requests_.resize(1);
+            EL_CHECK_MPI_CALL(
+              MPI_Alltoallv_init
+              (sendBuf_.data(), schedule_.sendCounts.data(),
+               schedule_.sendOffs.data(), type,
+               recvBuf_.data(), schedule_.recvCounts.data(),
+               schedule_.recvOffs.data(), type,
+               comm_.GetMPIComm(), MPI_INFO_NULL, &requests_[0]));
+            return;
+        }
+#endif // MPI_VERSION >= 4
+        requests_.reserve(2*numPeers);
+        for (int q=0; q<commSize; ++q)
+        {
+            if (schedule_.recvCounts[q] == 0)
+                continue;
+            requests_.emplace_back();
+            EL_CHECK_MPI_CALL(
+              MPI_Recv_init
+              (&recvBuf_[schedule_.recvOffs[q]], schedule_.recvCounts[q],
+               type, q, 0, comm_.GetMPIComm(), &requests_.back()));
+        }
+        for (int q=0; q<commSize; ++q)
+        {
+            if (schedule_.sendCounts[q] == 0)
+                continue;
+            requests_.emplace_back();
+            EL_CHECK_MPI_CALL(
+              MPI_Send_init
+              (&sendBuf_[schedule_.sendOffs[q]], schedule_.sendCounts[q],
+               type, q, 0, comm_.GetMPIComm(), &requests_.back()));
+        }
+    }
+
+    ~RedistPlan()
+    {
+        for (auto& request : requests_)
+            MPI_Request_free(&request);
+        if (active_)
+            mpi::Free(comm_);
+    }
+
+    RedistPlan(const RedistPlan<T>&) = delete;
+    RedistPlan<T>& operator=(const RedistPlan<T>&) = delete;
+
+    /** Whether the plan can redistribute A into B. */
+    bool Matches
+    (const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B) const
+    {
+        return A.Height() == height_ && A.Width() == width_ &&
+               B.Height() == height_ && B.Width() == width_ &&
+               El::DistData(A) == distA_ && El::DistData(B) == distB_;
+    }
+
+    /** Redistribute A into B. */
+    void Execute(const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B)
+    {
+        EL_DEBUG_CSE
+        if (!Matches(A, B))
+            LogicError("The matrices do not match the redistribution plan");
+        if (!active_)
+            return;
+
+        Matrix<T,Device::CPU> AHost, BHost;
+        schedule_.Pack(copy::HostLocal(A, AHost), sendBuf_.data());
+        if (!requests_.empty())
+        {
+            EL_CHECK_MPI_CALL(
+              MPI_Startall(int(requests_.size()), requests_.data()));
+            EL_CHECK_MPI_CALL(
+              MPI_Waitall
+              (int(requests_.size()), requests_.data(),
+               MPI_STATUSES_IGNORE));
+        }
+        auto& BLoc = copy::HostLocal(B, BHost);
+        schedule_.Unpack(recvBuf_.data(), BLoc);
+        copy::FinishRedist(schedule_, BLoc, B);
+    }
+
+private:
+    El::DistData distA_, distB_;
+    Int height_, width_;
+    bool active_;
+
+    copy::RedistSchedule schedule_;
+    mpi::Comm comm_;
+    vector<T> sendBuf_, recvBuf_;
+    vector<MPI_Request> requests_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTPLAN_HPP
@@ -51,9 +51,17 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad(localHeight*maxLocalWidth);
-                simple_buffer<T,D> buffer((rowStride+1)*portionSize, syncInfoB);
-                T* sendBuf = buffer.data();
-                T* recvBuf = buffer.data() + portionSize;
+
+                // Within a node, pack into our portion of a shared window
+                T* sharedBuf =
+                    util::SharedPortions<T,D>(
+                        A.RowComm(), portionSize, syncInfoB);
+                simple_buffer<T,D> buffer(
+                    sharedBuf ? 0 : (rowStride+1)*portionSize, syncInfoB);
+                T* sendBuf = (sharedBuf ? sharedBuf + A.RowRank()*portionSize
+                                        : buffer.data());
+                T* recvBuf = (sharedBuf ? sharedBuf
+                                        : buffer.data() + portionSize);
 
                 // Pack
                 util::InterleaveMatrix(
@@ -63,9 +71,12 @@ void RowAllGather_impl(const ElementalMatrix<T>& A, ElementalMatrix<T>& B)
                     syncInfoB);
 
                 // Communicate
-                mpi::AllGather(
-                    sendBuf, portionSize, recvBuf, portionSize, A.RowComm(),
-                    syncInfoB);
+                if (sharedBuf)
+                    mpi::SharedWindowSync(A.RowComm());
+                else
+                    mpi::AllGather(
+                        sendBuf, portionSize, recvBuf, portionSize,
+                        A.RowComm(), syncInfoB);
 
                 // Unpack
                 util::RowStridedUnpack(
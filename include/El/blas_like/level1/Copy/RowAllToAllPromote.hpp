@@ -52,9 +52,21 @@ void RowAllToAllPromote
         }
         else
         {
-            simple_buffer<T,D> buffer(2*rowStrideUnion*portionSize, syncInfoB);
-            T* firstBuf  = buffer.data();
-            T* secondBuf = buffer.data() + rowStrideUnion*portionSize;
+            // Within a node, each process packs its portions into its
+            // segment of a shared window, and unpacks the portions meant for
+            // it directly from the segments of the others
+            const Int segmentSize = rowStrideUnion*portionSize;
+            T* sharedBuf =
+              util::SharedPortions<T,D>
+              ( A.PartialUnionRowComm(), segmentSize, syncInfoB );
+            simple_buffer<T,D> buffer
+            ( sharedBuf ? 0 : 2*segmentSize, syncInfoB );
+            const Int rowRankUnion = A.PartialUnionRowRank();
+            T* firstBuf  = ( sharedBuf ? sharedBuf + rowRankUnion*segmentSize
+                                       : buffer.data() );
+            T* secondBuf = ( sharedBuf ? sharedBuf + rowRankUnion*portionSize
+                                       : buffer.data() + segmentSize );
+            const Int recvStride = ( sharedBuf ? segmentSize : portionSize );
 
             // Pack
             util::ColStridedPack(
@@ -64,10 +76,13 @@ void RowAllToAllPromote
                 firstBuf,         portionSize, syncInfoB);
 
             // Simultaneously Gather in rows and Scatter in columns
-            mpi::AllToAll(
-                firstBuf,  portionSize,
-                secondBuf, portionSize, A.PartialUnionRowComm(),
-                syncInfoB);
+            if( sharedBuf )
+                mpi::SharedWindowSync( A.PartialUnionRowComm() );
+            else
+                mpi::AllToAll(
+                    firstBuf,  portionSize,
+                    secondBuf, portionSize, A.PartialUnionRowComm(),
+                    syncInfoB);
 
             // Unpack
             util::PartialRowStridedUnpack(
@@ -75,7 +90,7 @@ void RowAllToAllPromote
                 rowAlign, rowStride,
                 rowStrideUnion, rowStridePart, rowRankPart,
                 B.RowShift(),
-                secondBuf, portionSize,
+                secondBuf, recvStride,
                 B.Buffer(), B.LDim(), syncInfoB);
         }
     }
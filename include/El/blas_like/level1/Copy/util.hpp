@@ -109,40 +109,49 @@ void ColStridedUnpack(
 
 // End of DisableIf overload set
 
+// The CPU kernels run on the stream of the SyncInfo object, if any
+
 template <typename T,
           typename=EnableIf<IsStorageType<T,Device::CPU>>>
 void DeviceStridedMemCopy(
     T* dest, Int destStride,
     const T* source, Int sourceStride, Int numEntries,
-    SyncInfo<Device::CPU>)
+    SyncInfo<Device::CPU> syncInfo)
 {
-    StridedMemCopy(dest, destStride, source, sourceStride, numEntries);
+    RunOnStream(syncInfo, [=]
+    {
+        StridedMemCopy(dest, destStride, source, sourceStride, numEntries);
+    });
 }
 
 template <typename T, typename>
 void InterleaveMatrix(
     Int height, Int width,
     T const* A, Int colStrideA, Int rowStrideA,
-    T* B, Int colStrideB, Int rowStrideB, SyncInfo<Device::CPU>)
+    T* B, Int colStrideB, Int rowStrideB,
+    SyncInfo<Device::CPU> syncInfo)
 {
-    if (colStrideA == 1 && colStrideB == 1)
-    {
-        lapack::Copy('F', height, width, A, rowStrideA, B, rowStrideB);
-    }
-    else
+    RunOnStream(syncInfo, [=]
     {
+        if (colStrideA == 1 && colStrideB == 1)
+        {
+            lapack::Copy('F', height, width, A, rowStrideA, B, rowStrideB);
+        }
+        else
+        {
 #ifdef HYDROGEN_HAVE_MKL
-        mkl::omatcopy(
-            NORMAL, height, width, T(1),
-            A, rowStrideA, colStrideA,
-            B, rowStrideB, colStrideB);
+            mkl::omatcopy(
+                NORMAL, height, width, T(1),
+                A, rowStrideA, colStrideA,
+                B, rowStrideB, colStrideB);
 #else
-        for(Int j=0; j<width; ++j)
-            StridedMemCopy(
-                &B[j*rowStrideB], colStrideB,
-                &A[j*rowStrideA], colStrideA, height);
+            for(Int j=0; j<width; ++j)
+                StridedMemCopy(
+                    &B[j*rowStrideB], colStrideB,
+                    &A[j*rowStrideA], colStrideA, height);
 #endif
-    }
+        }
+    });
 }
 
 template <typename T, typename>
@@ -151,17 +160,20 @@ void RowStridedPack(
     Int rowAlign, Int rowStride,
     T const* A,Int ALDim,
     T* BPortions, Int portionSize,
-    SyncInfo<Device::CPU>)
+    SyncInfo<Device::CPU> syncInfo)
 {
-    for (Int k=0; k<rowStride; ++k)
+    RunOnStream(syncInfo, [=]
     {
-        const Int rowShift = Shift_(k, rowAlign, rowStride);
-        const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
-            &A[rowShift*ALDim],        rowStride*ALDim,
-            &BPortions[k*portionSize], height);
-    }
+        for (Int k=0; k<rowStride; ++k)
+        {
+            const Int rowShift = Shift_(k, rowAlign, rowStride);
+            const Int localWidth = Length_(width, rowShift, rowStride);
+            lapack::Copy(
+                'F', height, localWidth,
+                &A[rowShift*ALDim],        rowStride*ALDim,
+                &BPortions[k*portionSize], height);
+        }
+    });
 }
 
 template <typename T, typename>
@@ -170,17 +182,20 @@ void RowStridedUnpack(
     Int rowAlign, Int rowStride,
     const T* APortions, Int portionSize,
     T* B,         Int BLDim,
-    SyncInfo<Device::CPU>)
+    SyncInfo<Device::CPU> syncInfo)
 {
-    for (Int k=0; k<rowStride; ++k)
+    RunOnStream(syncInfo, [=]
     {
-        const Int rowShift = Shift_(k, rowAlign, rowStride);
-        const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
-            &APortions[k*portionSize], height,
-            &B[rowShift*BLDim],        rowStride*BLDim);
-    }
+        for (Int k=0; k<rowStride; ++k)
+        {
+            const Int rowShift = Shift_(k, rowAlign, rowStride);
+            const Int localWidth = Length_(width, rowShift, rowStride);
+            lapack::Copy(
+                'F', height, localWidth,
+                &APortions[k*portionSize], height,
+                &B[rowShift*BLDim],        rowStride*BLDim);
+        }
+    });
 }
 
 template <typename T, typename>
@@ -191,19 +206,22 @@ void PartialRowStridedPack(
     Int rowShiftA,
     const T* A,         Int ALDim,
     T* BPortions, Int portionSize,
-    SyncInfo<Device::CPU>)
+    SyncInfo<Device::CPU> syncInfo)
 {
-    for (Int k=0; k<rowStrideUnion; ++k)
+    RunOnStream(syncInfo, [=]
     {
-        const Int rowShift =
-            Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
-        const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
-        const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
-            &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-            &BPortions[k*portionSize], height);
-    }
+        for (Int k=0; k<rowStrideUnion; ++k)
+        {
+            const Int rowShift =
+                Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
+            const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
+            const Int localWidth = Length_(width, rowShift, rowStride);
+            lapack::Copy(
+                'F', height, localWidth,
+                &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
+                &BPortions[k*portionSize], height);
+        }
+    });
 }
 
 template <typename T, typename>
@@ -214,19 +232,22 @@ void PartialRowStridedUnpack(
     Int rowShiftB,
     const T* APortions, Int portionSize,
     T* B, Int BLDim,
-    SyncInfo<Device::CPU>)
+    SyncInfo<Device::CPU> syncInfo)
 {
-    for (Int k=0; k<rowStrideUnion; ++k)
+    RunOnStream(syncInfo, [=]
     {
-        const Int rowShift =
-            Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
-        const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
-        const Int localWidth = Length_(width, rowShift, rowStride);
-        lapack::Copy(
-            'F', height, localWidth,
-            &APortions[k*portionSize], height,
-            &B[rowOffset*BLDim],       rowStrideUnion*BLDim);
-    }
+        for (Int k=0; k<rowStrideUnion; ++k)
+        {
+            const Int rowShift =
+                Shift_(rowRankPart+k*rowStridePart, rowAlign, rowStride);
+            const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
+            const Int localWidth = Length_(width, rowShift, rowStride);
+            lapack::Copy(
+                'F', height, localWidth,
+                &APortions[k*portionSize], height,
+                &B[rowOffset*BLDim],       rowStrideUnion*BLDim);
+        }
+    });
 }
 
 #ifdef HYDROGEN_HAVE_CUDA
@@ -11,18 +11,29 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseFill( Matrix<T, Device::CPU>& A, function<T(void)> func )
+// The fill is templated on the callable so that it can be inlined into the
+// loop. Since func is typically stateful (e.g., a random number generator),
+// it is called sequentially in column-major order.
+template<typename T,typename Func>
+void EntrywiseFill( Matrix<T, Device::CPU>& A, Func func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
     for( Int j=0; j<n; ++j )
         for( Int i=0; i<m; ++i )
-            A(i,j) = func();
+            ABuf[i+j*ALDim] = func();
 }
 
-// FIXME: Make proper kernel
+template<typename T>
+void EntrywiseFill( Matrix<T, Device::CPU>& A, function<T(void)> func )
+{ EntrywiseFill<T,function<T(void)>>( A, std::move(func) ); }
+
+// A std::function can only be called on the host, so the entries are
+// generated there and then copied to the device. (Random matrices are
+// instead generated on the device; see src/matrices/random/independent.)
 #ifdef HYDROGEN_HAVE_CUDA
 template <typename T>
 void EntrywiseFill(Matrix<T,Device::GPU> &A, function<T(void)> func)
@@ -34,9 +45,16 @@ void EntrywiseFill(Matrix<T,Device::GPU> &A, function<T(void)> func)
 }
 #endif // HYDROGEN_HAVE_CUDA
 
+template<typename T,typename Func>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Func func )
+{
+    EntrywiseFill<T,Func>
+    ( dynamic_cast<Matrix<T,Device::CPU>&>(A.Matrix()), std::move(func) );
+}
+
 template<typename T>
 void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func )
-{ EntrywiseFill( dynamic_cast<Matrix<T,Device::CPU>&>(A.Matrix()), func ); }
+{ EntrywiseFill<T,function<T(void)>>( A, std::move(func) ); }
 
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
@@ -9,13 +9,64 @@
 #ifndef EL_BLAS_ENTRYWISEMAP_HPP
 #define EL_BLAS_ENTRYWISEMAP_HPP
 
+#if defined(HYDROGEN_HAVE_CUDA) && defined(__CUDACC__)
+#include <hydrogen/blas/gpu/EntrywiseMap.hpp>
+#endif
+
 namespace El {
 
-template<typename T>
-void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
+/** @brief Whether a callable may be applied to GPU matrices by a kernel.
+ *
+ *  Within CUDA translation units, EntrywiseMap applies callables for which
+ *  this trait has been specialized to be true to GPU matrices directly.
+ *  Such callables must be callable on both the host and the device (e.g., a
+ *  functor with a __host__ __device__ call operator); other callables
+ *  cannot be applied to GPU matrices.
+ */
+template<typename Func>
+struct IsDeviceMappable : std::false_type {};
+
+#if defined(HYDROGEN_HAVE_CUDA) && defined(__CUDACC__)
+template<typename S,typename T,typename Func,
+         typename=EnableIf<IsDeviceMappable<Func>>>
+bool TryDeviceEntrywiseMap
+(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, Func func)
+{
+    if (A.GetDevice() != Device::GPU || B.GetDevice() != Device::GPU)
+        return false;
+    auto syncInfoA =
+        SyncInfoFromMatrix(static_cast<const Matrix<S,Device::GPU>&>(A));
+    auto syncInfoB =
+        SyncInfoFromMatrix(static_cast<Matrix<T,Device::GPU>&>(B));
+    // The kernel runs on B's stream once the work pending on A is done
+    auto syncHelper = MakeMultiSync(syncInfoB, syncInfoA);
+    hydrogen::EntrywiseMap_GPU_impl(
+        A.Height(), A.Width(), func,
+        A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim(),
+        syncInfoB.stream_);
+    return true;
+}
+
+template<typename S,typename T,typename Func,
+         typename=DisableIf<IsDeviceMappable<Func>>,typename=void>
+bool TryDeviceEntrywiseMap
+(const AbstractMatrix<S>&, AbstractMatrix<T>&, Func)
+{ return false; }
+#endif // defined(HYDROGEN_HAVE_CUDA) && defined(__CUDACC__)
+
+// The maps are templated on the callable so that it can be inlined into
+// the (parallel, vectorizable) loops; the std::function overloads are thin
+// wrappers which are explicitly instantiated.
+
+template<typename T,typename Func>
+void EntrywiseMap(AbstractMatrix<T>& A, Func func)
 {
     EL_DEBUG_CSE
 
+#if defined(HYDROGEN_HAVE_CUDA) && defined(__CUDACC__)
+    if (TryDeviceEntrywiseMap(A, A, func))
+        return;
+#endif
     if (A.GetDevice() != Device::CPU)
         LogicError("EntrywiseMap not allowed on non-CPU matrices.");
 
@@ -48,22 +99,34 @@ void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
     }
 }
 
+template<typename T>
+void EntrywiseMap(AbstractMatrix<T>& A, function<T(const T&)> func)
+{ EntrywiseMap<T,function<T(const T&)>>(A, func); }
+
+template<typename T,typename Func>
+void EntrywiseMap(AbstractDistMatrix<T>& A, Func func)
+{ EntrywiseMap<T,Func>(A.Matrix(), func); }
+
 template<typename T>
 void EntrywiseMap(AbstractDistMatrix<T>& A, function<T(const T&)> func)
-{ EntrywiseMap(A.Matrix(), func); }
+{ EntrywiseMap<T,function<T(const T&)>>(A.Matrix(), func); }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Func>
 void EntrywiseMap
-(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, function<T(const S&)> func)
+(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, Func func)
 {
     EL_DEBUG_CSE
 
-    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU))
-        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
-
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize(m, n);
+#if defined(HYDROGEN_HAVE_CUDA) && defined(__CUDACC__)
+    if (TryDeviceEntrywiseMap(A, B, func))
+        return;
+#endif
+    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU))
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+
     const S* ABuf = A.LockedBuffer();
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
@@ -79,34 +142,75 @@ void EntrywiseMap
     }
 }
 
+template<typename S,typename T>
+void EntrywiseMap
+(const AbstractMatrix<S>& A, AbstractMatrix<T>& B, function<T(const S&)> func)
+{ EntrywiseMap<S,T,function<T(const S&)>>(A, B, func); }
+
+// Fused map of two inputs: C(i,j) := func(A(i,j),B(i,j))
+template<typename R,typename S,typename T,typename Func>
+void EntrywiseMap
+(const AbstractMatrix<R>& A,
+ const AbstractMatrix<S>& B,
+       AbstractMatrix<T>& C, Func func)
+{
+    EL_DEBUG_CSE
+
+    if ((A.GetDevice() != Device::CPU) || (B.GetDevice() != Device::CPU) ||
+        (C.GetDevice() != Device::CPU))
+        LogicError("EntrywiseMap not allowed on non-CPU matrices.");
+    if (A.Height() != B.Height() || A.Width() != B.Width())
+        LogicError("EntrywiseMap: A and B must be the same size");
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    C.Resize(m, n);
+    const R* ABuf = A.LockedBuffer();
+    const S* BBuf = B.LockedBuffer();
+    T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+    EL_PARALLEL_FOR
+    for(Int j=0; j<n; ++j)
+    {
+        EL_SIMD
+        for(Int i=0; i<m; ++i)
+        {
+            CBuf[i+j*CLDim] = func(ABuf[i+j*ALDim], BBuf[i+j*BLDim]);
+        }
+    }
+}
+
 template <Dist U, Dist V, DistWrap W, Device D, typename S, typename T,
-          typename=EnableIf<IsDeviceValidType<S,D>>>
+          typename Func, typename=EnableIf<IsDeviceValidType<S,D>>>
 void EntrywiseMap_payload(
     AbstractDistMatrix<S> const& A,
     AbstractDistMatrix<T>& B,
-    function<T(const S&)> func)
+    Func func)
 {
     DistMatrix<S,U,V,W,D> AProx(B.Grid());
     AProx.AlignWith(B.DistData());
     Copy(A, AProx);
-    EntrywiseMap(AProx.Matrix(), B.Matrix(), func);
+    EntrywiseMap(AProx.LockedMatrix(), B.Matrix(), func);
 }
 
 template <Dist U, Dist V, DistWrap W, Device D, typename S, typename T,
-          typename=DisableIf<IsDeviceValidType<S,D>>, typename=void>
+          typename Func, typename=DisableIf<IsDeviceValidType<S,D>>,
+          typename=void>
 void EntrywiseMap_payload(
     AbstractDistMatrix<S> const&,
     AbstractDistMatrix<T>&,
-    function<T(const S&)>)
+    Func)
 {
     LogicError("EntrywiseMap: Bad device/type combination.");
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Func>
 void EntrywiseMap
 (const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B,
-        function<T(const S&)> func)
+        Func func)
 {
     if (A.DistData().colDist == B.DistData().colDist &&
         A.DistData().rowDist == B.DistData().rowDist &&
@@ -130,6 +234,79 @@ void EntrywiseMap
     }
 }
 
+template<typename S,typename T>
+void EntrywiseMap
+(const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        function<T(const S&)> func)
+{ EntrywiseMap<S,T,function<T(const S&)>>(A, B, func); }
+
+template <Dist U, Dist V, DistWrap W, Device D,
+          typename R, typename S, typename T, typename Func,
+          typename=EnableIf<And<IsDeviceValidType<R,D>,
+                                IsDeviceValidType<S,D>>>>
+void EntrywiseMap_payload(
+    AbstractDistMatrix<R> const& A,
+    AbstractDistMatrix<S> const& B,
+    AbstractDistMatrix<T>& C,
+    Func func)
+{
+    DistMatrix<R,U,V,W,D> AProx(C.Grid());
+    DistMatrix<S,U,V,W,D> BProx(C.Grid());
+    AProx.AlignWith(C.DistData());
+    BProx.AlignWith(C.DistData());
+    Copy(A, AProx);
+    Copy(B, BProx);
+    EntrywiseMap(AProx.LockedMatrix(), BProx.LockedMatrix(), C.Matrix(), func);
+}
+
+template <Dist U, Dist V, DistWrap W, Device D,
+          typename R, typename S, typename T, typename Func,
+          typename=DisableIf<And<IsDeviceValidType<R,D>,
+                                 IsDeviceValidType<S,D>>>,
+          typename=void>
+void EntrywiseMap_payload(
+    AbstractDistMatrix<R> const&,
+    AbstractDistMatrix<S> const&,
+    AbstractDistMatrix<T>&,
+    Func)
+{
+    LogicError("EntrywiseMap: Bad device/type combination.");
+}
+
+// Fused map of two inputs: C(i,j) := func(A(i,j),B(i,j)). The inputs are
+// only redistributed if they are not already aligned with C.
+template<typename R,typename S,typename T,typename Func>
+void EntrywiseMap
+(const AbstractDistMatrix<R>& A,
+ const AbstractDistMatrix<S>& B,
+       AbstractDistMatrix<T>& C, Func func)
+{
+    EL_DEBUG_CSE
+    if (A.Height() != B.Height() || A.Width() != B.Width())
+        LogicError("EntrywiseMap: A and B must be the same size");
+    if (A.DistData().colDist == C.DistData().colDist &&
+        A.DistData().rowDist == C.DistData().rowDist &&
+        A.Wrap() == C.Wrap())
+        C.AlignWith(A.DistData());
+    C.Resize(A.Height(), A.Width());
+    if (A.DistData() == C.DistData() && B.DistData() == C.DistData())
+    {
+        EntrywiseMap(A.LockedMatrix(), B.LockedMatrix(), C.Matrix(), func);
+    }
+    else
+    {
+        #define GUARD(CDIST,RDIST,WRAP,DEVICE) \
+          C.DistData().colDist == CDIST && C.DistData().rowDist == RDIST && \
+              C.Wrap() == WRAP && C.GetLocalDevice() == DEVICE
+        #define PAYLOAD(CDIST,RDIST,WRAP,DEVICE) \
+            EntrywiseMap_payload<CDIST,RDIST,WRAP,DEVICE>(A,B,C,func);
+        #include <El/macros/DeviceGuardAndPayload.h>
+        #undef GUARD
+        #undef PAYLOAD
+    }
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -11,8 +11,12 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+// The fills are templated on the callable so that it can be inlined into
+// the (parallel, vectorizable) loops; the std::function overloads are thin
+// wrappers which are explicitly instantiated.
+
+template<typename T,typename Func>
+void IndexDependentFill( Matrix<T>& A, Func func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -46,8 +50,11 @@ void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
 }
 
 template<typename T>
-void IndexDependentFill
-( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, func ); }
+
+template<typename T,typename Func>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Func func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -55,16 +62,21 @@ void IndexDependentFill
     T* ALocBuf = A.Buffer();
     const Int ALocLDim = A.LDim();
 
+    // Avoid a virtual call per entry for the global indices
+    vector<Int> globalRows(mLoc);
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    const Int* rowBuf = globalRows.data();
+
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            ALocBuf[iLoc] = func(i,j);
+            ALocBuf[iLoc] = func(rowBuf[iLoc],j);
         }
     }
     else
@@ -72,18 +84,22 @@ void IndexDependentFill
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j);
+                ALocBuf[iLoc+jLoc*ALocLDim] = func(rowBuf[iLoc],j);
             }
         }
     }
 
 }
 
+template<typename T>
+void IndexDependentFill
+( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -11,8 +11,12 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+// The maps are templated on the callable so that it can be inlined into
+// the (parallel, vectorizable) loops; the std::function overloads are thin
+// wrappers which are explicitly instantiated.
+
+template<typename T,typename Func>
+void IndexDependentMap( Matrix<T>& A, Func func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -46,7 +50,11 @@ void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
 }
 
 template<typename T>
-void IndexDependentMap( AbstractMatrix<T>& A, function<T(Int,Int,const T&)> func )
+void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename T,typename Func>
+void IndexDependentMap( AbstractMatrix<T>& A, Func func )
 {
     switch(A.GetDevice()) {
     case Device::CPU:
@@ -64,8 +72,12 @@ void IndexDependentMap( AbstractMatrix<T>& A, function<T(Int,Int,const T&)> func
 }
 
 template<typename T>
+void IndexDependentMap( AbstractMatrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename T,typename Func>
 void IndexDependentMap
-( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+( AbstractDistMatrix<T>& A, Func func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
@@ -73,15 +85,21 @@ void IndexDependentMap
     T* ALocBuf = A.Buffer();
     const Int ALocLDim = A.LDim();
 
+    // Avoid a virtual call per entry for the global indices
+    vector<Int> globalRows(mLoc);
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    const Int* rowBuf = globalRows.data();
+
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
+            const Int i = rowBuf[iLoc];
             ALocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
         }
     }
@@ -90,11 +108,11 @@ void IndexDependentMap
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
+                const Int i = rowBuf[iLoc];
                 ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
             }
         }
@@ -102,15 +120,20 @@ void IndexDependentMap
 
 }
 
-template<typename S,typename T>
+template<typename T>
 void IndexDependentMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename S,typename T,typename Func>
+void IndexDependentMap
+( const Matrix<S>& A, Matrix<T>& B, Func func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize( m, n );
-    const T* ABuf = A.LockedBuffer();
+    const S* ABuf = A.LockedBuffer();
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
@@ -140,31 +163,42 @@ void IndexDependentMap
 
 }
 
-template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+template<typename S,typename T>
+void IndexDependentMap
+( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,function<T(Int,Int,const S&)>>( A, B, func ); }
+
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,typename Func>
 void IndexDependentMap
 ( const DistMatrix<S,U,V,wrap>& A,
         DistMatrix<T,U,V,wrap>& B,
-  function<T(Int,Int,const S&)> func )
+  Func func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
     const Int nLoc = A.LocalWidth();
     B.AlignWith( A.DistData() );
     B.Resize( A.Height(), A.Width() );
-    const T* ALocBuf = A.LockedBuffer();
+    const S* ALocBuf = A.LockedBuffer();
     T* BLocBuf = B.Buffer();
     const Int ALocLDim = A.LDim();
     const Int BLocLDim = B.LDim();
 
+    // Avoid a virtual call per entry for the global indices
+    vector<Int> globalRows(mLoc);
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    const Int* rowBuf = globalRows.data();
+
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
+            const Int i = rowBuf[iLoc];
             BLocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
         }
     }
@@ -173,11 +207,11 @@ void IndexDependentMap
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
+                const Int i = rowBuf[iLoc];
                 BLocBuf[iLoc+jLoc*BLocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
             }
         }
@@ -185,16 +219,23 @@ void IndexDependentMap
 
 }
 
-template<typename S,typename T,Dist U,Dist V>
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+void IndexDependentMap
+( const DistMatrix<S,U,V,wrap>& A,
+        DistMatrix<T,U,V,wrap>& B,
+  function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,U,V,wrap,function<T(Int,Int,const S&)>>( A, B, func ); }
+
+template<typename S,typename T,Dist U,Dist V,typename Func>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V>& B,
-  function<T(Int,Int,const S&)> func )
+  Func func )
 {
     EL_DEBUG_CSE
     if( A.Wrap() == ELEMENT && A.DistData() == B.DistData() )
     {
-        auto& ACast = static_cast<const DistMatrix<T,U,V>&>(A);
+        auto& ACast = static_cast<const DistMatrix<S,U,V>&>(A);
         IndexDependentMap( ACast, B, func );
     }
     else
@@ -216,13 +257,20 @@ void IndexDependentMap
 template<typename S,typename T,Dist U,Dist V>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
-        DistMatrix<T,U,V,BLOCK>& B,
+        DistMatrix<T,U,V>& B,
   function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,U,V,function<T(Int,Int,const S&)>>( A, B, func ); }
+
+template<typename S,typename T,Dist U,Dist V,typename Func>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V,BLOCK>& B,
+  Func func )
 {
     EL_DEBUG_CSE
     if( A.Wrap() == BLOCK && A.DistData() == B.DistData() )
     {
-        auto& ACast = static_cast<const DistMatrix<T,U,V,BLOCK>&>(A);
+        auto& ACast = static_cast<const DistMatrix<S,U,V,BLOCK>&>(A);
         IndexDependentMap( ACast, B, func );
     }
     else
@@ -245,6 +293,13 @@ void IndexDependentMap
     }
 }
 
+template<typename S,typename T,Dist U,Dist V>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V,BLOCK>& B,
+  function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,U,V,function<T(Int,Int,const S&)>>( A, B, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
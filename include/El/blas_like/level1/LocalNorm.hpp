@@ -0,0 +1,496 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_LOCALNORM_HPP
+#define EL_BLAS_LOCALNORM_HPP
+
+namespace El {
+namespace local_norm {
+
+// Blocked kernels for the sums of powers of the magnitudes of the entries of
+// a local matrix, which underlie the Frobenius, entrywise, and column/row
+// two-norms.
+//
+// As in LAPACK's xLASSQ, a sum is kept as scale^p*scaledSum, where 'scale' is
+// the largest magnitude seen so far, so that it neither overflows nor
+// underflows. Rather than rescaling for every entry, the entries are
+// processed in small blocks: the maximum magnitude of a block is found first,
+// and the (vectorizable) sum of the block is then formed with a single
+// reciprocal, so that there is one branch and one division per block. The
+// blocks are combined pairwise-like within independent pieces of the matrix,
+// which are reduced in parallel and then combined in a fixed order, so that
+// the result does not depend upon the number of threads.
+
+// The number of entries rescaled at once
+const Int blockSize = 128;
+// The (maximum) number of entries reduced by each task
+const Int pieceSize = 8192;
+
+template<typename Real>
+struct ScaledSum
+{
+    Real scale=Real(0);
+    Real scaledSum=Real(1);
+};
+
+struct Square
+{
+    template<typename Real>
+    Real operator()( const Real& alpha ) const { return alpha*alpha; }
+};
+
+template<typename Real>
+struct Power
+{
+    Real p;
+    Real operator()( const Real& alpha ) const { return Pow( alpha, p ); }
+};
+
+// Fold 'beta' into 'alpha'. Equal scales are not divided, so that sums
+// with infinite scales combine to infinite sums rather than NaN.
+template<typename Real,typename PowerFunc>
+void Combine
+( ScaledSum<Real>& alpha, const ScaledSum<Real>& beta, const PowerFunc& power )
+{
+    if( beta.scale == Real(0) )
+        return;
+    if( alpha.scale == beta.scale )
+        alpha.scaledSum += beta.scaledSum;
+    else if( alpha.scale < beta.scale )
+    {
+        alpha.scaledSum =
+          alpha.scaledSum*power(alpha.scale/beta.scale) + beta.scaledSum;
+        alpha.scale = beta.scale;
+    }
+    else
+        alpha.scaledSum += beta.scaledSum*power(beta.scale/alpha.scale);
+}
+
+template<typename Real>
+Real Root( const ScaledSum<Real>& alpha, const Square& )
+{ return alpha.scale*Sqrt(alpha.scaledSum); }
+template<typename Real>
+Real Root( const ScaledSum<Real>& alpha, const Power<Real>& power )
+{ return alpha.scale*Pow(alpha.scaledSum,1/power.p); }
+
+// The squared magnitude of a complex number is the sum of the squares of its
+// components, so they are scaled separately and need not be formed
+template<typename Real>
+Real MaxComponent( const Real& alpha ) { return Abs(alpha); }
+template<typename Real>
+Real MaxComponent( const Complex<Real>& alpha )
+{ return Max( Abs(RealPart(alpha)), Abs(ImagPart(alpha)) ); }
+
+template<typename Real>
+Real ScaledSquare( const Real& alpha, const Real& scale )
+{ const Real beta = alpha*scale; return beta*beta; }
+template<typename Real>
+Real ScaledSquare( const Complex<Real>& alpha, const Real& scale )
+{
+    const Real betaReal = RealPart(alpha)*scale;
+    const Real betaImag = ImagPart(alpha)*scale;
+    return betaReal*betaReal + betaImag*betaImag;
+}
+
+// Block kernels
+// =============
+// Blocks with infinite or NaN entries are rare and fall back to the
+// entry-by-entry updates, which propagate them.
+
+// Fold the magnitude of a single entry into 'sum'
+template<typename F,typename PowerFunc>
+void UpdateSum
+( ScaledSum<Base<F>>& sum, const F& alpha, const PowerFunc& power )
+{
+    typedef Base<F> Real;
+    const Real alphaAbs = Abs(alpha);
+    if( alphaAbs != Real(0) )
+        Combine( sum, ScaledSum<Real>{alphaAbs,Real(1)}, power );
+}
+
+// Independent accumulators hide the latency of the reductions and allow
+// them to be vectorized without reassociating the floating-point operations
+const Int numAccumulators = 4;
+
+template<typename F,typename Magnitude>
+Base<F> BlockMax( const F* x, Int n, const Magnitude& magnitude )
+{
+    typedef Base<F> Real;
+    Real maxAbs[numAccumulators];
+    for( Int k=0; k<numAccumulators; ++k )
+        maxAbs[k] = Real(0);
+    Int i=0;
+    for( ; i+numAccumulators<=n; i+=numAccumulators )
+    {
+        for( Int k=0; k<numAccumulators; ++k )
+        {
+            const Real alpha = magnitude(x[i+k]);
+            maxAbs[k] = ( alpha > maxAbs[k] ? alpha : maxAbs[k] );
+        }
+    }
+    for( ; i<n; ++i )
+    {
+        const Real alpha = magnitude(x[i]);
+        maxAbs[0] = ( alpha > maxAbs[0] ? alpha : maxAbs[0] );
+    }
+    for( Int k=1; k<numAccumulators; ++k )
+        maxAbs[0] = Max( maxAbs[0], maxAbs[k] );
+    return maxAbs[0];
+}
+
+template<typename F,typename Term>
+Base<F> BlockSum( const F* x, Int n, const Term& term )
+{
+    typedef Base<F> Real;
+    Real sums[numAccumulators];
+    for( Int k=0; k<numAccumulators; ++k )
+        sums[k] = Real(0);
+    Int i=0;
+    for( ; i+numAccumulators<=n; i+=numAccumulators )
+        for( Int k=0; k<numAccumulators; ++k )
+            sums[k] += term(x[i+k]);
+    for( ; i<n; ++i )
+        sums[0] += term(x[i]);
+    for( Int k=1; k<numAccumulators; ++k )
+        sums[0] += sums[k];
+    return sums[0];
+}
+
+template<typename Real>
+bool HasSafeReciprocal( const Real& alpha )
+{ return alpha >= limits::SafeMin<Real>() && alpha <= limits::Max<Real>(); }
+
+template<typename F>
+ScaledSum<Base<F>> BlockSquares( const F* x, Int n )
+{
+    typedef Base<F> Real;
+    ScaledSum<Real> sum;
+    const Real maxAbs =
+      BlockMax( x, n, []( const F& alpha ) { return MaxComponent(alpha); } );
+    if( !HasSafeReciprocal(maxAbs) )
+    {
+        for( Int k=0; k<n; ++k )
+            UpdateSum( sum, x[k], Square() );
+        return sum;
+    }
+
+    const Real invMaxAbs = Real(1)/maxAbs;
+    sum.scale = maxAbs;
+    sum.scaledSum = BlockSum
+      ( x, n,
+        [=]( const F& alpha ) { return ScaledSquare( alpha, invMaxAbs ); } );
+    return sum;
+}
+
+template<typename F>
+ScaledSum<Base<F>>
+BlockPowers( const F* x, Int n, const Power<Base<F>>& power )
+{
+    typedef Base<F> Real;
+    ScaledSum<Real> sum;
+    const Real maxAbs =
+      BlockMax( x, n, []( const F& alpha ) { return Abs(alpha); } );
+    if( !HasSafeReciprocal(maxAbs) )
+    {
+        for( Int k=0; k<n; ++k )
+            UpdateSum( sum, x[k], power );
+        return sum;
+    }
+
+    const Real invMaxAbs = Real(1)/maxAbs;
+    sum.scale = maxAbs;
+    sum.scaledSum = BlockSum
+      ( x, n,
+        [&]( const F& alpha ) { return power( Abs(alpha)*invMaxAbs ); } );
+    return sum;
+}
+
+struct SquaresKernel
+{
+    Square power;
+
+    template<typename F>
+    ScaledSum<Base<F>> operator()( const F* x, Int n ) const
+    { return BlockSquares( x, n ); }
+};
+
+template<typename Real>
+struct PowersKernel
+{
+    Power<Real> power;
+
+    template<typename F>
+    ScaledSum<Real> operator()( const F* x, Int n ) const
+    { return BlockPowers( x, n, power ); }
+};
+
+// Contiguous vectors and matrices
+// ===============================
+template<typename F,typename Kernel>
+ScaledSum<Base<F>> VectorSum( const F* x, Int n, const Kernel& kernel )
+{
+    ScaledSum<Base<F>> sum;
+    for( Int i=0; i<n; i+=blockSize )
+        Combine( sum, kernel( &x[i], Min(blockSize,n-i) ), kernel.power );
+    return sum;
+}
+
+// The height x width matrix is split into pieces of at most pieceSize
+// entries (which are whole columns, or parts of a single column), which are
+// summed in parallel
+template<typename F,typename Kernel>
+ScaledSum<Base<F>> MatrixSum
+( const F* A, Int height, Int width, Int ldim, const Kernel& kernel )
+{
+    typedef Base<F> Real;
+    if( height == 0 || width == 0 )
+        return ScaledSum<Real>();
+    if( ldim == height && width > 1 )
+        return MatrixSum( A, height*width, 1, height*width, kernel );
+
+    const Int piecesPerCol = (height+pieceSize-1)/pieceSize;
+    const Int pieceHeight = (height+piecesPerCol-1)/piecesPerCol;
+    const Int numPieces = piecesPerCol*width;
+    if( numPieces == 1 )
+        return VectorSum( A, height, kernel );
+
+    vector<ScaledSum<Real>> sums(numPieces);
+    EL_PARALLEL_FOR
+    for( Int piece=0; piece<numPieces; ++piece )
+    {
+        const Int j = piece / piecesPerCol;
+        const Int i = (piece % piecesPerCol)*pieceHeight;
+        sums[piece] =
+          VectorSum( &A[i+j*ldim], Min(pieceHeight,height-i), kernel );
+    }
+
+    ScaledSum<Real> sum;
+    for( Int piece=0; piece<numPieces; ++piece )
+        Combine( sum, sums[piece], kernel.power );
+    return sum;
+}
+
+// The sums of each of the columns of a height x width matrix
+template<typename F,typename Kernel>
+void ColumnSums
+( const F* A, Int height, Int width, Int ldim, const Kernel& kernel,
+  ScaledSum<Base<F>>* sums )
+{
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+        sums[j] = VectorSum( &A[j*ldim], height, kernel );
+}
+
+// The sums of squares of each of the rows of a height x width matrix. Each
+// block of columns is traversed twice, once for the maximum magnitude of
+// each row and once for the scaled sums, both vectorizing over the rows; the
+// rows are split into panels which are processed in parallel.
+template<typename F>
+void RowSquares
+( const F* A, Int height, Int width, Int ldim, ScaledSum<Base<F>>* sums )
+{
+    typedef Base<F> Real;
+    const Int panelHeight = blockSize;
+    const Int blockWidth = 8;
+    const Int numPanels = (height+panelHeight-1)/panelHeight;
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real realMax = limits::Max<Real>();
+
+    EL_PARALLEL_FOR
+    for( Int panel=0; panel<numPanels; ++panel )
+    {
+        const Int iBeg = panel*panelHeight;
+        const Int mPanel = Min(panelHeight,height-iBeg);
+        Real scales[panelHeight], scaledSums[panelHeight];
+        Real blockMaxs[panelHeight], invScales[panelHeight];
+        bool safeRows[panelHeight];
+        for( Int i=0; i<mPanel; ++i )
+        {
+            scales[i] = Real(0);
+            scaledSums[i] = Real(1);
+        }
+
+        for( Int jBeg=0; jBeg<width; jBeg+=blockWidth )
+        {
+            const Int nBlock = Min(blockWidth,width-jBeg);
+            const F* ABlock = &A[iBeg+jBeg*ldim];
+
+            for( Int i=0; i<mPanel; ++i )
+                blockMaxs[i] = scales[i];
+            for( Int j=0; j<nBlock; ++j )
+            {
+                const F* col = &ABlock[j*ldim];
+                for( Int i=0; i<mPanel; ++i )
+                {
+                    const Real alpha = MaxComponent(col[i]);
+                    blockMaxs[i] = ( alpha > blockMaxs[i] ? alpha :
+                                                            blockMaxs[i] );
+                }
+            }
+
+            // Rows whose new scale has no safe reciprocal (e.g., it is
+            // infinite) are updated entry by entry
+            bool allSafe = true;
+            for( Int i=0; i<mPanel; ++i )
+            {
+                const Real newScale = blockMaxs[i];
+                safeRows[i] = newScale == Real(0) ||
+                  (newScale >= safeMin && newScale <= realMax);
+                allSafe = allSafe && safeRows[i];
+                if( !safeRows[i] || newScale == Real(0) )
+                {
+                    invScales[i] = Real(0);
+                    continue;
+                }
+                const Real relScale = scales[i]/newScale;
+                scaledSums[i] *= relScale*relScale;
+                scales[i] = newScale;
+                invScales[i] = Real(1)/newScale;
+            }
+
+            for( Int j=0; j<nBlock; ++j )
+            {
+                const F* col = &ABlock[j*ldim];
+                if( allSafe )
+                {
+                    for( Int i=0; i<mPanel; ++i )
+                        scaledSums[i] += ScaledSquare( col[i], invScales[i] );
+                }
+                else
+                {
+                    for( Int i=0; i<mPanel; ++i )
+                    {
+                        if( safeRows[i] )
+                            scaledSums[i] +=
+                              ScaledSquare( col[i], invScales[i] );
+                        else
+                        {
+                            ScaledSum<Real> sum{ scales[i], scaledSums[i] };
+                            UpdateSum( sum, col[i], Square() );
+                            scales[i] = sum.scale;
+                            scaledSums[i] = sum.scaledSum;
+                        }
+                    }
+                }
+            }
+        }
+
+        for( Int i=0; i<mPanel; ++i )
+        {
+            sums[iBeg+i].scale = scales[i];
+            sums[iBeg+i].scaledSum = scaledSums[i];
+        }
+    }
+}
+
+// Combining the sums of many processes
+// =====================================
+// The (scale,scaledSum) pairs of any number of sums are reduced at once as
+// Complex<Real> values with a user-defined operation, so that a single
+// AllReduce suffices. The user-defined operations are not registered for
+// half-precision types, whose scales are instead agreed upon first.
+template<typename Real>
+struct HasPairReduction : std::true_type {};
+#ifdef HYDROGEN_HAVE_HALF
+template<>
+struct HasPairReduction<cpu_half_type> : std::false_type {};
+#endif
+#ifdef HYDROGEN_GPU_USE_FP16
+template<>
+struct HasPairReduction<gpu_half_type> : std::false_type {};
+#endif
+
+template<typename Real,typename PowerFunc,
+         typename=EnableIf<HasPairReduction<Real>>>
+void AllReduce
+( vector<ScaledSum<Real>>& sums, const PowerFunc& power,
+  mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    const Int numSums = sums.size();
+    vector<Complex<Real>> pairs(numSums);
+    for( Int k=0; k<numSums; ++k )
+        pairs[k] = Complex<Real>( sums[k].scale, sums[k].scaledSum );
+
+    auto combine =
+      [power]( const Complex<Real>& alpha, const Complex<Real>& beta )
+      {
+          ScaledSum<Real> gamma{ RealPart(alpha), ImagPart(alpha) };
+          Combine
+          ( gamma, ScaledSum<Real>{ RealPart(beta), ImagPart(beta) }, power );
+          return Complex<Real>( gamma.scale, gamma.scaledSum );
+      };
+    mpi::SetUserReduceFunc
+    ( std::function<Complex<Real>(const Complex<Real>&,
+                                  const Complex<Real>&)>(combine) );
+    mpi::AllReduce
+    ( pairs.data(), numSums, mpi::UserCommOp<Complex<Real>>(), comm,
+      SyncInfo<Device::CPU>{} );
+
+    for( Int k=0; k<numSums; ++k )
+    {
+        sums[k].scale = RealPart(pairs[k]);
+        sums[k].scaledSum = ImagPart(pairs[k]);
+    }
+}
+
+template<typename Real,typename PowerFunc,
+         typename=DisableIf<HasPairReduction<Real>>,typename=void>
+void AllReduce
+( vector<ScaledSum<Real>>& sums, const PowerFunc& power,
+  mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    const Int numSums = sums.size();
+    vector<Real> scales(numSums), scaledSums(numSums);
+    for( Int k=0; k<numSums; ++k )
+        scales[k] = sums[k].scale;
+    mpi::AllReduce
+    ( scales.data(), numSums, mpi::MAX, comm, SyncInfo<Device::CPU>{} );
+
+    // Equilibrate the local sums to the maximum scales
+    for( Int k=0; k<numSums; ++k )
+    {
+        if( sums[k].scale == Real(0) )
+            scaledSums[k] = Real(0);
+        else if( sums[k].scale == scales[k] )
+            scaledSums[k] = sums[k].scaledSum;
+        else
+            scaledSums[k] = sums[k].scaledSum*power(sums[k].scale/scales[k]);
+    }
+    mpi::AllReduce
+    ( scaledSums.data(), numSums, comm, SyncInfo<Device::CPU>{} );
+
+    for( Int k=0; k<numSums; ++k )
+    {
+        sums[k].scale = scales[k];
+        sums[k].scaledSum = scaledSums[k];
+    }
+}
+
+// Convenience wrappers
+// ====================
+template<typename F>
+ScaledSum<Base<F>> Squares( const Matrix<F>& A )
+{
+    return MatrixSum
+    ( A.LockedBuffer(), A.Height(), A.Width(), A.LDim(), SquaresKernel() );
+}
+
+template<typename F>
+ScaledSum<Base<F>> Powers( const Matrix<F>& A, Base<F> p )
+{
+    PowersKernel<Base<F>> kernel{ Power<Base<F>>{p} };
+    return MatrixSum
+    ( A.LockedBuffer(), A.Height(), A.Width(), A.LDim(), kernel );
+}
+
+} // namespace local_norm
+} // namespace El
+
+#endif // ifndef EL_BLAS_LOCALNORM_HPP
@@ -76,6 +76,30 @@ void AllReduce( Matrix<T,D>& A, mpi::Comm const& comm, mpi::Op op=mpi::SUM );
 template<typename T>
 void AllReduce( AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op=mpi::SUM );
 
+// Non-blocking variants; A may not be accessed until the returned request
+// has been waited upon (which its destructor also does). The reduction
+// always goes through MPI rather than Aluminum. When device buffers must be
+// staged through the host (HYDROGEN_ENSURE_HOST_MPI_BUFFERS), a GPU matrix
+// is instead reduced before the call returns, and waiting on the request
+// only unpacks the result.
+template<typename T>
+class AllReduceRequest;
+
+template<typename T>
+AllReduceRequest<T>
+AllReduceAsync( AbstractMatrix<T>& A, mpi::Comm const& comm, mpi::Op op=mpi::SUM );
+template<typename T, Device D, typename=EnableIf<IsDeviceValidType<T,D>>>
+AllReduceRequest<T>
+AllReduceAsync( Matrix<T,D>& A, mpi::Comm const& comm, mpi::Op op=mpi::SUM );
+template<typename T, Device D,
+         typename=DisableIf<IsDeviceValidType<T,D>>,typename=void>
+AllReduceRequest<T>
+AllReduceAsync( Matrix<T,D>& A, mpi::Comm const& comm, mpi::Op op=mpi::SUM );
+template<typename T>
+AllReduceRequest<T>
+AllReduceAsync
+( AbstractDistMatrix<T>& A, mpi::Comm const& comm, mpi::Op op=mpi::SUM );
+
 // Axpy
 // ====
 template<typename Ring1,typename Ring2>
@@ -663,6 +687,21 @@ void StridedUnpack(
     T* B, Int BLDim,
     SyncInfo<D> );
 
+// Returns the node-local shared window of comm (see mpi::SharedWindow) with
+// room for portionSize entries per process if the redistribution may go
+// through it, and nullptr otherwise. Only host data of trivially copyable
+// types is shared, and only when its kernels run synchronously, since the
+// processes read each other's portions right after the window is synced.
+template <typename T, Device D>
+T* SharedPortions(
+    mpi::Comm const& comm, Int portionSize, SyncInfo<D> const& syncInfo)
+{
+    if (D != Device::CPU || !std::is_trivially_copyable<T>::value
+        || !IsHostSynchronous(syncInfo))
+        return nullptr;
+    return reinterpret_cast<T*>(
+        mpi::SharedWindow(comm, portionSize*sizeof(T)));
+}
 
 } // namespace util
 } // namespace copy
@@ -784,6 +823,12 @@ T Dotu( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B );
 
 // EntrywiseFill
 // =============
+// The overloads templated on the callable avoid an indirect call per entry
+template<typename T,typename Func>
+void EntrywiseFill( Matrix<T>& A, Func func );
+template<typename T,typename Func>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Func func );
+
 template<typename T>
 void EntrywiseFill( Matrix<T>& A, function<T(void)> func );
 template<typename T>
@@ -795,6 +840,27 @@ void EntrywiseFill( Matrix<T,Device::GPU>& A, function<T(void)> func );
 
 // EntrywiseMap
 // ============
+// The overloads templated on the callable avoid an indirect call per entry
+template<typename T,typename Func>
+void EntrywiseMap( AbstractMatrix<T>& A, Func func );
+template<typename T,typename Func>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Func func );
+template<typename S,typename T,typename Func>
+void EntrywiseMap( const AbstractMatrix<S>& A, AbstractMatrix<T>& B, Func func );
+template<typename S,typename T,typename Func>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B, Func func );
+
+// Fused maps of two inputs, C(i,j) := func(A(i,j),B(i,j))
+template<typename R,typename S,typename T,typename Func>
+void EntrywiseMap
+( const AbstractMatrix<R>& A, const AbstractMatrix<S>& B,
+        AbstractMatrix<T>& C, Func func );
+template<typename R,typename S,typename T,typename Func>
+void EntrywiseMap
+( const AbstractDistMatrix<R>& A, const AbstractDistMatrix<S>& B,
+        AbstractDistMatrix<T>& C, Func func );
+
 template<typename T>
 void EntrywiseMap( AbstractMatrix<T>& A, function<T(const T&)> func );
 template<typename T>
@@ -991,6 +1057,12 @@ void ImagPart
 
 // IndexDependentFill
 // ==================
+// The overloads templated on the callable avoid an indirect call per entry
+template<typename T,typename Func>
+void IndexDependentFill( Matrix<T>& A, Func func );
+template<typename T,typename Func>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Func func );
+
 template<typename T>
 void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func );
 template<typename T>
@@ -999,6 +1071,25 @@ void IndexDependentFill
 
 // IndexDependentMap
 // =================
+// The overloads templated on the callable avoid an indirect call per entry
+template<typename T,typename Func>
+void IndexDependentMap( Matrix<T>& A, Func func );
+template<typename T,typename Func>
+void IndexDependentMap( AbstractMatrix<T>& A, Func func );
+template<typename T,typename Func>
+void IndexDependentMap( AbstractDistMatrix<T>& A, Func func );
+template<typename S,typename T,typename Func>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, Func func );
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,typename Func>
+void IndexDependentMap
+( const DistMatrix<S,U,V,wrap>& A, DistMatrix<T,U,V,wrap>& B, Func func );
+template<typename S,typename T,Dist U,Dist V,typename Func>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A, DistMatrix<T,U,V>& B, Func func );
+template<typename S,typename T,Dist U,Dist V,typename Func>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A, DistMatrix<T,U,V,BLOCK>& B, Func func );
+
 template<typename T>
 void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func );
 template<typename T>
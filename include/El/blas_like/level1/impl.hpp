@@ -37,6 +37,7 @@
 #include <El/blas_like/level1/IndexDependentFill.hpp>
 #include <El/blas_like/level1/IndexDependentMap.hpp>
 #include <El/blas_like/level1/Kronecker.hpp>
+#include <El/blas_like/level1/LocalNorm.hpp>
 #include <El/blas_like/level1/MakeReal.hpp>
 #include <El/blas_like/level1/MakeDiagonalReal.hpp>
 #include <El/blas_like/level1/MakeSubmatrixReal.hpp>
@@ -26,11 +26,27 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_AUTO,
+  // Stationary-C SUMMA which overlaps the gathers of the next panel with
+  // the local update of the current one (transposed operands are formed
+  // once up front; GPU matrices fall back to GEMM_SUMMA_C)
+  GEMM_SUMMA_C_PIPELINED
 };
 }
 using namespace GemmAlgorithmNS;
 
+// GEMM_AUTO times the applicable algorithms the first time a problem
+// (orientations, dimensions, distributions, grid shape, blocksize, device
+// and datatype) is encountered and reuses the fastest thereafter. If a
+// tuning file is set, either here or through the HYDROGEN_GEMM_TUNING_FILE
+// environment variable, the choices persist across runs. The root of each
+// grid owns the decisions for that grid; ClearGemmTuningTable only discards
+// the in-memory table, so a tuning file is read again on the next use.
+void SetGemmTuningFile( const string& filename );
+const string& GemmTuningFile();
+void ClearGemmTuningTable();
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -73,6 +89,17 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// 2.5D Gemm: the grid is split into numLayers layers which each form the
+// product over a slice of the summation dimension before the partial
+// products are summed along the depth dimension. This requires numLayers
+// partial copies of C but reduces the panel broadcast volume by a factor of
+// roughly sqrt(numLayers). The number of layers must divide the grid size.
+template<typename T>
+void Gemm25D
+( Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C, Int numLayers );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
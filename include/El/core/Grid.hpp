@@ -95,6 +95,28 @@ public:
 
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
 
+    // Build a grid over 'comm' whose process columns (the MC communicators)
+    // lie within shared-memory nodes, so that column communication avoids
+    // the network. The processes are reordered so that each node (and each
+    // socket within it, where MPI can detect sockets) holds consecutive
+    // ranks, and the height is the divisor of the number of processes per
+    // node which gives the squarest grid. If the nodes hold differing
+    // numbers of processes, the default height is used.
+    static unique_ptr<Grid> NodeAware
+    ( mpi::Comm const& comm, GridOrder order=COLUMN_MAJOR );
+
+    // The communicators which a grid derives from its viewing communicator
+    // are shared with (and reused by) any other grid with the same viewing
+    // processes, owning group, height, and order, and are freed along with
+    // the last grid using them. Grids created while caching is disabled
+    // derive communicators of their own, e.g., so that they may communicate
+    // concurrently with another grid over the same processes. Caching must
+    // be enabled or disabled on every process at once.
+    static void SetCommCaching( bool enable );
+    static bool CommCaching();
+    // The number of distinct sets of cached communicators on this process
+    static size_t NumCachedComms();
+
     // To be used internally by Elemental
     static void InitializeDefault();
     static void InitializeTrivial();
@@ -118,12 +140,13 @@ private:
     mpi::Group viewingGroup_,
                owningGroup_;
 
-    mpi::Comm viewingComm_,
-              owningComm_,
-              cartComm_,
-              mcComm_, mrComm_,
-              mdComm_, mdPerpComm_,
-              vcComm_, vrComm_;
+    mpi::Comm viewingComm_;
+
+    // The (possibly cached) owning, cartesian, MC, MR, MD, MDPerp, VC and VR
+    // communicators
+    struct Comms;
+    class CommCache;
+    shared_ptr<const Comms> comms_;
 
     int viewingRank_,
         owningRank_,
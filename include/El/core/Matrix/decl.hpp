@@ -175,6 +175,23 @@ public:
     void SetMemoryMode(memory_mode_type mode) override;
     memory_mode_type MemoryMode() const EL_NO_EXCEPT override;
 
+    ///@}
+    /** @name Synchronization semantics */
+    ///@{
+
+    /** @brief The CPU stream on which kernels acting on this matrix
+     *         are enqueued.
+     *
+     *  This is null by default, in which case kernels run
+     *  synchronously. Otherwise, the data must not be accessed
+     *  directly until the stream has been synchronized.
+     */
+    cpuStream_t Stream() const EL_NO_EXCEPT;
+    cpuEvent_t Event() const EL_NO_EXCEPT;
+
+    void SetStream(cpuStream_t stream) EL_NO_EXCEPT;
+    void SetEvent(cpuEvent_t event) EL_NO_EXCEPT;
+
     ///@}
 
     // Single-entry manipulation
@@ -274,6 +291,9 @@ private:
     // Const-correctness is internally managed to avoid the need for storing
     // two separate pointers with different 'const' attributes
     T* data_ = nullptr;
+
+    cpuStream_t stream_ = nullptr;
+    cpuEvent_t event_ = nullptr;
 };
 
 template <typename T, Device D>
@@ -283,7 +303,27 @@ void SetSyncInfo(Matrix<T,D>&, SyncInfo<D> const&)
 template <typename T>
 SyncInfo<Device::CPU> SyncInfoFromMatrix(Matrix<T,Device::CPU> const& mat)
 {
-    return SyncInfo<Device::CPU>{};
+    return SyncInfo<Device::CPU>{mat.Stream(), mat.Event()};
+}
+
+template <typename T>
+void SetSyncInfo(
+    Matrix<T,Device::CPU>& mat, SyncInfo<Device::CPU> const& syncInfo)
+{
+    if (syncInfo.stream_ != nullptr)
+        mat.SetStream(syncInfo.stream_);
+    if (syncInfo.event_ != nullptr)
+        mat.SetEvent(syncInfo.event_);
+}
+
+/** @brief Give a view the stream and event of the matrix it views, so
+ *         that kernels on the view are ordered with those on the source.
+ */
+template <typename T, Device D>
+void ShareSyncInfo(Matrix<T,D>& view, Matrix<T,D> const& source)
+{
+    view.SetStream(source.Stream());
+    view.SetEvent(source.Event());
 }
 
 #ifdef HYDROGEN_HAVE_CUDA
@@ -77,7 +77,8 @@ Matrix<T, Device::CPU>::Matrix(Matrix<T, Device::GPU> const& A)
 template <typename T>
 Matrix<T, Device::CPU>::Matrix(Matrix<T, Device::CPU>&& A) EL_NO_EXCEPT
     : AbstractMatrix<T>(std::move(A)),
-    memory_{std::move(A.memory_)}, data_{A.data_}
+    memory_{std::move(A.memory_)}, data_{A.data_},
+    stream_{A.stream_}, event_{A.event_}
 {
     A.data_ = nullptr;
 }
@@ -277,6 +278,36 @@ auto Matrix<T, Device::CPU>::MemoryMode() const EL_NO_EXCEPT
     -> memory_mode_type
 { return memory_.Mode(); }
 
+// Synchronization semantics
+// =========================
+
+template <typename T>
+cpuStream_t Matrix<T, Device::CPU>::Stream() const EL_NO_EXCEPT
+{
+    return stream_;
+}
+
+template <typename T>
+cpuEvent_t Matrix<T, Device::CPU>::Event() const EL_NO_EXCEPT
+{
+    return event_;
+}
+
+template <typename T>
+void Matrix<T, Device::CPU>::SetStream(cpuStream_t stream) EL_NO_EXCEPT
+{
+    stream_ = stream;
+    // Deallocation waits for the kernels that may still use the buffer
+    memory_.ResetSyncInfo(SyncInfo<Device::CPU>{stream_, event_});
+}
+
+template <typename T>
+void Matrix<T, Device::CPU>::SetEvent(cpuEvent_t event) EL_NO_EXCEPT
+{
+    event_ = event;
+    memory_.ResetSyncInfo(SyncInfo<Device::CPU>{stream_, event_});
+}
+
 // Single-entry manipulation
 // =========================
 
@@ -535,6 +566,8 @@ void Matrix<T, Device::CPU>::SwapImpl_(
     EL_DEBUG_CSE;
     memory_.ShallowSwap(A.memory_);
     std::swap(data_, A.data_);
+    std::swap(stream_, A.stream_);
+    std::swap(event_, A.event_);
 }
 
 template <typename T>
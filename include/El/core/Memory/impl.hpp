@@ -64,8 +64,11 @@ G* New(size_t size, unsigned int mode, SyncInfo<Device::CPU> const&)
 }
 
 template <typename G>
-void Delete( G*& ptr, unsigned int mode, SyncInfo<Device::CPU> const& )
+void Delete( G*& ptr, unsigned int mode, SyncInfo<Device::CPU> const& syncInfo )
 {
+    // Kernels enqueued on a CPU stream may still be using the buffer. This
+    // runs in destructors, so their errors are left to the next Synchronize.
+    SynchronizeNoThrow(syncInfo);
     switch (mode) {
     case 0: HostMemoryPool().Free(ptr); break;
 #ifdef HYDROGEN_HAVE_CUDA
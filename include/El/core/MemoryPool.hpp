@@ -2,12 +2,18 @@
 #define HYDROGEN_MEMORYPOOL_HPP_
 
 #include <stddef.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <sstream>
 #include <stdexcept>
 #include <vector>
-#include <set>
-#include <unordered_map>
-#include <mutex>
 
 #include "El/hydrogen_config.h"
 #ifdef HYDROGEN_HAVE_CUDA
@@ -26,14 +32,94 @@ void ThrowRuntimeError(Args&&... args)
     (void) dummy;
     throw std::runtime_error(oss.str());
 }
-}
 
-/** Simple caching memory pool.
+/** Registration of the live memory pools.
+ *  Each pool is given an identifier which is never reused, so that the
+ *  thread-local caches of a thread which outlives a pool (or a pool which
+ *  outlives a thread) can be told apart safely.
+ */
+size_t RegisterMemoryPool();
+void DeregisterMemoryPool(size_t id);
+/** Held while a thread flushes its caches into a pool at thread exit. */
+std::mutex& MemoryPoolRegistryMutex();
+/** Must be called while holding MemoryPoolRegistryMutex. */
+bool MemoryPoolIsLive(size_t id);
+
+/** Parse a nonnegative byte count, as given in environment variables.
+ *  Returns false, leaving bytes untouched, unless the whole string is a
+ *  decimal integer which fits in a size_t.
+ */
+bool ParseByteCount(char const* str, size_t& bytes);
+
+}  // namespace details
+
+/** Usage counters of a single bin of a MemoryPool. */
+struct MemoryPoolBinStatistics
+{
+    /** Size in bytes of the blocks of this bin. */
+    size_t size = 0;
+    /** Allocations served from cached blocks. */
+    size_t hits = 0;
+    /** Allocations which required a new block. */
+    size_t misses = 0;
+};
+
+/** A snapshot of the usage of a MemoryPool. */
+struct MemoryPoolStatistics
+{
+    /** Bytes held by outstanding allocations, including bin rounding. */
+    size_t bytes_in_use = 0;
+    /** Bytes requested by outstanding allocations. */
+    size_t bytes_requested = 0;
+    /** High-water mark of bytes_in_use. */
+    size_t peak_bytes_in_use = 0;
+    /** Bytes held in freed blocks awaiting reuse. */
+    size_t bytes_cached = 0;
+    /** Cap on bytes_cached (beyond which cached blocks are released). */
+    size_t max_cached_bytes = 0;
+    /** Bytes of cached blocks released by trimming. */
+    size_t bytes_trimmed = 0;
+    /** Allocations too large for any bin. */
+    size_t uncached_allocations = 0;
+    std::vector<MemoryPoolBinStatistics> bins;
+
+    /** Fraction of bytes_in_use lost to rounding requests up to bins. */
+    double FragmentationRatio() const
+    {
+        return bytes_in_use == 0
+            ? 0.
+            : 1. - double(bytes_requested) / double(bytes_in_use);
+    }
+};
+
+/** Thread-caching memory pool.
  *  This maintains a set of bins that contain allocations of a fixed size.
  *  Each allocation will use the smallest size greater than or equal to the
  *  requested size. If an allocation is larger than any bin, it is allocated
  *  and freed directly.
- *  This memory pool is thread-safe.
+ *
+ *  Each allocation is preceded by a small header which records its bin and
+ *  a liveness tag, which is set while the block is handed out, so that
+ *  freeing a pointer twice, or one this pool did not hand out, is detected
+ *  without any shared bookkeeping. Freed blocks are first kept in a free
+ *  list for the freeing thread; once a thread caches more than
+ *  max_thread_cached blocks of a bin, they are returned in a single batch to
+ *  a global depot, which is a lock-free stack per bin. A thread whose free
+ *  list is empty takes the whole depot stack at once, keeps up to
+ *  max_thread_cached blocks, and pushes the remainder back. Since blocks are
+ *  only ever taken from the depot by exchanging the stack head, the depot
+ *  does not suffer from the ABA problem.
+ *
+ *  Each thread's cache is guarded by its own mutex, which only its owner
+ *  takes on the fast path, so that FreeAllUnused and trimming can drain the
+ *  caches of every thread. The cache of an exiting thread is returned to the
+ *  depot and discarded.
+ *
+ *  The bytes held in cached blocks can be capped with SetMaxCachedBytes.
+ *  Once the cap is exceeded, cached blocks of every thread are released
+ *  until a quarter below the cap, starting with the least recently used
+ *  bins, where a bin is used whenever a thread needs a block which its own
+ *  cache cannot provide.
  *  @tparam Pinned Whether this pool allocates CUDA pinned memory.
  */
 template <bool Pinned>
@@ -47,11 +133,25 @@ public:
      *  @param bin_growth Controls how fast bins grow.
      *  @param min_bin_size Smallest bin size (in bytes).
      *  @param max_bin_size Largest bin size (in bytes).
+     *  @param max_thread_cached Number of blocks per bin a thread may cache
+     *         before returning them to the global depot.
+     *  @param alignment Alignment (in bytes) of every allocation; must be a
+     *         power of two.
      */
     MemoryPool(float bin_growth = 1.6,
                size_t min_bin_size = 1,
-               size_t max_bin_size = 1<<26)
+               size_t max_bin_size = 1<<26,
+               size_t max_thread_cached = 16,
+               size_t alignment = 64)
+        : id_(details::RegisterMemoryPool()),
+          max_thread_cached_(max_thread_cached),
+          alignment_(std::max(alignment, alignof(Header)))
     {
+        if ((alignment_ & (alignment_ - 1)) != 0)
+            details::ThrowRuntimeError(
+                "MemoryPool alignment must be a power of two, not ",
+                alignment);
+        max_cached_bytes_.store((size_t) -1, std::memory_order_relaxed);
         std::set<size_t> bin_sizes;
         for (float bin_size = min_bin_size;
              bin_size <= max_bin_size;
@@ -68,112 +168,520 @@ public:
         // Copy into bin_sizes_.
         for (const auto& size : bin_sizes)
             bin_sizes_.push_back(size);
-        // Set up bins.
-        for (size_t i = 0; i < bin_sizes_.size(); ++i)
-            free_data_.emplace_back();
+        // Set up the depot.
+        depot_.reset(new std::atomic<Header*>[bin_sizes_.size()]);
+        last_use_.reset(new std::atomic<size_t>[bin_sizes_.size()]);
+        for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+        {
+            depot_[bin].store(nullptr, std::memory_order_relaxed);
+            last_use_[bin].store(0, std::memory_order_relaxed);
+        }
+        retired_hits_.resize(bin_sizes_.size(), 0);
+        retired_misses_.resize(bin_sizes_.size(), 0);
     }
     ~MemoryPool()
     {
-        FreeAllUnused();
+        // After deregistration, exiting threads no longer touch the caches.
+        details::DeregisterMemoryPool(id_);
+        for (auto& cache : caches_)
+            free_cache(*cache);
+        free_depot();
     }
 
     /** Return memory of size bytes. */
     void* Allocate(size_t size)
     {
-        size_t bin = get_bin(size);
-        void* mem = nullptr;
-        std::lock_guard<std::mutex> lock(mutex_);
+        const size_t bin = get_bin(size);
+        Header* header = nullptr;
         // size is too large, this will not be cached.
         if (bin == INVALID_BIN)
         {
-            mem = do_allocation(size);
+            header = new_block(size);
+            uncached_allocations_.fetch_add(1, std::memory_order_relaxed);
         }
         else
         {
-            // Check if there is available memory in our bin.
-            if (free_data_[bin].size() > 0)
+            ThreadCache& cache = thread_cache();
             {
-                mem = free_data_[bin].back();
-                free_data_[bin].pop_back();
+                std::lock_guard<std::mutex> lock(cache.mutex);
+                header = cache.heads[bin];
+                if (header != nullptr)
+                {
+                    cache.heads[bin] = header->next;
+                    --cache.counts[bin];
+                }
+                else
+                {
+                    last_use_[bin].store(
+                        clock_.fetch_add(1, std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+                    header = refill(cache, bin);
+                }
+                if (header != nullptr)
+                    increment(cache.hits[bin]);
+                else
+                    increment(cache.misses[bin]);
             }
+            if (header != nullptr)
+                bytes_cached_.fetch_sub(
+                    bin_sizes_[bin], std::memory_order_relaxed);
             else
-            {
-                mem = do_allocation(bin_sizes_[bin]);
-            }
+                header = new_block(bin_sizes_[bin]);
         }
-        alloc_to_bin_[mem] = bin;
-        return mem;
+        header->next = nullptr;
+        header->bin = bin;
+        header->size = size;
+        header->tag = live_tag();
+        add_in_use(bin == INVALID_BIN ? size : bin_sizes_[bin], size);
+        return user_pointer(header);
     }
     /** Release previously allocated memory. */
     void Free(void* ptr)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto iter = alloc_to_bin_.find(ptr);
-        if (iter == alloc_to_bin_.end())
-        {
+        if (ptr == nullptr)
+            details::ThrowRuntimeError("Tried to free unknown ptr");
+        Header* header = reinterpret_cast<Header*>(
+            static_cast<char*>(ptr) - sizeof(Header));
+        if (header->tag != live_tag())
             details::ThrowRuntimeError("Tried to free unknown ptr");
+        header->tag = 0;
+
+        const size_t bin = header->bin;
+        bytes_in_use_.fetch_sub(
+            bin == INVALID_BIN ? header->size : bin_sizes_[bin],
+            std::memory_order_relaxed);
+        bytes_requested_.fetch_sub(header->size, std::memory_order_relaxed);
+        if (bin == INVALID_BIN)
+        {
+            do_free(header->raw);
+            return;
         }
-        else
+
+        // Cache the pointer for reuse.
+        ThreadCache& cache = thread_cache();
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            header->next = cache.heads[bin];
+            cache.heads[bin] = header;
+            if (++cache.counts[bin] > max_thread_cached_)
+                flush(cache, bin);
+        }
+        const size_t cached = bytes_cached_.fetch_add(
+            bin_sizes_[bin], std::memory_order_relaxed) + bin_sizes_[bin];
+        const size_t max_cached =
+            max_cached_bytes_.load(std::memory_order_relaxed);
+        // Trim below the cap, so that the next few frees stay on the fast
+        // path instead of each trimming again.
+        if (cached > max_cached)
+            Trim(max_cached - max_cached / 4);
+    }
+    /** Release all unused memory, in the global depot and in the caches
+     *  of every thread. */
+    void FreeAllUnused()
+    {
         {
-            size_t bin = iter->second;
-            alloc_to_bin_.erase(iter);
-            if (bin == INVALID_BIN)
+            std::lock_guard<std::mutex> lock(caches_mutex_);
+            for (auto& cache : caches_)
             {
-                do_free(ptr);
+                std::lock_guard<std::mutex> cache_lock(cache->mutex);
+                free_cache(*cache);
             }
-            else
+        }
+        free_depot();
+    }
+
+    /** Release cached blocks, least recently used bins first, until at
+     *  most target bytes are cached. The caches of every thread are first
+     *  returned to the global depot, so blocks cached by other threads are
+     *  released as well. If another thread is already trimming, this
+     *  returns immediately. */
+    void Trim(size_t target)
+    {
+        std::unique_lock<std::mutex> lock(trim_mutex_, std::try_to_lock);
+        if (!lock.owns_lock())
+            return;
+
+        {
+            std::lock_guard<std::mutex> caches_lock(caches_mutex_);
+            for (auto& cache : caches_)
             {
-                // Cache the pointer for reuse.
-                free_data_[bin].push_back(ptr);
+                std::lock_guard<std::mutex> cache_lock(cache->mutex);
+                for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+                    flush(*cache, bin);
             }
         }
+
+        std::vector<std::pair<size_t,size_t>> lru(bin_sizes_.size());
+        for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+            lru[bin] = {last_use_[bin].load(std::memory_order_relaxed), bin};
+        std::sort(lru.begin(), lru.end());
+        for (const auto& entry : lru)
+        {
+            if (bytes_cached_.load(std::memory_order_relaxed) <= target)
+                break;
+            const size_t bin = entry.second;
+            Header* header =
+                depot_[bin].exchange(nullptr, std::memory_order_acquire);
+            size_t released = 0;
+            while (header != nullptr)
+            {
+                Header* next = header->next;
+                do_free(header->raw);
+                released += bin_sizes_[bin];
+                header = next;
+            }
+            bytes_cached_.fetch_sub(released, std::memory_order_relaxed);
+            bytes_trimmed_.fetch_add(released, std::memory_order_relaxed);
+        }
     }
-    /** Release all unused memory. */
-    void FreeAllUnused()
+
+    /** Cap the bytes held in cached blocks, trimming immediately if the
+     *  cap is already exceeded. */
+    void SetMaxCachedBytes(size_t max_cached_bytes)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
+        max_cached_bytes_.store(max_cached_bytes, std::memory_order_relaxed);
+        if (bytes_cached_.load(std::memory_order_relaxed) > max_cached_bytes)
+            Trim(max_cached_bytes);
+    }
+    size_t MaxCachedBytes() const
+    { return max_cached_bytes_.load(std::memory_order_relaxed); }
+
+    /** Alignment (in bytes) of every allocation. */
+    size_t Alignment() const { return alignment_; }
+
+    /** Number of thread caches, which are discarded as threads exit. */
+    size_t NumThreadCaches()
+    {
+        std::lock_guard<std::mutex> lock(caches_mutex_);
+        return caches_.size();
+    }
+
+    /** Return a snapshot of the usage of this pool. Counters which are
+     *  updated concurrently may be mutually inconsistent. */
+    MemoryPoolStatistics Statistics()
+    {
+        MemoryPoolStatistics stats;
+        stats.bytes_in_use = bytes_in_use_.load(std::memory_order_relaxed);
+        stats.bytes_requested =
+            bytes_requested_.load(std::memory_order_relaxed);
+        stats.peak_bytes_in_use =
+            peak_bytes_in_use_.load(std::memory_order_relaxed);
+        stats.bytes_cached = bytes_cached_.load(std::memory_order_relaxed);
+        stats.max_cached_bytes = MaxCachedBytes();
+        stats.bytes_trimmed = bytes_trimmed_.load(std::memory_order_relaxed);
+        stats.uncached_allocations =
+            uncached_allocations_.load(std::memory_order_relaxed);
+        stats.bins.resize(bin_sizes_.size());
+        std::lock_guard<std::mutex> lock(caches_mutex_);
         for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
-            for (auto&& ptr : free_data_[bin])
-                do_free(ptr);
+        {
+            stats.bins[bin].size = bin_sizes_[bin];
+            stats.bins[bin].hits = retired_hits_[bin];
+            stats.bins[bin].misses = retired_misses_[bin];
+        }
+        for (const auto& cache : caches_)
+        {
+            for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+            {
+                stats.bins[bin].hits +=
+                    cache->hits[bin].load(std::memory_order_relaxed);
+                stats.bins[bin].misses +=
+                    cache->misses[bin].load(std::memory_order_relaxed);
+            }
+        }
+        return stats;
     }
 
 private:
 
+    /** Bookkeeping stored immediately before each allocation. */
+    struct Header
+    {
+        Header* next;
+        /** The start of the underlying allocation. */
+        void* raw;
+        size_t bin;
+        size_t size;
+        /** live_tag() while the block is handed out, and zero otherwise. */
+        uintptr_t tag;
+    };
+
+    /** Per-thread free lists and usage counters, one per bin.
+     *  The free lists are guarded by the mutex, which is uncontended except
+     *  while the pool drains every cache. The counters are only written by
+     *  the owning thread, but may be read concurrently by Statistics.
+     */
+    struct ThreadCache
+    {
+        explicit ThreadCache(size_t num_bins)
+            : heads(num_bins, nullptr), counts(num_bins, 0),
+              hits(new std::atomic<size_t>[num_bins]),
+              misses(new std::atomic<size_t>[num_bins])
+        {
+            for (size_t bin = 0; bin < num_bins; ++bin)
+            {
+                hits[bin].store(0, std::memory_order_relaxed);
+                misses[bin].store(0, std::memory_order_relaxed);
+            }
+        }
+        std::mutex mutex;
+        std::vector<Header*> heads;
+        std::vector<size_t> counts;
+        std::unique_ptr<std::atomic<size_t>[]> hits;
+        std::unique_ptr<std::atomic<size_t>[]> misses;
+    };
+
+    /** The caches a thread holds for each pool it has used.
+     *  At thread exit, the caches of pools that are still alive are
+     *  returned to their depots and discarded.
+     */
+    struct ThreadCacheList
+    {
+        struct Entry
+        {
+            size_t id;
+            MemoryPool* pool;
+            ThreadCache* cache;
+        };
+        std::vector<Entry> entries;
+        ~ThreadCacheList()
+        {
+            std::lock_guard<std::mutex> lock(
+                details::MemoryPoolRegistryMutex());
+            for (auto& entry : entries)
+                if (details::MemoryPoolIsLive(entry.id))
+                    entry.pool->retire(entry.cache);
+        }
+    };
+
     /** Index of an invalid bin. */
     static constexpr size_t INVALID_BIN = (size_t) -1;
+    /** Marks the header of an outstanding allocation. */
+    static constexpr uintptr_t LIVE_MAGIC = uintptr_t(0x48796472306d656dULL);
 
-    /** Serialize access from multiple threads. */
-    std::mutex mutex_;
+    /** Identifier of this pool in the registry of live pools. */
+    const size_t id_;
+    /** Number of blocks per bin a thread may cache. */
+    const size_t max_thread_cached_;
+    /** Alignment of every allocation. */
+    const size_t alignment_;
 
     /** Size in bytes of each bin. */
     std::vector<size_t> bin_sizes_;
-    /** Data available to allocate.
-     *  Each entry is a bin, and each bin has a vector of pointers to free
-     *  memory of that size.
+    /** Lock-free stacks of free blocks, one per bin. */
+    std::unique_ptr<std::atomic<Header*>[]> depot_;
+    /** Logical time at which each bin last required the depot. */
+    std::unique_ptr<std::atomic<size_t>[]> last_use_;
+    std::atomic<size_t> clock_{0};
+
+    /** Usage counters. */
+    std::atomic<size_t> bytes_in_use_{0};
+    std::atomic<size_t> bytes_requested_{0};
+    std::atomic<size_t> peak_bytes_in_use_{0};
+    std::atomic<size_t> bytes_cached_{0};
+    std::atomic<size_t> max_cached_bytes_;
+    std::atomic<size_t> bytes_trimmed_{0};
+    std::atomic<size_t> uncached_allocations_{0};
+    /** Serializes trimming. */
+    std::mutex trim_mutex_;
+
+    /** The caches of every live thread which has used this pool, and the
+     *  counters of the caches of exited threads.
+     *  The mutex is only taken when a thread first uses the pool, when a
+     *  thread exits, and while draining every cache.
      */
-    std::vector<std::vector<void*>> free_data_;
-    /** Map used pointers to the associated bin index. */
-    std::unordered_map<void*, size_t> alloc_to_bin_;
+    std::mutex caches_mutex_;
+    std::vector<std::unique_ptr<ThreadCache>> caches_;
+    std::vector<size_t> retired_hits_, retired_misses_;
 
     /** Allocate size bytes. */
     inline void* do_allocation(size_t size);
     /** Free ptr. */
     inline void do_free(void* ptr);
 
+    /** Allocate a block with room for size bytes after an aligned header. */
+    Header* new_block(size_t size)
+    {
+        void* raw = do_allocation(sizeof(Header) + alignment_ + size);
+        const uintptr_t user =
+            (reinterpret_cast<uintptr_t>(raw) + sizeof(Header)
+             + alignment_ - 1) & ~(uintptr_t(alignment_) - 1);
+        Header* header = reinterpret_cast<Header*>(user - sizeof(Header));
+        header->raw = raw;
+        return header;
+    }
+
+    static void* user_pointer(Header* header)
+    { return reinterpret_cast<char*>(header) + sizeof(Header); }
+
+    /** The tag of this pool's outstanding allocations, which differs
+     *  between pools so that blocks of another pool are rejected. */
+    uintptr_t live_tag() const
+    { return LIVE_MAGIC ^ reinterpret_cast<uintptr_t>(this); }
+
     /** Return the bin index for size. */
-    inline size_t get_bin(size_t size)
+    inline size_t get_bin(size_t size) const
     {
-        // Assuming we don't have that many bins, just do a linear search.
-        // Could optimize with binary search if need be.
-        for (size_t i = 0; i < bin_sizes_.size(); ++i)
+        auto iter = std::lower_bound(bin_sizes_.begin(), bin_sizes_.end(),
+                                     size);
+        if (iter == bin_sizes_.end())
+            return INVALID_BIN;
+        return iter - bin_sizes_.begin();
+    }
+
+    /** Increment a counter which only the calling thread writes. */
+    static void increment(std::atomic<size_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+    }
+
+    /** Account for a new allocation, updating the high-water mark. */
+    void add_in_use(size_t bytes, size_t requested)
+    {
+        const size_t in_use =
+            bytes_in_use_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        bytes_requested_.fetch_add(requested, std::memory_order_relaxed);
+        size_t peak = peak_bytes_in_use_.load(std::memory_order_relaxed);
+        while (in_use > peak &&
+               !peak_bytes_in_use_.compare_exchange_weak(
+                   peak, in_use, std::memory_order_relaxed))
+        {}
+    }
+
+    /** Return the calling thread's cache for this pool. */
+    ThreadCache& thread_cache()
+    {
+        static thread_local ThreadCacheList list;
+        for (auto& entry : list.entries)
+            if (entry.id == id_)
+                return *entry.cache;
+
+        ThreadCache* cache = new ThreadCache(bin_sizes_.size());
+        {
+            std::lock_guard<std::mutex> lock(caches_mutex_);
+            caches_.emplace_back(cache);
+        }
+        list.entries.push_back({id_, this, cache});
+        return *cache;
+    }
+
+    /** Return the blocks of an exiting thread's cache to the depot, keep
+     *  its counters, and discard it. */
+    void retire(ThreadCache* cache)
+    {
+        std::lock_guard<std::mutex> lock(caches_mutex_);
         {
-            if (bin_sizes_[i] >= size) return i;
+            std::lock_guard<std::mutex> cache_lock(cache->mutex);
+            for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+            {
+                flush(*cache, bin);
+                retired_hits_[bin] +=
+                    cache->hits[bin].load(std::memory_order_relaxed);
+                retired_misses_[bin] +=
+                    cache->misses[bin].load(std::memory_order_relaxed);
+            }
+        }
+        caches_.erase(
+            std::find_if(
+                caches_.begin(), caches_.end(),
+                [cache](const std::unique_ptr<ThreadCache>& entry)
+                { return entry.get() == cache; }));
+    }
+
+    /** Push the chain [head,tail] onto the depot stack of bin. */
+    void push_depot(size_t bin, Header* head, Header* tail)
+    {
+        tail->next = depot_[bin].load(std::memory_order_relaxed);
+        while (!depot_[bin].compare_exchange_weak(
+                   tail->next, head,
+                   std::memory_order_release, std::memory_order_relaxed))
+        {}
+    }
+
+    /** Return one block of bin from the depot, moving up to
+     *  max_thread_cached_ more into the cache. */
+    Header* refill(ThreadCache& cache, size_t bin)
+    {
+        Header* head = depot_[bin].exchange(nullptr, std::memory_order_acquire);
+        if (head == nullptr)
+            return nullptr;
+        Header* rest = head->next;
+        while (rest != nullptr && cache.counts[bin] < max_thread_cached_)
+        {
+            Header* next = rest->next;
+            rest->next = cache.heads[bin];
+            cache.heads[bin] = rest;
+            ++cache.counts[bin];
+            rest = next;
+        }
+        if (rest != nullptr)
+        {
+            Header* tail = rest;
+            while (tail->next != nullptr)
+                tail = tail->next;
+            push_depot(bin, rest, tail);
+        }
+        return head;
+    }
+
+    /** Return the cached blocks of bin to the depot. */
+    void flush(ThreadCache& cache, size_t bin)
+    {
+        Header* head = cache.heads[bin];
+        if (head == nullptr)
+            return;
+        Header* tail = head;
+        while (tail->next != nullptr)
+            tail = tail->next;
+        push_depot(bin, head, tail);
+        cache.heads[bin] = nullptr;
+        cache.counts[bin] = 0;
+    }
+
+    /** Release the blocks held by cache. */
+    void free_cache(ThreadCache& cache)
+    {
+        for (size_t bin = 0; bin < cache.heads.size(); ++bin)
+        {
+            for (Header* header = cache.heads[bin]; header != nullptr;)
+            {
+                Header* next = header->next;
+                do_free(header->raw);
+                bytes_cached_.fetch_sub(
+                    bin_sizes_[bin], std::memory_order_relaxed);
+                header = next;
+            }
+            cache.heads[bin] = nullptr;
+            cache.counts[bin] = 0;
+        }
+    }
+
+    /** Release the blocks held by the depot. */
+    void free_depot()
+    {
+        for (size_t bin = 0; bin < bin_sizes_.size(); ++bin)
+        {
+            Header* header =
+                depot_[bin].exchange(nullptr, std::memory_order_acquire);
+            while (header != nullptr)
+            {
+                Header* next = header->next;
+                do_free(header->raw);
+                bytes_cached_.fetch_sub(
+                    bin_sizes_[bin], std::memory_order_relaxed);
+                header = next;
+            }
         }
-        return INVALID_BIN;
     }
 
 };  // class MemoryPool
 
+template <bool Pinned>
+constexpr size_t MemoryPool<Pinned>::INVALID_BIN;
+template <bool Pinned>
+constexpr uintptr_t MemoryPool<Pinned>::LIVE_MAGIC;
+
 #ifdef HYDROGEN_HAVE_CUDA
 template <>
 inline void* MemoryPool<true>::do_allocation(size_t bytes)
@@ -229,6 +737,11 @@ MemoryPool<false>& HostMemoryPool();
 /** Destroy singleton instance of host memory pool. */
 void DestroyHostMemoryPool();
 
+/** Print the statistics of the host (and pinned host) memory pools.
+ *  Nothing is printed for pools which were never used.
+ */
+void PrintMemoryPoolStatistics(std::ostream& os);
+
 }  // namespace El
 
 #endif  // HYDROGEN_MEMORYPOOL_HPP_
@@ -2,6 +2,7 @@
 #ifndef EL_CORE_PROFILING_HPP_
 #define EL_CORE_PROFILING_HPP_
 
+#include <iosfwd>
 #include <string>
 
 #include "El-lite.hpp"
@@ -19,6 +20,64 @@ void DisableVTune() noexcept;
 void EnableNVProf() noexcept;
 void DisableNVProf() noexcept;
 
+/** \brief Output formats of the native profiler. */
+enum class ProfileFormat
+{
+    TEXT,        ///< A table of the region tree, reduced across ranks
+    JSON,        ///< The same statistics as a JSON document
+    CHROME_TRACE ///< The timeline of this rank as Chrome trace events
+};// enum class ProfileFormat
+
+/** \brief Start or stop the native profiler.
+ *
+ *  The native profiler records, for each thread, a call tree of the
+ *  profiling regions with their call counts, inclusive and exclusive
+ *  times, and the bytes moved within them (see AddProfileBytes). It is
+ *  independent of NVProf and VTune. With recordTrace, it also records
+ *  the timeline written by ProfileFormat::CHROME_TRACE.
+ *
+ *  Setting the HYDROGEN_PROFILE environment variable to a
+ *  comma-separated list of "text", "json" and "chrome" enables it at
+ *  Initialize and writes those reports at Finalize. The text report
+ *  goes to stderr and the others to files named after the
+ *  HYDROGEN_PROFILE_FILE prefix (default "hydrogen_profile"):
+ *  "<prefix>.json" and "<prefix>.<rank>.trace.json".
+ */
+void EnableNativeProfiling(bool recordTrace=false) noexcept;
+void DisableNativeProfiling() noexcept;
+bool NativeProfilingEnabled() noexcept;
+
+/** \brief Attribute bytes moved to the innermost region of the calling
+ *         thread.
+ *
+ *  This is a no-op if the native profiler is disabled.
+ */
+void AddProfileBytes(size_t bytes) noexcept;
+
+/** \brief Write the native profile.
+ *
+ *  The text and JSON reports reduce the region statistics across
+ *  mpi::COMM_WORLD (minimum, average, maximum and the imbalance
+ *  max/avg-1 of each quantity) and are written by rank 0 only; this is
+ *  collective over mpi::COMM_WORLD. The Chrome trace holds the regions of
+ *  the calling rank, with one track per thread.
+ *
+ *  No other thread should be inside a region during the call.
+ */
+void ReportProfile(std::ostream& os, ProfileFormat format);
+
+/** \brief Discard the recorded regions and trace events.
+ *
+ *  Other threads discard theirs the next time they begin or end a region,
+ *  and are left out of the reports until then. Regions which are open
+ *  during the call are dropped.
+ */
+void ResetProfile() noexcept;
+
+// Called by Initialize and Finalize, respectively
+void InitializeProfiling();
+void FinalizeProfiling();
+
 /** \brief A selection of colors to use with the profiling interface.
  *
  *  It seems unlikely that a user will ever need to access these by
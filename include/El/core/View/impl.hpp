@@ -27,6 +27,7 @@ void View(Matrix<T,D>& A, Matrix<T,D>& B)
                 (B.Height(), B.Width(), B.LockedBuffer(), B.LDim());
         else
             A.Attach(B.Height(), B.Width(), B.Buffer(), B.LDim());
+    ShareSyncInfo(A, B);
 }
 
 template<typename T, Device D>
@@ -34,6 +35,7 @@ void LockedView(Matrix<T,D>& A, const Matrix<T,D>& B)
 {
     EL_DEBUG_CSE
         A.LockedAttach(B.Height(), B.Width(), B.LockedBuffer(), B.LDim());
+    ShareSyncInfo(A, B);
 }
 
 template<typename T, Device D>
@@ -99,6 +101,28 @@ void LockedView(AbstractMatrix<T>& A, const AbstractMatrix<T>& B)
     }
 }
 
+template<typename T>
+void ShareSyncInfo(AbstractMatrix<T>& A, const AbstractMatrix<T>& B)
+{
+    if (A.GetDevice() != B.GetDevice())
+        LogicError("View requires matching device types.");
+
+    switch(A.GetDevice()) {
+    case Device::CPU:
+        ShareSyncInfo(static_cast<Matrix<T,Device::CPU>&>(A),
+                      static_cast<const Matrix<T,Device::CPU>&>(B));
+        break;
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        ShareSyncInfo(static_cast<Matrix<T,Device::GPU>&>(A),
+                      static_cast<const Matrix<T,Device::GPU>&>(B));
+        break;
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("Unsupported device type.");
+    }
+}
+
 // ElementalMatrix
 // ---------------
 
@@ -115,6 +139,7 @@ void View(ElementalMatrix<T>& A, ElementalMatrix<T>& B)
             A.Attach
                 (B.Height(), B.Width(), B.Grid(), B.ColAlign(), B.RowAlign(),
                  B.Buffer(), B.LDim(), B.Root());
+    ShareSyncInfo(A.Matrix(), B.LockedMatrix());
 }
 
 template<typename T>
@@ -126,6 +151,7 @@ void LockedView
         A.LockedAttach
         (B.Height(), B.Width(), B.Grid(), B.ColAlign(), B.RowAlign(),
          B.LockedBuffer(), B.LDim(), B.Root());
+    ShareSyncInfo(A.Matrix(), B.LockedMatrix());
 }
 
 // Return by value
@@ -341,6 +367,7 @@ void View(Matrix<T,D>& A, Matrix<T,D>& B,
         A.LockedAttach(height, width, B.LockedBuffer(i,j), B.LDim());
     else
         A.Attach(height, width, B.Buffer(i,j), B.LDim());
+    ShareSyncInfo(A, B);
 }
 
 template<typename T, Device D>
@@ -362,6 +389,7 @@ void LockedView(Matrix<T,D>& A, Matrix<T,D> const& B,
 #endif // !EL_RELEASE
 
     A.LockedAttach(height, width, B.LockedBuffer(i,j), B.LDim());
+    ShareSyncInfo(A, B);
 }
 
 template<typename T, Device D>
@@ -515,6 +543,7 @@ void View
                 (height, width, B.Grid(),
                  colAlign, rowAlign, 0, B.LDim(), B.Root());
     }
+    ShareSyncInfo(A.Matrix(), B.LockedMatrix());
 }
 
 template<typename T>
@@ -543,6 +572,7 @@ void LockedView
         A.LockedAttach
             (height, width, B.Grid(), colAlign, rowAlign, 0, B.LDim(), B.Root());
     }
+    ShareSyncInfo(A.Matrix(), B.LockedMatrix());
 }
 
 template<typename T>
@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_WORKSPACE_HPP
+#define EL_CORE_WORKSPACE_HPP
+
+#include <stddef.h>
+
+namespace El
+{
+
+/** A per-thread stack of host workspace memory.
+ *
+ *  While a WorkspaceScope is open on a thread, the host temporaries of that
+ *  thread (i.e., the hydrogen::simple_buffer pack and unpack buffers used by
+ *  the redistributions) are bump-allocated from the arena rather than from
+ *  the memory pool. A block which is released while it is on top of the
+ *  stack is reclaimed immediately, so the strictly nested temporaries of a
+ *  sequence of redistributions reuse the same memory, and everything
+ *  allocated within a scope is reclaimed in O(1) when the scope closes.
+ *
+ *  The arena grows by adding chunks; once the outermost scope closes, the
+ *  chunks are coalesced so that later scopes run out of a single chunk.
+ *  Memory allocated from the arena must be released in LIFO order and must
+ *  not outlive the innermost scope which was open when it was allocated.
+ *  Debug builds track the outstanding blocks and throw from Release when
+ *  either rule is broken; a simple_buffer which breaks them while being
+ *  destroyed reports the error on std::cerr instead.
+ */
+namespace workspace
+{
+
+/** Whether a WorkspaceScope is open on the calling thread. */
+bool Active() noexcept;
+
+/** Allocate size bytes from the calling thread's arena. */
+void* Allocate(size_t size);
+
+/** Return a block of size bytes to the calling thread's arena. In
+ *  release builds, this is a no-op unless the block is on top of the
+ *  stack; debug builds throw a logic error instead, and also when the
+ *  scope which the block was allocated in has already closed. */
+void Release(void* ptr, size_t size);
+
+/** Number of blocks allocated from the calling thread's arena within the
+ *  open scopes and not yet released. This is only tracked in debug builds
+ *  and is otherwise zero. */
+size_t NumOutstanding() noexcept;
+
+/** Total bytes held by the calling thread's arena. */
+size_t Capacity() noexcept;
+
+} // namespace workspace
+
+/** RAII scope within which host temporaries come from the workspace
+ *  arena. Scopes nest; closing one releases everything allocated within
+ *  it. */
+class WorkspaceScope
+{
+public:
+    WorkspaceScope();
+    ~WorkspaceScope();
+
+    WorkspaceScope(const WorkspaceScope&) = delete;
+    WorkspaceScope& operator=(const WorkspaceScope&) = delete;
+
+private:
+    size_t chunk_;
+    size_t offset_;
+    size_t numOutstanding_ = 0;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_WORKSPACE_HPP
@@ -235,6 +235,16 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy );
+#ifdef HYDROGEN_HAVE_HALF
+// Accumulates in single precision
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const cpu_half_type& alpha,
+  const cpu_half_type* A, BlasInt ALDim,
+  const cpu_half_type* x, BlasInt incx,
+  const cpu_half_type& beta,
+        cpu_half_type* y, BlasInt incy );
+#endif // HYDROGEN_HAVE_HALF
 
 template<typename T>
 void Ger
@@ -585,6 +595,16 @@ void Gemm
   const dcomplex* B, BlasInt BLDim,
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
+#ifdef HYDROGEN_HAVE_HALF
+// Accumulates in single precision
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const cpu_half_type& alpha,
+  const cpu_half_type* A, BlasInt ALDim,
+  const cpu_half_type* B, BlasInt BLDim,
+  const cpu_half_type& beta,
+        cpu_half_type* C, BlasInt CLDim );
+#endif // HYDROGEN_HAVE_HALF
 
 template<typename T>
 void Hemm
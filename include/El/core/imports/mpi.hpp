@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <functional>
+#include <iosfwd>
+#include <string>
 #include <vector>
 
 namespace El
@@ -66,6 +68,9 @@ struct Request
     MPI_Request backend;
 
     std::vector<byte> buffer;
+    // Holds the serialized input of a non-blocking collective on
+    // non-packed data until the request completes
+    std::vector<byte> sendBuffer;
     bool receivingPacked=false;
     int recvCount;
     T* unpackedRecvBuf;
@@ -80,6 +85,10 @@ extern const int THREAD_SERIALIZED;
 extern const int THREAD_MULTIPLE;
 
 extern const int UNDEFINED;
+// The split types for processes which share memory, and which share a socket
+// (UNDEFINED if the MPI implementation cannot split by socket)
+extern const int COMM_TYPE_SHARED;
+extern const int COMM_TYPE_SOCKET;
 extern const Group GROUP_NULL;
 extern const Comm COMM_NULL;// = MPI_COMM_NULL;
 extern const Comm COMM_SELF;// = MPI_COMM_SELF;
@@ -207,12 +216,18 @@ void Create
 ( Comm const& parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm const& original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm const& comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+void SplitType
+( Comm const& comm, int splitType, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm const& comm1, Comm const& comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm const& comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
 bool CongruentToCommSelf( Comm const& comm ) EL_NO_RELEASE_EXCEPT;
 bool CongruentToCommWorld( Comm const& comm ) EL_NO_RELEASE_EXCEPT;
+// The name of a communicator, under which its communication statistics are
+// kept (e.g., the communicators of a Grid are named "MC", "VR", ...)
+void SetName( Comm const& comm, const std::string& name ) EL_NO_RELEASE_EXCEPT;
+std::string Name( Comm const& comm ) EL_NO_RELEASE_EXCEPT;
 
 Comm NewWorldComm() EL_NO_RELEASE_EXCEPT;
 
@@ -262,6 +277,70 @@ void Translate
 // Utilities
 void Barrier( Comm const& comm=COMM_WORLD ) EL_NO_RELEASE_EXCEPT;
 
+// Node-local shared memory
+// ------------------------
+// Whether redistributions within communicators whose processes all share a
+// node may exchange data through an MPI-3 shared-memory window rather than
+// messages. This must be set identically on every process, and defaults to
+// whether the HYDROGEN_USE_SHARED_MEMORY environment variable is set to a
+// nonzero value.
+bool UseSharedMemory() EL_NO_EXCEPT;
+void SetUseSharedMemory( bool use ) EL_NO_EXCEPT;
+
+// If shared memory is in use and all processes of 'comm' share a node,
+// returns the start of a shared window which is contiguous across the
+// processes and holds at least 'bytesPerProcess' bytes for each of them;
+// otherwise, returns nullptr. The window is cached on 'comm' and grown as
+// needed. The call is collective, all processes must request the same size,
+// and it returns once no process is still reading what was previously
+// written to the window.
+byte* SharedWindow( Comm const& comm, size_t bytesPerProcess );
+// Make the writes to the shared window of 'comm' visible to every process
+// of 'comm' once they have all written
+void SharedWindowSync( Comm const& comm );
+
+// Communication statistics
+// ------------------------
+// Counts of the calls to AllGather, AllToAll, Broadcast, AllReduce,
+// ReduceScatter, and SendRecv, kept by each process per operation and per
+// communicator name. Collection defaults to whether the HYDROGEN_COMM_STATS
+// environment variable is set to a nonzero value, in which case the
+// statistics are reported to stderr by Finalize. While the native profiler
+// is enabled, each call is also profiled as an "MPI.<operation>" region
+// holding its bytes, nested within the caller's region.
+struct CommStats
+{
+    // The number of histogram buckets; bucket 0 counts the empty messages
+    // and bucket k>0 those of [2^(k-1),2^k) bytes, except that the last one
+    // also holds the larger messages
+    static constexpr int numSizeBuckets = 41;
+
+    Collective op;
+    std::string comm;
+    long long calls=0;
+    size_t bytesSent=0, bytesRecv=0;
+    // The time spent in the calls. Calls over MPI synchronize with the
+    // buffers' device first, so this is the time until the data is in
+    // place; the Aluminum GPU backends only enqueue the operation on the
+    // buffers' stream, so for them it is only the time to enqueue.
+    double seconds=0;
+    // A histogram of the larger of the send and receive size of each call
+    std::vector<long long> sizeHistogram=
+      std::vector<long long>(numSizeBuckets,0);
+};
+
+std::string CollectiveName( Collective op );
+
+bool CollectCommStats() EL_NO_EXCEPT;
+void SetCollectCommStats( bool collect ) EL_NO_EXCEPT;
+// The statistics of this process, ordered by operation and communicator
+std::vector<CommStats> GetCommStats();
+void ResetCommStats();
+// Sum the statistics over mpi::COMM_WORLD (also giving the minimum and
+// maximum time over the processes) and write them from its root; this is
+// collective over mpi::COMM_WORLD
+void ReportCommStats( std::ostream& os );
+
 template<typename T>
 void Wait( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
 
@@ -714,6 +793,103 @@ void IBroadcast
 template<typename T>
 void IBroadcast( T& b, int root, Comm const& comm, Request<T>& request );
 
+// Non-blocking reductions and exchanges
+// -------------------------------------
+// The buffers may not be accessed until the request has been waited upon.
+// Device buffers are handed directly to MPI; if they must be staged through
+// the host (HYDROGEN_ENSURE_HOST_MPI_BUFFERS), the collective instead
+// completes before returning and the request is null.
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo );
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op,
+  Comm const& comm, Request<Complex<Real>>& request,
+  SyncInfo<D> const& syncInfo );
+template<typename T, Device D,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo );
+
+// In-place option
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo );
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm const& comm,
+  Request<Complex<Real>>& request, SyncInfo<D> const& syncInfo );
+template<typename T, Device D,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( T* buf, int count, Op op, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo );
+
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc, Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo );
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc, Complex<Real>* rbuf, int rc,
+  Comm const& comm, Request<Complex<Real>>& request,
+  SyncInfo<D> const& syncInfo );
+template<typename T, Device D,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllGather
+( const T* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo );
+
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, int sc, Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo );
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc, Complex<Real>* rbuf, int rc,
+  Comm const& comm, Request<Complex<Real>>& request,
+  SyncInfo<D> const& syncInfo );
+template<typename T, Device D,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllToAll
+( const T* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo );
+
+// Each process receives 'rc' entries of the reduction of 'rc*commSize'
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo );
+template<typename Real, Device D,
+         typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op,
+  Comm const& comm, Request<Complex<Real>>& request,
+  SyncInfo<D> const& syncInfo );
+template<typename T, Device D,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo );
+
 // Gather
 // ------
 
@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_RANDOM_PHILOX_HPP
+#define EL_RANDOM_PHILOX_HPP
+
+#include <cstdint>
+
+// The generator is also used by the GPU kernels
+#ifdef __CUDACC__
+# define EL_PHILOX_QUALIFIERS __host__ __device__
+#else
+# define EL_PHILOX_QUALIFIERS
+#endif
+
+namespace El {
+namespace philox {
+
+// The Philox4x32-10 counter-based generator of Salmon et al., "Parallel
+// random numbers: as easy as 1, 2, 3" (SC11). Each 128-bit counter is
+// mapped to 128 random bits by a keyed bijection, so any entry of a random
+// matrix can be generated directly from its (seed, stream, i, j)
+// coordinates, in any order and on any process.
+
+struct Key { std::uint32_t k0, k1; };
+
+struct Bits { std::uint32_t x0, x1, x2, x3; };
+
+inline EL_PHILOX_QUALIFIERS void Round( Bits& c, const Key& k ) noexcept
+{
+    const std::uint64_t p0 = std::uint64_t(0xD2511F53u)*c.x0;
+    const std::uint64_t p1 = std::uint64_t(0xCD9E8D57u)*c.x2;
+    c = Bits{ std::uint32_t(p1>>32) ^ c.x1 ^ k.k0, std::uint32_t(p1),
+              std::uint32_t(p0>>32) ^ c.x3 ^ k.k1, std::uint32_t(p0) };
+}
+
+inline EL_PHILOX_QUALIFIERS Bits Philox4x32( Bits c, Key k ) noexcept
+{
+    for( int round=0; round<9; ++round )
+    {
+        Round( c, k );
+        k.k0 += 0x9E3779B9u;
+        k.k1 += 0xBB67AE85u;
+    }
+    Round( c, k );
+    return c;
+}
+
+// Distinct streams of the same seed have distinct keys since the stream is
+// scrambled by an odd multiplier (a bijection modulo 2^64)
+inline EL_PHILOX_QUALIFIERS Key
+MakeKey( std::uint64_t seed, std::uint64_t stream ) noexcept
+{
+    const std::uint64_t key = seed ^ (stream*0x9E3779B97F4A7C15ull);
+    return Key{ std::uint32_t(key), std::uint32_t(key>>32) };
+}
+
+// The random bits of entry (i,j) of the matrix generated from 'key'. The
+// last word of the counter separates the matrices of different processes
+// which share a key (e.g., sequential matrices).
+inline EL_PHILOX_QUALIFIERS Bits Entry
+( const Key& key, std::int64_t i, std::int64_t j,
+  std::uint32_t tag=0 ) noexcept
+{
+    const std::uint64_t iBits = std::uint64_t(i), jBits = std::uint64_t(j);
+    return Philox4x32
+      ( Bits{ std::uint32_t(iBits), std::uint32_t(jBits),
+              std::uint32_t(iBits>>32) ^ (std::uint32_t(jBits>>32)<<16),
+              tag },
+        key );
+}
+
+// A double in [0,1) built from 53 random bits
+inline EL_PHILOX_QUALIFIERS double
+UnitInterval( std::uint32_t lo, std::uint32_t hi ) noexcept
+{
+    const std::uint64_t x = (std::uint64_t(hi)<<32) | lo;
+    return double(x>>11)*(1./9007199254740992.);
+}
+
+// A double in (0,1], which is safe to take the logarithm of
+inline EL_PHILOX_QUALIFIERS double
+PositiveUnitInterval( std::uint32_t lo, std::uint32_t hi ) noexcept
+{
+    const std::uint64_t x = (std::uint64_t(hi)<<32) | lo;
+    return double((x>>11)+1)*(1./9007199254740992.);
+}
+
+} // namespace philox
+} // namespace El
+
+#endif // ifndef EL_RANDOM_PHILOX_HPP
@@ -9,6 +9,8 @@
 #ifndef EL_RANDOM_DECL_HPP
 #define EL_RANDOM_DECL_HPP
 
+#include <El/core/random/Philox.hpp>
+
 namespace El {
 
 std::mt19937& Generator();
@@ -107,6 +109,32 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>>
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random matrices
+// =============================
+// The entries of a random matrix are generated by philox::Entry from the
+// global seed, a stream number which is distinct for each generated matrix,
+// and the global coordinates of the entry. The seed is the same on every
+// process, so the same entry is generated wherever it is needed.
+//
+// Seeding Generator() directly does not affect these matrices; use
+// SetRandomSeed instead.
+std::uint64_t RandomSeed();
+
+// Reseed both Generator() (as in InitializeRandom) and the counter-based
+// generator, and restart its streams. This must be called with the same seed
+// by every process. Afterwards, the same sequence of random matrices is
+// generated, no matter which grids they are distributed over.
+void SetRandomSeed( std::uint64_t seed );
+
+// Reserve a new stream for a sequential matrix
+std::uint64_t NextRandomStream();
+
+// Reserve a new stream for a distributed matrix; collective over 'comm',
+// whose members agree upon the result. Only the first call on a
+// communicator (after each SetRandomSeed) communicates; later streams are
+// counted locally.
+std::uint64_t NextRandomStream( mpi::Comm const& comm );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
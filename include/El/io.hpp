@@ -75,6 +75,68 @@ void Read
 ( AbstractDistMatrix<T>& A,
   const string filename, FileFormat format=AUTO, bool sequential=false );
 
+// Memory-mapped matrices
+// ======================
+namespace MapAdviceNS {
+enum MapAdvice
+{
+    MAP_ADVICE_NORMAL,
+    MAP_ADVICE_SEQUENTIAL,
+    MAP_ADVICE_RANDOM,
+    MAP_ADVICE_WILLNEED
+};
+}
+using namespace MapAdviceNS;
+
+// A BINARY or BINARY_FLAT file mapped into memory along with a Matrix view
+// of its entries. The view is only valid for the lifetime of the mapping,
+// and processes which map the same file share its pages in the page cache.
+// Modifications made through a writable mapping are written to the file.
+template<typename T>
+class MappedMatrix
+{
+public:
+    MappedMatrix() = default;
+    MappedMatrix
+    ( const string filename, FileFormat format,
+      Int height=0, Int width=0,
+      bool writable=false, MapAdvice advice=MAP_ADVICE_NORMAL );
+    ~MappedMatrix();
+
+    MappedMatrix( MappedMatrix<T>&& A ) EL_NO_EXCEPT;
+    MappedMatrix<T>& operator=( MappedMatrix<T>&& A );
+    MappedMatrix( const MappedMatrix<T>& ) = delete;
+    MappedMatrix<T>& operator=( const MappedMatrix<T>& ) = delete;
+
+    bool Writable() const EL_NO_EXCEPT { return writable_; }
+
+    // The matrix is a locked view unless the mapping is writable
+    El::Matrix<T>& Matrix();
+    const El::Matrix<T>& LockedMatrix() const EL_NO_EXCEPT { return A_; }
+
+    // Flush modifications made through a writable mapping to the file
+    void Sync();
+
+private:
+    void Unmap() EL_NO_EXCEPT;
+
+    void* data_ = nullptr;
+    size_t numBytes_ = 0;
+    bool writable_ = false;
+    El::Matrix<T> A_;
+};
+
+// Map a file written by Write(A,basename,BINARY) without copying it
+template<typename T>
+MappedMatrix<T> MapBinary
+( const string filename,
+  bool writable=false, MapAdvice advice=MAP_ADVICE_NORMAL );
+// Map a height x width file written by Write(A,basename,BINARY_FLAT)
+template<typename T>
+MappedMatrix<T> MapBinaryFlat
+( const string filename, Int height, Int width,
+  bool writable=false, MapAdvice advice=MAP_ADVICE_NORMAL );
+
 // Spy
 // ===
 template<typename T>
@@ -151,6 +151,10 @@ template<typename F>
 Base<F> EntrywiseNorm( const AbstractMatrix<F>& A, Base<F> p=1 );
 template<typename F>
 Base<F> EntrywiseNorm( const AbstractDistMatrix<F>& A, Base<F> p=1 );
+// The norms of many matrices over the same grid, with a single reduction
+template<typename F>
+vector<Base<F>> EntrywiseNorms
+( const vector<const AbstractDistMatrix<F>*>& matrices, Base<F> p=1 );
 
 template<typename F>
 Base<F> HermitianEntrywiseNorm
@@ -169,9 +173,104 @@ Base<F> SymmetricEntrywiseNorm
 // Frobenius norm
 // --------------
 template<typename F>
+Base<F> FrobeniusNorm( const AbstractMatrix<F>& A );
+template<typename F>
 Base<F> FrobeniusNorm( const Matrix<F>& A );
 template<typename F>
 Base<F> FrobeniusNorm( const AbstractDistMatrix<F>& A );
+// The norms of many matrices over the same grid, with a single reduction
+template<typename F>
+vector<Base<F>> FrobeniusNorms
+( const vector<const AbstractDistMatrix<F>*>& matrices );
+
+// A pending FrobeniusNormsAsync, whose norms are available once it has
+// completed. The reduction runs in the background between the two calls.
+template<typename Real>
+class FrobeniusNormsRequest
+{
+public:
+    FrobeniusNormsRequest() = default;
+    FrobeniusNormsRequest( FrobeniusNormsRequest<Real>&& other )
+    : request_(std::move(other.request_)),
+      pairs_(std::move(other.pairs_)),
+      norms_(std::move(other.norms_)),
+      active_(other.active_)
+    {
+        other.active_ = false;
+    }
+    FrobeniusNormsRequest<Real>&
+    operator=( FrobeniusNormsRequest<Real>&& other )
+    {
+        if( this != &other )
+        {
+            Wait();
+            request_ = std::move(other.request_);
+            pairs_ = std::move(other.pairs_);
+            norms_ = std::move(other.norms_);
+            active_ = other.active_;
+            other.active_ = false;
+        }
+        return *this;
+    }
+    ~FrobeniusNormsRequest()
+    {
+        // Destructors are implicitly noexcept
+        try { Wait(); }
+        catch( std::exception const& e ) { ReportException(e); }
+    }
+
+    // Whether the reduction is still pending
+    bool Active() const noexcept { return active_; }
+
+    // Complete the reduction if it has finished
+    bool Test()
+    {
+        if( !active_ )
+            return true;
+        if( !mpi::Test(request_) )
+            return false;
+        Finish();
+        return true;
+    }
+
+    // Block until the reduction has completed and return the norms
+    const vector<Real>& Wait()
+    {
+        if( active_ )
+        {
+            mpi::Wait(request_);
+            Finish();
+        }
+        return norms_;
+    }
+
+private:
+    template<typename F>
+    friend FrobeniusNormsRequest<Base<F>> FrobeniusNormsAsync
+    ( const vector<const AbstractDistMatrix<F>*>& matrices );
+
+    // The pairs hold the scale and the scaled sum of squares of each matrix
+    void Finish()
+    {
+        active_ = false;
+        const Int numNorms = pairs_.size();
+        norms_.resize( numNorms );
+        for( Int k=0; k<numNorms; ++k )
+            norms_[k] = RealPart(pairs_[k])*Sqrt(ImagPart(pairs_[k]));
+        pairs_.clear();
+    }
+
+    mpi::Request<Complex<Real>> request_;
+    vector<Complex<Real>> pairs_;
+    vector<Real> norms_;
+    bool active_ = false;
+};
+
+// FrobeniusNorms with a nonblocking reduction, so that it may be overlapped
+// with other work. The matrices may be modified once it is started.
+template<typename F>
+FrobeniusNormsRequest<Base<F>> FrobeniusNormsAsync
+( const vector<const AbstractDistMatrix<F>*>& matrices );
 
 template<typename F>
 Base<F> HermitianFrobeniusNorm
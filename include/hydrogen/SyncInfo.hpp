@@ -2,8 +2,11 @@
 #define EL_CORE_SYNCINFO_HPP_
 
 #include <hydrogen/Device.hpp>
+#include <hydrogen/device/CPUStreams.hpp>
 #include <hydrogen/meta/IndexSequence.hpp>
 
+#include <utility>
+
 #ifdef HYDROGEN_HAVE_CUDA
 #include <hydrogen/device/gpu/CUDA.hpp>
 #endif // HYDROGEN_HAVE_CUDA
@@ -14,9 +17,10 @@ namespace hydrogen
 /** \class SyncInfo
  *  \brief Manage device-specific synchronization information.
  *
- *  Device-specific synchronization information. For CPUs, this is
- *  empty since all CPU operations are synchronous with respect to the
- *  host. For GPUs, this will be a stream and an associated event.
+ *  Device-specific synchronization information. For GPUs, this will
+ *  be a stream and an associated event. For CPUs, this is an optional
+ *  CPU stream and event (see hydrogen/device/CPUStreams.hpp); without
+ *  a stream, CPU operations are synchronous with respect to the host.
  *
  *  The use-case for this is to cope with the matrix-free part of the
  *  interface. Many of the copy routines have the paradigm that they
@@ -45,6 +49,95 @@ template <Device D>
 void Synchronize(SyncInfo<D> const&)
 {}
 
+template <>
+struct SyncInfo<Device::CPU>
+{
+    SyncInfo() {}
+
+    SyncInfo(cpuStream_t stream, cpuEvent_t event)
+        : stream_{stream}, event_{event} {}
+
+    cpuStream_t stream_ = nullptr;
+    cpuEvent_t event_ = nullptr;
+};// struct SyncInfo<Device::CPU>
+
+inline void AddSynchronizationPoint(SyncInfo<Device::CPU> const& syncInfo)
+{
+    if (syncInfo.event_ != nullptr)
+        CPUEventRecord(syncInfo.event_, syncInfo.stream_);
+}
+
+// This captures the work done on A and forces B to wait for completion
+inline void AddSynchronizationPoint(
+    SyncInfo<Device::CPU> const& A, SyncInfo<Device::CPU> const& B)
+{
+    if (A.stream_ == B.stream_ || A.stream_ == nullptr)
+        return;
+    if (B.stream_ == nullptr || A.event_ == nullptr)
+    {
+        // Nothing to wait on asynchronously; make the host wait
+        CPUStreamSynchronize(A.stream_);
+        return;
+    }
+    AddSynchronizationPoint(A);
+    CPUStreamWaitEvent(B.stream_, A.event_);
+}
+
+// This captures the work done on A and forces B and C to wait for completion
+inline void AddSynchronizationPoint(
+    SyncInfo<Device::CPU> const& A,
+    SyncInfo<Device::CPU> const& B, SyncInfo<Device::CPU> const& C)
+{
+    AddSynchronizationPoint(A, B);
+    AddSynchronizationPoint(A, C);
+}
+
+inline void Synchronize(SyncInfo<Device::CPU> const& syncInfo)
+{
+    if (syncInfo.stream_ != nullptr)
+        CPUStreamSynchronize(syncInfo.stream_);
+}
+
+/** @brief Wait for the work of a SyncInfo object without reporting the
+ *         errors of its kernels, which are left to the next Synchronize.
+ *
+ *  For destructors and other paths which must not throw.
+ */
+inline void SynchronizeNoThrow(SyncInfo<Device::CPU> const& syncInfo) noexcept
+{
+    if (syncInfo.stream_ != nullptr)
+        CPUStreamWait(syncInfo.stream_);
+}
+
+/** @brief Whether the work described by a SyncInfo object completes
+ *         before control returns to the host.
+ */
+template <Device D>
+bool IsHostSynchronous(SyncInfo<D> const&)
+{
+    return D == Device::CPU;
+}
+
+inline bool IsHostSynchronous(SyncInfo<Device::CPU> const& syncInfo)
+{
+    return syncInfo.stream_ == nullptr;
+}
+
+/** @brief Run a host kernel on the stream of a SyncInfo object.
+ *
+ *  The kernel is enqueued if there is a stream and otherwise runs
+ *  immediately. Since it may run after the caller has returned, the
+ *  kernel must capture its arguments by value.
+ */
+template <typename F>
+void RunOnStream(SyncInfo<Device::CPU> const& syncInfo, F&& kernel)
+{
+    if (syncInfo.stream_ != nullptr)
+        CPUStreamEnqueue(syncInfo.stream_, std::forward<F>(kernel));
+    else
+        kernel();
+}
+
 #ifdef HYDROGEN_HAVE_CUDA
 
 template <>
@@ -111,6 +204,12 @@ inline void Synchronize(SyncInfo<Device::GPU> const& syncInfo)
     H_CHECK_CUDA(cudaStreamSynchronize(syncInfo.stream_));
 }
 
+inline void SynchronizeNoThrow(SyncInfo<Device::GPU> const& syncInfo) noexcept
+{
+    // A failure is sticky, so the next checked CUDA call reports it
+    static_cast<void>(cudaStreamSynchronize(syncInfo.stream_));
+}
+
 #endif // HYDROGEN_HAVE_CUDA
 
 template <Device D, Device... Ds>
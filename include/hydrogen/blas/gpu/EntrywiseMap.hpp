@@ -0,0 +1,68 @@
+#ifndef HYDROGEN_BLAS_GPU_ENTRYWISEMAP_HPP_
+#define HYDROGEN_BLAS_GPU_ENTRYWISEMAP_HPP_
+
+/** @file
+ *
+ *  Entrywise maps with user-provided callables cannot be precompiled, so
+ *  the kernels are templates which are only available within CUDA
+ *  translation units. The callable must be usable on the device (e.g., a
+ *  functor with a __host__ __device__ call operator); El::EntrywiseMap only
+ *  launches these kernels for callables which opt in through
+ *  El::IsDeviceMappable.
+ */
+
+#ifdef __CUDACC__
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+
+#include <hydrogen/device/gpu/CUDA.hpp>
+
+namespace hydrogen
+{
+
+template <typename S, typename T, typename Func>
+__global__ void EntrywiseMap_kernel(size_t height, size_t width, Func func,
+                                    S const* A, size_t lda,
+                                    T* B, size_t ldb)
+{
+    const size_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    const size_t numThreads = blockDim.x * gridDim.x;
+    for (size_t pos = tid; pos < height * width; pos += numThreads)
+    {
+        const size_t i = pos % height;
+        const size_t j = pos / height;
+        B[i+j*ldb] = func(A[i+j*lda]);
+    }
+}
+
+/** @brief Apply a device callable to each entry of a matrix on the GPU.
+ *
+ *  Writes `B(i,j) = func(A(i,j))`; A and B may be the same buffer.
+ */
+template <typename S, typename T, typename Func>
+void EntrywiseMap_GPU_impl(
+    size_t height, size_t width, Func func,
+    S const* A, size_t lda, T* B, size_t ldb,
+    cudaStream_t stream)
+{
+    if (height <= 0 || width <= 0)
+        return;
+
+    const size_t size = height * width;
+    constexpr size_t blockDim = 256;
+    // The kernel strides over the entries, so the grid can be capped
+    const size_t gridDim =
+        std::min((size + blockDim - 1) / blockDim, size_t(65535));
+    void* args[] = {&height, &width, &func, &A, &lda, &B, &ldb};
+    H_CHECK_CUDA(
+        cudaLaunchKernel(
+            (void const*)&EntrywiseMap_kernel<S, T, Func>,
+            dim3(gridDim), dim3(blockDim), args, 0, stream));
+}
+
+}// namespace hydrogen
+
+#endif // __CUDACC__
+#endif // HYDROGEN_BLAS_GPU_ENTRYWISEMAP_HPP_
@@ -0,0 +1,89 @@
+#ifndef HYDROGEN_BLAS_GPU_RANDOM_HPP_
+#define HYDROGEN_BLAS_GPU_RANDOM_HPP_
+
+#include <hydrogen/Device.hpp>
+#include <hydrogen/meta/MetaUtilities.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace hydrogen
+{
+
+/** @brief The global indices and Philox key of a counter-based random
+ *         matrix.
+ *
+ *  Local entry (i,j) is sampled from the random bits of global entry
+ *  (col_shift + i*col_stride, row_shift + j*row_stride), exactly as
+ *  El::philox::Entry generates them on the host, so that the host and
+ *  device fills of a matrix agree.
+ */
+struct RandomIndexing
+{
+    size_t col_shift, col_stride;
+    size_t row_shift, row_stride;
+    std::uint32_t key0, key1;
+    std::uint32_t tag;
+};
+
+/** @brief Fill a matrix with samples from a uniform distribution over
+ *         [center-radius,center+radius] on the GPU.
+ *
+ *  @param[in] height The number of rows in the matrix.
+ *  @param[in] width The number of columns in the matrix.
+ *  @param[in] center The center of the interval.
+ *  @param[in] radius The radius of the interval.
+ *  @param[in] indexing The global indices and key of the entries.
+ *  @param[out] buffer The matrix, in column-major ordering.
+ *  @param[in] ldim The leading dimension of the data in buffer.
+ *  @param[in] stream The CUDA stream on which the kernel should be
+ *      launched.
+ *
+ *  @throws std::logic_error If the type is not supported on GPU.
+ */
+template <typename T, typename=EnableWhen<std::is_floating_point<T>>>
+void UniformFill_GPU_impl(
+    size_t height, size_t width, T center, T radius,
+    RandomIndexing const& indexing,
+    T* buffer, size_t ldim, cudaStream_t stream);
+
+template <typename T,
+          typename=EnableUnless<std::is_floating_point<T>>,
+          typename=void>
+void UniformFill_GPU_impl(
+    size_t const&, size_t const&, T const&, T const&,
+    RandomIndexing const&,
+    T* const&, size_t const&, cudaStream_t const&)
+{
+    throw std::logic_error("UniformFill: Type not valid on GPU.");
+}
+
+/** @brief Fill a matrix with samples from a normal distribution on the
+ *         GPU (via the Box-Muller transform).
+ *
+ *  The parameters are as for UniformFill_GPU_impl, with the mean and
+ *  standard deviation of the distribution in place of its center and
+ *  radius.
+ */
+template <typename T, typename=EnableWhen<std::is_floating_point<T>>>
+void NormalFill_GPU_impl(
+    size_t height, size_t width, T mean, T stddev,
+    RandomIndexing const& indexing,
+    T* buffer, size_t ldim, cudaStream_t stream);
+
+template <typename T,
+          typename=EnableUnless<std::is_floating_point<T>>,
+          typename=void>
+void NormalFill_GPU_impl(
+    size_t const&, size_t const&, T const&, T const&,
+    RandomIndexing const&,
+    T* const&, size_t const&, cudaStream_t const&)
+{
+    throw std::logic_error("NormalFill: Type not valid on GPU.");
+}
+
+}// namespace hydrogen
+#endif // HYDROGEN_BLAS_GPU_RANDOM_HPP_
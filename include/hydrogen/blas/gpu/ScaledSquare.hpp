@@ -0,0 +1,58 @@
+#ifndef HYDROGEN_BLAS_GPU_SCALEDSQUARE_HPP_
+#define HYDROGEN_BLAS_GPU_SCALEDSQUARE_HPP_
+
+#include <hydrogen/Device.hpp>
+#include <hydrogen/meta/MetaUtilities.hpp>
+
+#include <cuda_runtime.h>
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace hydrogen
+{
+
+/** @brief The maximum number of partial sums written by
+ *         ScaledSquare_GPU_impl.
+ */
+constexpr size_t ScaledSquare_GPU_max_partials = 256;
+
+/** @brief Compute partial scaled sums of squares of a matrix on the GPU.
+ *
+ *  Each thread block reduces a strided subset of the entries to a pair
+ *  (scale, scaledSquare) whose sum of squares is
+ *  `scale*scale*scaledSquare`, as in LAPACK's xLASSQ, so that the result
+ *  neither overflows nor underflows. The pairs are to be combined on the
+ *  host.
+ *
+ *  @param[in] height The number of rows in the matrix.
+ *  @param[in] width The number of columns in the matrix.
+ *  @param[in] A The matrix, in column-major ordering.
+ *  @param[in] lda The leading dimension of A.
+ *  @param[out] partials A device buffer of at least
+ *      `2*ScaledSquare_GPU_max_partials` entries; partial k is stored in
+ *      entries 2k (its scale) and 2k+1 (its scaled square).
+ *  @param[in] stream The CUDA stream on which the kernel should be
+ *      launched.
+ *
+ *  @returns The number of partial sums written.
+ *
+ *  @throws std::logic_error If the type is not supported on GPU.
+ */
+template <typename T, typename=EnableWhen<std::is_floating_point<T>>>
+size_t ScaledSquare_GPU_impl(
+    size_t height, size_t width, T const* A, size_t lda,
+    T* partials, cudaStream_t stream);
+
+template <typename T,
+          typename=EnableUnless<std::is_floating_point<T>>,
+          typename=void>
+size_t ScaledSquare_GPU_impl(
+    size_t const&, size_t const&, T const* const&, size_t const&,
+    T* const&, cudaStream_t const&)
+{
+    throw std::logic_error("ScaledSquare: Type not valid on GPU.");
+}
+
+}// namespace hydrogen
+#endif // HYDROGEN_BLAS_GPU_SCALEDSQUARE_HPP_
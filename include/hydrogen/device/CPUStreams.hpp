@@ -0,0 +1,80 @@
+#ifndef HYDROGEN_DEVICE_CPUSTREAMS_HPP_
+#define HYDROGEN_DEVICE_CPUSTREAMS_HPP_
+
+#include <functional>
+
+/** @file
+ *
+ *  Asynchronous execution of host kernels, modeled on CUDA streams and
+ *  events. A stream is an in-order queue of tasks; the tasks of distinct
+ *  streams may run concurrently on a shared pool of worker threads. An
+ *  event marks a point in the queue of a stream, which other streams (or
+ *  the host) may wait on.
+ *
+ *  The size of the worker pool is given by the HYDROGEN_CPU_STREAM_THREADS
+ *  environment variable and defaults to the number of hardware threads.
+ *  The pool is started when the first stream is created, and each worker
+ *  runs OpenMP regions with its share of the threads of the creator.
+ */
+
+namespace hydrogen
+{
+
+struct CPUStream_;
+struct CPUEvent_;
+
+/** @brief A handle to an in-order queue of host tasks. */
+using cpuStream_t = CPUStream_*;
+
+/** @brief A handle to a point in the queue of a CPU stream. */
+using cpuEvent_t = CPUEvent_*;
+
+cpuStream_t CreateCPUStream();
+
+/** @brief Wait for the tasks of a stream to finish and then destroy it. */
+void DestroyCPUStream(cpuStream_t stream);
+
+cpuEvent_t CreateCPUEvent();
+void DestroyCPUEvent(cpuEvent_t event);
+
+/** @brief Append a task to the queue of a stream.
+ *
+ *  An exception thrown by the task is rethrown by the next
+ *  synchronization with the stream; the subsequent tasks still run.
+ */
+void CPUStreamEnqueue(cpuStream_t stream, std::function<void()> task);
+
+/** @brief Block until every task enqueued on a stream has finished. */
+void CPUStreamSynchronize(cpuStream_t stream);
+
+/** @brief Block like CPUStreamSynchronize, but leave an exception thrown
+ *         by a task to be rethrown by the next synchronization.
+ *
+ *  For paths which must not throw, such as the release of a buffer.
+ */
+void CPUStreamWait(cpuStream_t stream) noexcept;
+
+/** @brief Mark the current end of the queue of a stream with an event. */
+void CPUEventRecord(cpuEvent_t event, cpuStream_t stream);
+
+/** @brief Hold back the tasks subsequently enqueued on a stream until the
+ *         most recent recording of an event has been reached.
+ *
+ *  Waiting does not occupy a worker thread. Waiting on an event which has
+ *  never been recorded has no effect.
+ */
+void CPUStreamWaitEvent(cpuStream_t stream, cpuEvent_t event);
+
+/** @brief Block until the most recent recording of an event has been
+ *         reached.
+ */
+void CPUEventSynchronize(cpuEvent_t event);
+
+/** @brief Stop the worker pool once its tasks have finished.
+ *
+ *  Called by El::Finalize; every stream should have been destroyed.
+ */
+void FinalizeCPUStreams();
+
+}// namespace hydrogen
+#endif // HYDROGEN_DEVICE_CPUSTREAMS_HPP_
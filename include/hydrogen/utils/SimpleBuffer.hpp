@@ -10,14 +10,19 @@
 #endif // HYDROGEN_HAVE_CUDA
 
 #include <El/core/Memory/decl.hpp>
+#include <El/core/Workspace.hpp>
 
 #include <algorithm>
+#include <exception>
+#include <iostream>
 #include <vector>
 
 namespace hydrogen
 {
 
-// A simple data management class for temporary contiguous memory blocks
+// A simple data management class for temporary contiguous memory blocks.
+// Host buffers in the default memory mode which are created while an
+// El::WorkspaceScope is open are carved from the workspace arena.
 template <typename T, Device D>
 class simple_buffer
 {
@@ -34,7 +39,9 @@ public:
                            SyncInfo<D> const& = SyncInfo<D>{},
                            unsigned int mode = El::DefaultMemoryMode<D>());
     // Enable moves
-    simple_buffer(simple_buffer<T,D>&&) = default;
+    simple_buffer(simple_buffer<T,D>&&);
+
+    ~simple_buffer();
 
     // Disable copy
     simple_buffer(simple_buffer<T,D> const&) = delete;
@@ -49,10 +56,16 @@ public:
     T* data() noexcept;
     T const* data() const noexcept;
 
+private:
+    bool use_workspace(size_t size) const noexcept;
+    // Debug builds throw if the workspace is misused
+    void release_workspace();
+
 private:
     El::Memory<T,D> mem_;
     T* data_ = nullptr;
     size_t size_ = 0;
+    size_t workspace_bytes_ = 0;
 }; // class simple_buffer
 
 
@@ -94,10 +107,10 @@ void setBufferToValue(T* buffer, size_t size, T const& value,
 template <typename T, Device D>
 simple_buffer<T,D>::simple_buffer(
     size_t size, SyncInfo<D> const& syncInfo, unsigned int mode)
-    : mem_{size, mode, syncInfo},
-      data_{mem_.Buffer()},
-      size_{mem_.Size()}
-{}
+    : mem_{0, mode, syncInfo}
+{
+    allocate(size);
+}
 
 template <typename T, Device D>
 simple_buffer<T,D>::simple_buffer(
@@ -107,13 +120,80 @@ simple_buffer<T,D>::simple_buffer(
     details::setBufferToValue(this->data(), size, value, syncInfo);
 }
 
+template <typename T, Device D>
+simple_buffer<T,D>::simple_buffer(simple_buffer<T,D>&& other)
+    : mem_{std::move(other.mem_)},
+      data_{other.data_},
+      size_{other.size_},
+      workspace_bytes_{other.workspace_bytes_}
+{
+    other.data_ = nullptr;
+    other.size_ = 0;
+    other.workspace_bytes_ = 0;
+}
+
+template <typename T, Device D>
+simple_buffer<T,D>::~simple_buffer()
+{
+    try
+    {
+        release_workspace();
+    }
+    catch (std::exception const& e)
+    {
+        // Misuse of the workspace is reported rather than thrown out of a
+        // destructor
+        std::cerr << "Releasing a simple_buffer failed: " << e.what()
+                  << std::endl;
+    }
+}
+
 template <typename T, Device D>
 void simple_buffer<T,D>::allocate(size_t size)
 {
-    data_ = mem_.Require(size);
+    if (use_workspace(size))
+    {
+        if (size*sizeof(T) > workspace_bytes_)
+        {
+            release_workspace();
+            mem_.Empty();
+            data_ = static_cast<T*>(El::workspace::Allocate(size*sizeof(T)));
+            workspace_bytes_ = size*sizeof(T);
+        }
+    }
+    else
+    {
+        release_workspace();
+        data_ = mem_.Require(size);
+    }
     size_ = size;
 }
 
+template <typename T, Device D>
+bool simple_buffer<T,D>::use_workspace(size_t size) const noexcept
+{
+    return D == Device::CPU && size > 0
+        && mem_.Mode() == El::DefaultMemoryMode<Device::CPU>()
+        && El::workspace::Active();
+}
+
+template <typename T, Device D>
+void simple_buffer<T,D>::release_workspace()
+{
+    if (workspace_bytes_ > 0)
+    {
+        // The arena may hand the bytes out again right away, so wait
+        // for any kernels still enqueued on them
+        SynchronizeNoThrow(mem_.GetSyncInfo());
+        T* const data = data_;
+        size_t const bytes = workspace_bytes_;
+        data_ = nullptr;
+        size_ = 0;
+        workspace_bytes_ = 0;
+        El::workspace::Release(data, bytes);
+    }
+}
+
 template <typename T, Device D>
 size_t simple_buffer<T,D>::size() const noexcept
 {
@@ -21,19 +21,17 @@ void ColumnTwoNormsHelper
     const Int mLocal = ALoc.Height();
     const Int nLocal = ALoc.Width();
 
-    // TODO(poulson): Ensure that NaN's propagate
+    vector<local_norm::ScaledSum<Real>> sums(nLocal);
+    local_norm::ColumnSums
+    ( ALoc.LockedBuffer(), mLocal, nLocal, ALoc.LDim(),
+      local_norm::SquaresKernel(), sums.data() );
+
     Matrix<Real> localScales( nLocal, 1 ),
                  localScaledSquares( nLocal, 1 );
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
-        Real localScale{0};
-        Real localScaledSquare{1};
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(jLoc) = localScale;
-        localScaledSquares(jLoc) = localScaledSquare;
+        localScales(jLoc) = sums[jLoc].scale;
+        localScaledSquares(jLoc) = sums[jLoc].scaledSum;
     }
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
@@ -49,21 +47,20 @@ void ColumnTwoNormsHelper
     const Int mLocal = ARealLoc.Height();
     const Int nLocal = ARealLoc.Width();
 
-    // TODO(poulson): Ensure that NaN's propagate
+    vector<local_norm::ScaledSum<Real>> sums(nLocal), imagSums(nLocal);
+    local_norm::ColumnSums
+    ( ARealLoc.LockedBuffer(), mLocal, nLocal, ARealLoc.LDim(),
+      local_norm::SquaresKernel(), sums.data() );
+    local_norm::ColumnSums
+    ( AImagLoc.LockedBuffer(), mLocal, nLocal, AImagLoc.LDim(),
+      local_norm::SquaresKernel(), imagSums.data() );
+
     Matrix<Real> localScales( nLocal, 1 ), localScaledSquares( nLocal, 1 );
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
-        Real localScale{0};
-        Real localScaledSquare{1};
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( ARealLoc(iLoc,jLoc), localScale, localScaledSquare );
-        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            UpdateScaledSquare
-            ( AImagLoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(jLoc) = localScale;
-        localScaledSquares(jLoc) = localScaledSquare;
+        local_norm::Combine( sums[jLoc], imagSums[jLoc], local_norm::Square() );
+        localScales(jLoc) = sums[jLoc].scale;
+        localScaledSquares(jLoc) = sums[jLoc].scaledSum;
     }
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
@@ -81,8 +78,12 @@ void ColumnTwoNorms( const Matrix<Field>& X, Matrix<Base<Field>>& norms )
         Zero( norms );
         return;
     }
+    vector<local_norm::ScaledSum<Base<Field>>> sums(n);
+    local_norm::ColumnSums
+    ( X.LockedBuffer(), m, n, X.LDim(), local_norm::SquaresKernel(),
+      sums.data() );
     for( Int j=0; j<n; ++j )
-        norms(j) = blas::Nrm2( m, &X(0,j), 1 );
+        norms(j) = local_norm::Root( sums[j], local_norm::Square() );
 }
 
 template<typename Field>
@@ -33,9 +33,13 @@ void NormsFromScaledSquares
         const Real scale = scales(jLoc);
         if( scale != Real(0) )
         {
-            // Equilibrate our local scaled sum to the maximum scale
-            Real relScale = localScales(jLoc)/scale;
-            localScaledSquares(jLoc) *= relScale*relScale;
+            // Equilibrate our local scaled sum to the maximum scale; equal
+            // scales are not divided, so that infinite ones give Inf
+            if( localScales(jLoc) != scale )
+            {
+                Real relScale = localScales(jLoc)/scale;
+                localScaledSquares(jLoc) *= relScale*relScale;
+            }
         }
         else
             localScaledSquares(jLoc) = 0;
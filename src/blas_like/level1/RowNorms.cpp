@@ -21,18 +21,15 @@ void RowTwoNormsHelper
     const Int mLocal = ALoc.Height();
     const Int nLocal = ALoc.Width();
 
-    // TODO(poulson): Ensure that NaN's propagate
+    vector<local_norm::ScaledSum<Real>> sums(mLocal);
+    local_norm::RowSquares
+    ( ALoc.LockedBuffer(), mLocal, nLocal, ALoc.LDim(), sums.data() );
+
     Matrix<Real> localScales(mLocal,1 ), localScaledSquares(mLocal,1);
     for( Int iLoc=0; iLoc<mLocal; ++iLoc )
     {
-        Real localScale{0};
-        Real localScaledSquare{1};
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(iLoc) = localScale;
-        localScaledSquares(iLoc) = localScaledSquare;
+        localScales(iLoc) = sums[iLoc].scale;
+        localScaledSquares(iLoc) = sums[iLoc].scaledSum;
     }
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
@@ -50,8 +47,10 @@ void RowTwoNorms( const Matrix<Field>& A, Matrix<Base<Field>>& norms )
         Zero( norms );
         return;
     }
+    vector<local_norm::ScaledSum<Base<Field>>> sums(m);
+    local_norm::RowSquares( A.LockedBuffer(), m, n, A.LDim(), sums.data() );
     for( Int i=0; i<m; ++i )
-        norms(i) = blas::Nrm2( n, &A(i,0), A.LDim() );
+        norms(i) = local_norm::Root( sums[i], local_norm::Square() );
 }
 
 template<typename Field>
@@ -8,6 +8,7 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
+#include <El/core/Profiling.hpp>
 
 #include "./Gemv/Normal.hpp"
 #include "./Gemv/Transpose.hpp"
@@ -109,6 +110,8 @@ void Gemv
 #endif // HYDROGEN_DO_BOUNDS_CHECKING
 
     auto master_sync = SyncInfoFromMatrix(y);
+    AUTO_PROFILE_REGION(
+        D == Device::CPU ? "Gemv_impl.CPU" : "Gemv_impl.GPU", master_sync);
     auto SyncManager = MakeMultiSync(
         master_sync, SyncInfoFromMatrix(A), SyncInfoFromMatrix(x));
 
@@ -119,6 +122,7 @@ void Gemv
     const Int yDim = (transChar == 'N' ? m : n);
     const Int incx = (x.Width()==1 ? 1 : x.LDim());
     const Int incy = (y.Width()==1 ? 1 : y.LDim());
+    AddProfileBytes((m*n + xDim + 2*yDim)*sizeof(T));
     if (xDim != 0)
     {
         if (yDim != 0)
@@ -9,11 +9,14 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 #include "El/core/Profiling.hpp"
+#include <El/blas_like/level1/Copy/util.hpp>
 
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Tune.hpp"
+#include "./Gemm/Replicated.hpp"
 
 namespace El
 {
@@ -73,11 +76,22 @@ static void Gemm_impl(
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    AddProfileBytes((m*k + k*n + 2*m*n)*sizeof(T));
+    T const* ABuf = A.LockedBuffer();
+    T const* BBuf = B.LockedBuffer();
+    T* CBuf = C.Buffer();
+    const Int ldA = A.LDim(), ldB = B.LDim(), ldC = C.LDim();
 
-    blas::Gemm(transA, transB, m, n, k,
-               alpha, A.LockedBuffer(), A.LDim(),
-               B.LockedBuffer(), B.LDim(),
-               beta, C.Buffer(), C.LDim());
+    auto master_sync = SyncInfoFromMatrix(C);
+    auto SyncManager = MakeMultiSync(
+        master_sync, SyncInfoFromMatrix(A), SyncInfoFromMatrix(B));
+
+    RunOnStream(master_sync, [=]
+    {
+        blas::Gemm(transA, transB, m, n, k,
+                   alpha, ABuf, ldA, BBuf, ldB,
+                   beta, CBuf, ldC);
+    });
 }
 
 #ifdef HYDROGEN_HAVE_CUDA
@@ -95,6 +109,7 @@ static void Gemm_impl(
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    AddProfileBytes((m*k + k*n + 2*m*n)*sizeof(T));
 
     auto master_sync = SyncInfoFromMatrix(C);
     auto SyncManager = MakeMultiSync(
@@ -200,26 +215,14 @@ void Gemm
   GemmAlgorithm alg)
 {
     EL_DEBUG_CSE;
+    // The pack/unpack buffers of the redistributions within the
+    // algorithms below are strictly nested, so they can share a stack
+    WorkspaceScope workspace;
     Scale(beta, C);
-    if(orientA == NORMAL && orientB == NORMAL)
-    {
-        if(alg == GEMM_CANNON)
-            gemm::Cannon_NN(alpha, A, B, C);
-        else
-            gemm::SUMMA_NN(alpha, A, B, C, alg);
-    }
-    else if(orientA == NORMAL)
-    {
-        gemm::SUMMA_NT(orientB, alpha, A, B, C, alg);
-    }
-    else if(orientB == NORMAL)
-    {
-        gemm::SUMMA_TN(orientA, alpha, A, B, C, alg);
-    }
+    if(alg == GEMM_AUTO)
+        gemm::Tuned(orientA, orientB, alpha, A, B, C);
     else
-    {
-        gemm::SUMMA_TT(orientA, orientB, alpha, A, B, C, alg);
-    }
+        gemm::Dispatch(orientA, orientB, alpha, A, B, C, alg);
 }
 
 template<typename T>
@@ -236,6 +239,19 @@ void Gemm
     Gemm(orientA, orientB, alpha, A, B, TypeTraits<T>::Zero(), C, alg);
 }
 
+template<typename T>
+void Gemm25D
+(Orientation orientA, Orientation orientB,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C,
+  Int numLayers)
+{
+    EL_DEBUG_CSE
+    Scale(beta, C);
+    gemm::SUMMA_25D(orientA, orientB, alpha, A, B, C, numLayers);
+}
+
 template<typename T>
 void LocalGemm
 (Orientation orientA, Orientation orientB,
@@ -420,7 +436,13 @@ template void Gemm(Orientation orientA, Orientation orientB,
         Orientation orientA, Orientation orientB,       \
         T alpha, const Matrix<T,Device::CPU>& A,        \
         const Matrix<T,Device::CPU>& B,                 \
-        Matrix<T,Device::CPU>& C);
+        Matrix<T,Device::CPU>& C);                      \
+    template void Gemm25D(                              \
+        Orientation orientA, Orientation orientB,       \
+        T alpha, const AbstractDistMatrix<T>& A,        \
+        const AbstractDistMatrix<T>& B,                 \
+        T beta,        AbstractDistMatrix<T>& C,        \
+        Int numLayers);
 
 #ifdef HYDROGEN_GPU_USE_FP16
 ABSTRACT_PROTO(gpu_half_type);
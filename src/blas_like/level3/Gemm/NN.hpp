@@ -341,6 +341,206 @@ void SUMMA_NNC
 
 }
 
+// Pipelined variant of SUMMA_NNC
+//
+// Each panel of A (B) is gathered within process rows (columns) with one
+// nonblocking broadcast per contributing process. Two sets of buffers are
+// cycled so that the gathers of panel k+1 are in flight while the local
+// update with panel k is being performed.
+template <typename T>
+class NNCPanelPipeline
+{
+public:
+    NNCPanelPipeline
+    (const DistMatrix<T,MC,MR>& A,
+     const DistMatrix<T,MC,MR>& B,
+     Int bsize)
+    : A_(A), B_(B),
+      rowComm_(A.Grid().RowComm()), colComm_(A.Grid().ColComm()),
+      rowStride_(A.RowStride()), colStride_(B.ColStride()),
+      rowRank_(A.RowRank()), colRank_(B.ColRank()),
+      requestsA_(rowStride_), requestsB_(colStride_)
+    {
+        for(Int buffer=0; buffer<2; ++buffer)
+        {
+            recvA_[buffer].resize(A.LocalHeight()*bsize);
+            recvB_[buffer].resize(bsize*B.LocalWidth());
+        }
+    }
+
+    // Pack our portion of the panel and start the gathers
+    void Start(Int buffer, Int k, Int nb)
+    {
+        const Int localHeightA = A_.LocalHeight();
+        const Int localWidthB = B_.LocalWidth();
+        T* recvA = recvA_[buffer].data();
+        T* recvB = recvB_[buffer].data();
+
+        Int offset = 0;
+        for(Int q=0; q<rowStride_; ++q)
+        {
+            const Int shift = Shift(q, A_.RowAlign(), rowStride_);
+            const Int jLocBeg = Length(k, shift, rowStride_);
+            const Int nbLoc = Length(k+nb, shift, rowStride_) - jLocBeg;
+            if(q == rowRank_ && localHeightA > 0 && nbLoc > 0)
+                copy::util::InterleaveMatrix
+                (localHeightA, nbLoc,
+                 A_.LockedBuffer(0,jLocBeg), 1, A_.LDim(),
+                 &recvA[offset], 1, localHeightA,
+                 SyncInfo<Device::CPU>{});
+            mpi::IBroadcast
+            (&recvA[offset], localHeightA*nbLoc, q, rowComm_,
+             requestsA_[q]);
+            offset += localHeightA*nbLoc;
+        }
+
+        offset = 0;
+        for(Int q=0; q<colStride_; ++q)
+        {
+            const Int shift = Shift(q, B_.ColAlign(), colStride_);
+            const Int iLocBeg = Length(k, shift, colStride_);
+            const Int nbLoc = Length(k+nb, shift, colStride_) - iLocBeg;
+            if(q == colRank_ && nbLoc > 0 && localWidthB > 0)
+                copy::util::InterleaveMatrix
+                (nbLoc, localWidthB,
+                 B_.LockedBuffer(iLocBeg,0), 1, B_.LDim(),
+                 &recvB[offset], 1, nbLoc,
+                 SyncInfo<Device::CPU>{});
+            mpi::IBroadcast
+            (&recvB[offset], nbLoc*localWidthB, q, colComm_, requestsB_[q]);
+            offset += nbLoc*localWidthB;
+        }
+    }
+
+    // Wait on the gathers and unpack into A1[MC,*] and B1[*,MR] order
+    void Finish
+    (Int buffer, Int k, Int nb,
+     Matrix<T>& A1_MC_STAR, Matrix<T>& B1_STAR_MR)
+    {
+        mpi::WaitAll(rowStride_, requestsA_.data());
+        mpi::WaitAll(colStride_, requestsB_.data());
+
+        const Int localHeightA = A_.LocalHeight();
+        const Int localWidthB = B_.LocalWidth();
+        const T* recvA = recvA_[buffer].data();
+        const T* recvB = recvB_[buffer].data();
+        A1_MC_STAR.Resize(localHeightA, nb);
+        B1_STAR_MR.Resize(nb, localWidthB);
+
+        Int offset = 0;
+        for(Int q=0; q<rowStride_; ++q)
+        {
+            const Int shift = Shift(q, A_.RowAlign(), rowStride_);
+            const Int jLocBeg = Length(k, shift, rowStride_);
+            const Int nbLoc = Length(k+nb, shift, rowStride_) - jLocBeg;
+            if(localHeightA > 0 && nbLoc > 0)
+            {
+                const Int jFirst = shift + jLocBeg*rowStride_ - k;
+                copy::util::InterleaveMatrix
+                (localHeightA, nbLoc,
+                 &recvA[offset], 1, localHeightA,
+                 A1_MC_STAR.Buffer(0,jFirst),
+                 1, rowStride_*A1_MC_STAR.LDim(),
+                 SyncInfo<Device::CPU>{});
+            }
+            offset += localHeightA*nbLoc;
+        }
+
+        offset = 0;
+        for(Int q=0; q<colStride_; ++q)
+        {
+            const Int shift = Shift(q, B_.ColAlign(), colStride_);
+            const Int iLocBeg = Length(k, shift, colStride_);
+            const Int nbLoc = Length(k+nb, shift, colStride_) - iLocBeg;
+            if(nbLoc > 0 && localWidthB > 0)
+            {
+                const Int iFirst = shift + iLocBeg*colStride_ - k;
+                copy::util::InterleaveMatrix
+                (nbLoc, localWidthB,
+                 &recvB[offset], 1, nbLoc,
+                 B1_STAR_MR.Buffer(iFirst,0),
+                 colStride_, B1_STAR_MR.LDim(),
+                 SyncInfo<Device::CPU>{});
+            }
+            offset += nbLoc*localWidthB;
+        }
+    }
+
+private:
+    const DistMatrix<T,MC,MR>& A_;
+    const DistMatrix<T,MC,MR>& B_;
+    mpi::Comm const& rowComm_;
+    mpi::Comm const& colComm_;
+    const Int rowStride_, colStride_, rowRank_, colRank_;
+    vector<mpi::Request<T>> requestsA_, requestsB_;
+    vector<T> recvA_[2], recvB_[2];
+};
+
+template <typename T>
+void SUMMA_NNCPipelined_impl
+(T alpha,
+ AbstractDistMatrix<T> const& APre,
+ AbstractDistMatrix<T> const& BPre,
+ AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    AUTO_PROFILE_REGION("SUMMA.NNC.Pipelined", SyncInfo<Device::CPU>{});
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& C = CProx.Get();
+
+    // The gathered panels must line up with the local portion of C
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx(APre, ctrlA);
+    DistMatrixReadProxy<T,T,MC,MR> BProx(BPre, ctrlB);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    if(!C.Grid().InGrid() || sumDim == 0)
+        return;
+
+    NNCPanelPipeline<T> pipeline(A, B, bsize);
+    Matrix<T> A1_MC_STAR, B1_STAR_MR;
+
+    pipeline.Start(0, 0, Min(bsize,sumDim));
+    for(Int k=0, buffer=0; k<sumDim; k+=bsize, buffer=1-buffer)
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        const Int kNext = k+nb;
+        pipeline.Finish(buffer, k, nb, A1_MC_STAR, B1_STAR_MR);
+        if(kNext < sumDim)
+            pipeline.Start(1-buffer, kNext, Min(bsize,sumDim-kNext));
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        Gemm
+        (NORMAL, NORMAL, alpha, A1_MC_STAR, B1_STAR_MR,
+         TypeTraits<T>::One(), C.Matrix());
+    }
+}
+
+template<typename T>
+void SUMMA_NNCPipelined
+(T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+
+    // Only host-side buffers of MPI-native types can be broadcast without
+    // an intermediate serialization step
+    if(CPre.GetLocalDevice() != Device::CPU || !IsPacked<Base<T>>::value)
+    {
+        SUMMA_NNC(alpha, APre, BPre, CPre);
+        return;
+    }
+    SUMMA_NNCPipelined_impl(alpha, APre, BPre, CPre);
+}
+
 // Normal Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -484,6 +684,7 @@ void SUMMA_NN
     case GEMM_SUMMA_A:   SUMMA_NNA(alpha, A, B, C); break;
     case GEMM_SUMMA_B:   SUMMA_NNB(alpha, A, B, C); break;
     case GEMM_SUMMA_C:   SUMMA_NNC(alpha, A, B, C); break;
+    case GEMM_SUMMA_C_PIPELINED: SUMMA_NNCPipelined(alpha, A, B, C); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot(alpha, A, B, C, blockSizeDot); break;
     default: LogicError("Unsupported Gemm option");
     }
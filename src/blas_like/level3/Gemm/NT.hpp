@@ -349,6 +349,28 @@ void SUMMA_NTDot
     }
 }
 
+// Pipelined stationary-C for NT: op(B) is formed once, in the same [MC,MR]
+// distribution, so that its panels can be gathered as in the NN case
+template<typename T>
+void SUMMA_NTCPipelined
+(Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    if(CPre.GetLocalDevice() != Device::CPU || !IsPacked<Base<T>>::value)
+    {
+        SUMMA_NTC(orientB, alpha, APre, BPre, CPre);
+        return;
+    }
+    DistMatrix<T,MC,MR> BTrans(BPre.Grid());
+    BTrans.AlignRows(CPre.RowAlign());
+    Transpose(BPre, BTrans, orientB == ADJOINT);
+    SUMMA_NNCPipelined_impl(alpha, APre, BTrans, CPre);
+}
+
 template<typename T>
 void SUMMA_NT
 (Orientation orientB,
@@ -397,6 +419,9 @@ void SUMMA_NT
     case GEMM_SUMMA_A: SUMMA_NTA(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_B: SUMMA_NTB(orientB, alpha, A, B, C); break;
     case GEMM_SUMMA_C: SUMMA_NTC(orientB, alpha, A, B, C); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_NTCPipelined(orientB, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT: SUMMA_NTDot(orientB, alpha, A, B, C); break;
     default: LogicError("Unsupported Gemm option");
     }
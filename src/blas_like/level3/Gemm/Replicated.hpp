@@ -0,0 +1,202 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <map>
+#include <memory>
+
+namespace El {
+namespace gemm {
+
+// The layer grids (and depth communicator) for each number of layers that a
+// grid has been split into. They are cached as an attribute of the grid's
+// viewing communicator, so that they are built once per grid and freed
+// along with it.
+struct LayerGrids
+{
+    vector<std::unique_ptr<Grid>> grids;
+    mpi::Comm depthComm;
+};
+
+typedef std::map<Int,LayerGrids> LayerGridCache;
+
+inline int FreeLayerGridCache(MPI_Comm, int, void* attribute, void*)
+{
+    delete static_cast<LayerGridCache*>(attribute);
+    return MPI_SUCCESS;
+}
+
+inline LayerGridCache& GetLayerGridCache(const Grid& g)
+{
+    static int keyval = MPI_KEYVAL_INVALID;
+    if (keyval == MPI_KEYVAL_INVALID)
+        EL_CHECK_MPI_CALL(
+            MPI_Comm_create_keyval(
+                MPI_COMM_NULL_COPY_FN, FreeLayerGridCache, &keyval,
+                nullptr));
+
+    const MPI_Comm viewingComm = g.ViewingComm().GetMPIComm();
+    void* attribute;
+    int found;
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_get_attr(viewingComm, keyval, &attribute, &found));
+    if (found)
+        return *static_cast<LayerGridCache*>(attribute);
+
+    auto cache = new LayerGridCache;
+    EL_CHECK_MPI_CALL(MPI_Comm_set_attr(viewingComm, keyval, cache));
+    return *cache;
+}
+
+// Form the layer grids. Every process views every layer so that the
+// translations to and from C's grid can be performed collectively.
+inline const LayerGrids& GetLayerGrids(const Grid& g, Int numLayers)
+{
+    LayerGridCache& cache = GetLayerGridCache(g);
+    auto it = cache.find(numLayers);
+    if (it != cache.end())
+        return it->second;
+
+    LayerGrids& layers = cache[numLayers];
+    const int layerSize = g.Size() / numLayers;
+    const int layerHeight = Grid::DefaultHeight(layerSize);
+    mpi::Group viewingGroup;
+    mpi::CommGroup(g.ViewingComm(), viewingGroup);
+    layers.grids.resize(numLayers);
+    vector<int> owners(layerSize);
+    for (Int layer=0; layer<numLayers; ++layer)
+    {
+        for (int q=0; q<layerSize; ++q)
+            owners[q] = g.VCToViewing(layer*layerSize+q);
+        mpi::Group owningGroup;
+        mpi::Incl(viewingGroup, layerSize, owners.data(), owningGroup);
+        mpi::Comm viewers;
+        mpi::Dup(g.ViewingComm(), viewers);
+        layers.grids[layer].reset(
+            new Grid(std::move(viewers), owningGroup, layerHeight,
+                     COLUMN_MAJOR));
+        mpi::Free(owningGroup);
+    }
+    mpi::Free(viewingGroup);
+
+    // Process q of every layer shares the depth communicator q
+    if (g.InGrid())
+        mpi::Split
+        (g.VCComm(), g.VCRank() % layerSize, g.VCRank() / layerSize,
+         layers.depthComm);
+    return layers;
+}
+
+// 2.5D (replicated) SUMMA
+//
+// The p processes of C's grid are split into c layers of p/c processes
+// each, and each layer is given its own (viewing) grid. Layer l receives
+// the l'th slice of the summation dimension of op(A) and op(B), forms its
+// partial product with the standard SUMMA algorithms on the smaller grid,
+// and the c partial products are then summed along the depth dimension.
+//
+// Since every layer grid has the same shape, process i of each layer owns
+// the same portion of its partial product, so the depth reduction is a
+// single AllReduce of contiguous local buffers. Each layer then returns
+// 1/c of the columns of the sum to C's grid.
+template<typename T>
+void SUMMA_25D
+(Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  Int numLayers)
+{
+    EL_DEBUG_CSE
+    AUTO_PROFILE_REGION("SUMMA.25D", SyncInfo<Device::CPU>{});
+
+    if (CPre.GetLocalDevice() != Device::CPU)
+        LogicError("SUMMA_25D not implemented for device!");
+
+    const Grid& g = CPre.Grid();
+    const int p = g.Size();
+    if (numLayers < 1 || p % numLayers != 0)
+        LogicError
+        ("The number of layers, ",numLayers,
+         ", must evenly divide the grid size, ",p);
+
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int sumDim = (orientA == NORMAL ? APre.Width() : APre.Height());
+    if (numLayers == 1)
+    {
+        Dispatch(orientA, orientB, alpha, APre, BPre, CPre, GEMM_DEFAULT);
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx(APre);
+    DistMatrixReadProxy<T,T,MC,MR> BProx(BPre);
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx(CPre);
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const int layerSize = p / numLayers;
+    const LayerGrids& layers = GetLayerGrids(g, numLayers);
+    const auto& layerGrids = layers.grids;
+    const mpi::Comm& depthComm = layers.depthComm;
+    const int myLayer = (g.InGrid() ? g.VCRank() / layerSize : -1);
+
+    // Hand each layer its slice of the summation dimension and accumulate
+    // the partial products on the owning layer
+    vector<DistMatrix<T,MC,MR>> ALayers, BLayers, CLayers;
+    ALayers.reserve(numLayers);
+    BLayers.reserve(numLayers);
+    CLayers.reserve(numLayers);
+    for (Int layer=0; layer<numLayers; ++layer)
+    {
+        const Grid& layerGrid = *layerGrids[layer];
+        const Range<Int> ind(Min(layer*sumDim/numLayers, sumDim),
+                             Min((layer+1)*sumDim/numLayers, sumDim));
+        ALayers.emplace_back(layerGrid);
+        BLayers.emplace_back(layerGrid);
+        CLayers.emplace_back(layerGrid);
+        if (orientA == NORMAL)
+            ALayers.back() = A(ALL, ind);
+        else
+            ALayers.back() = A(ind, ALL);
+        if (orientB == NORMAL)
+            BLayers.back() = B(ind, ALL);
+        else
+            BLayers.back() = B(ALL, ind);
+        CLayers.back().Resize(m, n);
+        Zero(CLayers.back());
+    }
+    if (myLayer >= 0)
+    {
+        auto& CLayer = CLayers[myLayer];
+        const Int layerSumDim =
+            (orientA == NORMAL ? ALayers[myLayer].Width()
+                               : ALayers[myLayer].Height());
+        if (layerSumDim != 0)
+            Dispatch
+            (orientA, orientB, alpha, ALayers[myLayer], BLayers[myLayer],
+             CLayer, GEMM_DEFAULT);
+        AllReduce(CLayer.Matrix(), depthComm, mpi::SUM);
+    }
+
+    // Return 1/c of the columns of the sum from each layer
+    DistMatrix<T,MC,MR> D1(g);
+    for (Int layer=0; layer<numLayers; ++layer)
+    {
+        const Range<Int> ind(Min(layer*n/numLayers, n),
+                             Min((layer+1)*n/numLayers, n));
+        auto C1 = C(ALL, ind);
+        D1.AlignWith(C1);
+        D1 = CLayers[layer](ALL, ind);
+        Axpy(TypeTraits<T>::One(), D1, C1);
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -346,6 +346,28 @@ void SUMMA_TNDot
     }
 }
 
+// Pipelined stationary-C for TN: op(A) is formed once, in the same [MC,MR]
+// distribution, so that its panels can be gathered as in the NN case
+template<typename T>
+void SUMMA_TNCPipelined
+(Orientation orientA,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    if(CPre.GetLocalDevice() != Device::CPU || !IsPacked<Base<T>>::value)
+    {
+        SUMMA_TNC(orientA, alpha, APre, BPre, CPre);
+        return;
+    }
+    DistMatrix<T,MC,MR> ATrans(APre.Grid());
+    ATrans.AlignCols(CPre.ColAlign());
+    Transpose(APre, ATrans, orientA == ADJOINT);
+    SUMMA_NNCPipelined_impl(alpha, ATrans, BPre, CPre);
+}
+
 template<typename T>
 void SUMMA_TN
 (Orientation orientA,
@@ -394,6 +416,9 @@ void SUMMA_TN
     case GEMM_SUMMA_A: SUMMA_TNA(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_B: SUMMA_TNB(orientA, alpha, A, B, C); break;
     case GEMM_SUMMA_C: SUMMA_TNC(orientA, alpha, A, B, C); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_TNCPipelined(orientA, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT: SUMMA_TNDot(orientA, alpha, A, B, C); break;
     default: LogicError("Unsupported Gemm option");
     }
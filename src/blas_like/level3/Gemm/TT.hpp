@@ -375,6 +375,32 @@ void SUMMA_TTDot
     }
 }
 
+// Pipelined stationary-C for TT: op(A) and op(B) are formed once, in the
+// same [MC,MR] distribution, so that their panels can be gathered as in the
+// NN case
+template<typename T>
+void SUMMA_TTCPipelined
+(Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre)
+{
+    EL_DEBUG_CSE
+    if(CPre.GetLocalDevice() != Device::CPU || !IsPacked<Base<T>>::value)
+    {
+        SUMMA_TTC(orientA, orientB, alpha, APre, BPre, CPre);
+        return;
+    }
+    DistMatrix<T,MC,MR> ATrans(APre.Grid()), BTrans(BPre.Grid());
+    ATrans.AlignCols(CPre.ColAlign());
+    BTrans.AlignRows(CPre.RowAlign());
+    Transpose(APre, ATrans, orientA == ADJOINT);
+    Transpose(BPre, BTrans, orientB == ADJOINT);
+    SUMMA_NNCPipelined_impl(alpha, ATrans, BTrans, CPre);
+}
+
 template<typename T>
 void SUMMA_TT
 (Orientation orientA,
@@ -429,6 +455,9 @@ void SUMMA_TT
     case GEMM_SUMMA_C:
         SUMMA_TTC(orientA, orientB, alpha, A, B, C);
         break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_TTCPipelined(orientA, orientB, alpha, A, B, C);
+        break;
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot(orientA, orientB, alpha, A, B, C);
         break;
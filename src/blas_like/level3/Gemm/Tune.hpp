@@ -0,0 +1,341 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+
+namespace El {
+namespace gemm {
+
+// Forward a distributed Gemm to the requested SUMMA (or Cannon) variant
+template <typename T>
+void Dispatch
+(Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C,
+  GemmAlgorithm alg)
+{
+    EL_DEBUG_CSE
+    if(orientA == NORMAL && orientB == NORMAL)
+    {
+        if(alg == GEMM_CANNON)
+            Cannon_NN(alpha, A, B, C);
+        else
+            SUMMA_NN(alpha, A, B, C, alg);
+    }
+    else if(orientA == NORMAL)
+    {
+        SUMMA_NT(orientB, alpha, A, B, C, alg);
+    }
+    else if(orientB == NORMAL)
+    {
+        SUMMA_TN(orientA, alpha, A, B, C, alg);
+    }
+    else
+    {
+        SUMMA_TT(orientA, orientB, alpha, A, B, C, alg);
+    }
+}
+
+namespace tune {
+
+// The tuning table maps a problem description onto the algorithm which was
+// fastest the first time that problem was seen. If a tuning file was
+// specified (either through SetGemmTuningFile or the
+// HYDROGEN_GEMM_TUNING_FILE environment variable), the table is loaded from
+// it on first use and each newly tuned entry is appended to it.
+struct Table
+{
+    bool loaded=false;
+    bool fileSet=false;
+    string filename;
+    std::map<string,GemmAlgorithm> entries;
+};
+
+inline Table& TheTable()
+{
+    static Table table;
+    return table;
+}
+
+inline string AlgorithmToString(GemmAlgorithm alg)
+{
+    switch(alg)
+    {
+    case GEMM_SUMMA_A:   return "SUMMA_A";
+    case GEMM_SUMMA_B:   return "SUMMA_B";
+    case GEMM_SUMMA_C:   return "SUMMA_C";
+    case GEMM_SUMMA_DOT: return "SUMMA_DOT";
+    case GEMM_CANNON:    return "CANNON";
+    case GEMM_SUMMA_C_PIPELINED: return "SUMMA_C_PIPELINED";
+    default:             return "DEFAULT";
+    }
+}
+
+inline GemmAlgorithm StringToAlgorithm(const string& name)
+{
+    if(name == "SUMMA_A")   return GEMM_SUMMA_A;
+    if(name == "SUMMA_B")   return GEMM_SUMMA_B;
+    if(name == "SUMMA_C")   return GEMM_SUMMA_C;
+    if(name == "SUMMA_DOT") return GEMM_SUMMA_DOT;
+    if(name == "CANNON")    return GEMM_CANNON;
+    if(name == "SUMMA_C_PIPELINED") return GEMM_SUMMA_C_PIPELINED;
+    return GEMM_DEFAULT;
+}
+
+inline const string& Filename()
+{
+    auto& table = TheTable();
+    if(!table.fileSet)
+    {
+        const char* env = std::getenv("HYDROGEN_GEMM_TUNING_FILE");
+        if(env)
+            table.filename = env;
+        table.fileSet = true;
+    }
+    return table.filename;
+}
+
+// Each line of a tuning file is "<algorithm> <key>"; malformed lines and
+// unknown algorithms are ignored so that stale files degrade gracefully.
+// Entries already in the table are overwritten by those in the file, so
+// reloading merges in whatever other processes have appended since.
+inline void Reload()
+{
+    auto& table = TheTable();
+    table.loaded = true;
+
+    const string& filename = Filename();
+    if(filename.empty())
+        return;
+    std::ifstream file(filename);
+    if(!file.is_open())
+        return;
+
+    string line;
+    while(std::getline(file, line))
+    {
+        const auto split = line.find(' ');
+        if(split == string::npos)
+            continue;
+        const GemmAlgorithm alg = StringToAlgorithm(line.substr(0, split));
+        if(alg == GEMM_DEFAULT)
+            continue;
+        table.entries[line.substr(split+1)] = alg;
+    }
+}
+
+inline void Load()
+{
+    if(!TheTable().loaded)
+        Reload();
+}
+
+inline GemmAlgorithm Lookup(const string& key)
+{
+    Load();
+    auto& entries = TheTable().entries;
+    auto it = entries.find(key);
+    if(it == entries.end())
+    {
+        // Another grid may have tuned this problem since the file was read
+        Reload();
+        it = entries.find(key);
+    }
+    return it == entries.end() ? GEMM_DEFAULT : it->second;
+}
+
+// Each entry is appended with a single write to a file opened in append
+// mode, so entries from the roots of different grids do not interleave.
+inline void Record(const string& key, GemmAlgorithm alg, bool persist)
+{
+    TheTable().entries[key] = alg;
+
+    const string& filename = Filename();
+    if(!persist || filename.empty())
+        return;
+    std::ofstream file(filename, std::ios::app);
+    if(!file.is_open())
+    {
+        RuntimeError("Could not open Gemm tuning file ", filename);
+    }
+    const string line = BuildString(AlgorithmToString(alg), ' ', key, '\n');
+    file.write(line.data(), line.size());
+    file.flush();
+}
+
+template <typename T>
+string Key
+(Orientation orientA, Orientation orientB,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+  const AbstractDistMatrix<T>& C)
+{
+    const Grid& g = C.Grid();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    return BuildString
+        (OrientationToChar(orientA), OrientationToChar(orientB), ' ',
+         C.Height(), 'x', C.Width(), 'x', k, ' ',
+         g.Height(), 'x', g.Width(), ' ',
+         "nb=", Blocksize(), ' ',
+         DistToString(A.ColDist()), ',', DistToString(A.RowDist()), ' ',
+         DistToString(B.ColDist()), ',', DistToString(B.RowDist()), ' ',
+         DistToString(C.ColDist()), ',', DistToString(C.RowDist()), ' ',
+         (C.GetLocalDevice() == Device::CPU ? "CPU" : "GPU"), ' ',
+         TypeName<T>());
+}
+
+template <typename T>
+void SynchronizeLocal(const AbstractDistMatrix<T>& A)
+{
+    switch(A.GetLocalDevice())
+    {
+    case Device::CPU:
+        Synchronize(
+            SyncInfoFromMatrix(
+                static_cast<Matrix<T,Device::CPU> const&>(A.LockedMatrix())));
+        break;
+#ifdef HYDROGEN_HAVE_CUDA
+    case Device::GPU:
+        Synchronize(
+            SyncInfoFromMatrix(
+                static_cast<Matrix<T,Device::GPU> const&>(A.LockedMatrix())));
+        break;
+#endif // HYDROGEN_HAVE_CUDA
+    default:
+        LogicError("SynchronizeLocal: Bad device.");
+    }
+}
+
+// The variants that are worth timing for the given problem. The dot-product
+// variants are only competitive when the inner dimension dominates, the
+// pipelined variant is only implemented on the CPU, and Cannon's algorithm
+// is only implemented for NN on the CPU with a square grid.
+template <typename T>
+vector<GemmAlgorithm> Candidates
+(Orientation orientA, Orientation orientB,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& C)
+{
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = (orientA == NORMAL ? A.Width() : A.Height());
+    const double weightAwayFromDot = 10.;
+
+    vector<GemmAlgorithm> algs = { GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_C };
+    if(weightAwayFromDot*m <= k && weightAwayFromDot*n <= k)
+        algs.push_back(GEMM_SUMMA_DOT);
+
+    const Grid& g = C.Grid();
+    if(C.GetLocalDevice() == Device::CPU)
+    {
+        algs.push_back(GEMM_SUMMA_C_PIPELINED);
+        if(orientA == NORMAL && orientB == NORMAL &&
+           g.Height() == g.Width() && k % g.Height() == 0)
+            algs.push_back(GEMM_CANNON);
+    }
+    return algs;
+}
+
+} // namespace tune
+
+// Select the algorithm for this problem from the tuning table, or, on the
+// first encounter, time every candidate variant and remember the fastest.
+// Only the root of the grid consults the table; its decision is broadcast so
+// that every process either dispatches directly or joins the timing loop.
+// Each candidate is run once untimed, to warm up caches and communicators,
+// and then timed several times, keeping the best max-reduced time. The
+// candidates accumulate into a zeroed scratch copy of C, whose final
+// contents are then added into C, so tuning does not require an additional
+// multiplication.
+template <typename T>
+void Tuned
+(Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C)
+{
+    EL_DEBUG_CSE
+    const Grid& g = C.Grid();
+    const string key = tune::Key(orientA, orientB, A, B, C);
+    const bool isRoot = (mpi::Rank(g.Comm()) == 0);
+
+    int tunedAlg = GEMM_DEFAULT;
+    if(isRoot)
+        tunedAlg = tune::Lookup(key);
+    mpi::Broadcast(tunedAlg, 0, g.Comm(), SyncInfo<Device::CPU>{});
+    if(tunedAlg != GEMM_DEFAULT)
+    {
+        Dispatch(orientA, orientB, alpha, A, B, C,
+                 static_cast<GemmAlgorithm>(tunedAlg));
+        return;
+    }
+
+    std::unique_ptr<AbstractDistMatrix<T>>
+        CTrial(C.Construct(g, C.Root()));
+    CTrial->AlignWith(C.DistData());
+    CTrial->Resize(C.Height(), C.Width());
+
+    const Int numTimedRuns = 3;
+    GemmAlgorithm bestAlg = GEMM_DEFAULT;
+    double bestTime = std::numeric_limits<double>::max();
+    Timer timer;
+    for(const auto alg : tune::Candidates(orientA, orientB, A, C))
+    {
+        Zero(*CTrial);
+        Dispatch(orientA, orientB, alpha, A, B, *CTrial, alg);
+        for(Int run=0; run<numTimedRuns; ++run)
+        {
+            Zero(*CTrial);
+            tune::SynchronizeLocal(*CTrial);
+            mpi::Barrier(g.Comm());
+            timer.Start();
+            Dispatch(orientA, orientB, alpha, A, B, *CTrial, alg);
+            tune::SynchronizeLocal(*CTrial);
+            double runTime = timer.Stop();
+            runTime =
+                mpi::AllReduce(runTime, mpi::MAX, g.Comm(),
+                               SyncInfo<Device::CPU>{});
+            if(runTime < bestTime)
+            {
+                bestTime = runTime;
+                bestAlg = alg;
+            }
+        }
+    }
+    Axpy(TypeTraits<T>::One(), *CTrial, C);
+
+    tune::Record(key, bestAlg, isRoot);
+}
+
+} // namespace gemm
+
+void SetGemmTuningFile(const string& filename)
+{
+    auto& table = gemm::tune::TheTable();
+    table.filename = filename;
+    table.fileSet = true;
+    table.loaded = false;
+}
+
+const string& GemmTuningFile()
+{ return gemm::tune::Filename(); }
+
+void ClearGemmTuningTable()
+{
+    auto& table = gemm::tune::TheTable();
+    table.entries.clear();
+    table.loaded = false;
+}
+
+} // namespace El
@@ -415,6 +415,7 @@ ElementalMatrix<T>::Attach(
 {
     // TODO(poulson): Assert that the local dimensions are correct
     Attach(height, width, g, colAlign, rowAlign, A.Buffer(), A.LDim(), root);
+    ShareSyncInfo(this->Matrix(), A);
 }
 
 template <typename T>
@@ -426,6 +427,7 @@ ElementalMatrix<T>::Attach(const El::Grid& g, El::Matrix<T>& A)
     if (g.Size() != 1)
         LogicError("Assumed a grid size of one");
     Attach(A.Height(), A.Width(), g, 0, 0, A.Buffer(), A.LDim());
+    ShareSyncInfo(this->Matrix(), A);
 }
 
 template <typename T>
@@ -481,6 +483,7 @@ ElementalMatrix<T>::LockedAttach(
     LockedAttach(
         height, width, g, colAlign, rowAlign,
         A.LockedBuffer(), A.LDim(), root);
+    ShareSyncInfo(this->Matrix(), A);
 }
 
 template <typename T>
@@ -491,6 +494,7 @@ ElementalMatrix<T>::LockedAttach(const El::Grid& g, const El::Matrix<T>& A)
     if (g.Size() != 1)
         LogicError("Assumed a grid size of one");
     LockedAttach(A.Height(), A.Width(), g, 0, 0, A.LockedBuffer(), A.LDim());
+    ShareSyncInfo(this->Matrix(), A);
 }
 
 // Operator overloading
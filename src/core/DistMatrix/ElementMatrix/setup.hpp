@@ -647,6 +647,112 @@ EL_NO_RELEASE_EXCEPT
 
 // Batch remote updates
 // --------------------
+namespace remote_entries
+{
+
+// The number of threads which should split the processing of n entries
+inline int NumThreads(Int n)
+{
+#ifdef EL_HYBRID
+    const Int minEntriesPerThread = 4096;
+    return int(Max(Min(Int(omp_get_max_threads()),n/minEntriesPerThread),
+                   Int(1)));
+#else
+    return 1;
+#endif
+}
+
+// A stable counting sort of entries by their bucket: on exit, counts[q] is
+// the number of entries in bucket q and positions[k] is the position of the
+// k'th entry within the sorted order. Each thread counts and places the
+// entries of a contiguous chunk.
+inline void Bucket
+(vector<int> const& buckets, int numBuckets,
+ vector<int>& counts, vector<Int>& positions)
+{
+    const Int n = buckets.size();
+    const int numChunks = NumThreads(n);
+    const Int chunkSize = (n+numChunks-1)/numChunks;
+    vector<Int> chunkOffs(numChunks*numBuckets,0);
+    EL_PARALLEL_FOR
+    for(int c=0; c<numChunks; ++c)
+    {
+        Int* offs = &chunkOffs[c*numBuckets];
+        const Int kEnd = Min((c+1)*chunkSize,n);
+        for(Int k=c*chunkSize; k<kEnd; ++k)
+            ++offs[buckets[k]];
+    }
+    counts.assign(numBuckets,0);
+    Int off = 0;
+    for(int q=0; q<numBuckets; ++q)
+    {
+        for(int c=0; c<numChunks; ++c)
+        {
+            const Int count = chunkOffs[q+c*numBuckets];
+            chunkOffs[q+c*numBuckets] = off;
+            off += count;
+            counts[q] += count;
+        }
+    }
+    positions.resize(n);
+    EL_PARALLEL_FOR
+    for(int c=0; c<numChunks; ++c)
+    {
+        Int* offs = &chunkOffs[c*numBuckets];
+        const Int kEnd = Min((c+1)*chunkSize,n);
+        for(Int k=c*chunkSize; k<kEnd; ++k)
+            positions[k] = offs[buckets[k]]++;
+    }
+}
+
+// Sorts the indices within each bucket and removes the repeated ones,
+// compacting the buckets and their counts; on exit, where[p] is the new
+// position of the index which was at position p.
+inline void UniqueWithinBuckets
+(vector<int>& counts, vector<Int>& indices, vector<Int>& where)
+{
+    const int numBuckets = counts.size();
+    vector<int> offs;
+    Scan(counts, offs);
+    where.resize(indices.size());
+    vector<vector<Int>> uniques(numBuckets);
+    EL_PARALLEL_FOR
+    for(int q=0; q<numBuckets; ++q)
+    {
+        const Int* bucketIndices = &indices[offs[q]];
+        Int* bucketWhere = &where[offs[q]];
+        vector<Int> order(counts[q]);
+        std::iota(order.begin(), order.end(), Int(0));
+        std::sort(
+            order.begin(), order.end(),
+            [&](Int p0, Int p1)
+            { return bucketIndices[p0] < bucketIndices[p1]; });
+        auto& unique = uniques[q];
+        for(const Int p : order)
+        {
+            if (unique.empty() || unique.back() != bucketIndices[p])
+                unique.push_back(bucketIndices[p]);
+            bucketWhere[p] = unique.size()-1;
+        }
+    }
+    const Int totalSize = indices.size();
+    for(int q=0; q<numBuckets; ++q)
+        counts[q] = uniques[q].size();
+    vector<int> uniqueOffs;
+    indices.resize(Scan(counts, uniqueOffs));
+    EL_PARALLEL_FOR
+    for(int q=0; q<numBuckets; ++q)
+    {
+        std::copy(uniques[q].begin(), uniques[q].end(),
+                  &indices[uniqueOffs[q]]);
+        const Int pEnd = (q+1 < numBuckets ? offs[q+1] : totalSize);
+        for(Int p=offs[q]; p<pEnd; ++p)
+            where[p] += uniqueOffs[q];
+    }
+}
+
+} // namespace remote_entries
+
 template <typename T, Device D>
 void DM::Reserve(Int numRemoteUpdates)
 {
@@ -681,70 +787,136 @@ void DM::ProcessQueues(bool includeViewers)
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
-    const Int totalSend = remoteUpdates_.size();
-    LogicError("Test.");
+    const Int totalQueued = remoteUpdates_.size();
 
     // We will first push to redundant rank 0
     const int redundantRoot = 0;
 
-    // Compute the metadata
-    // ====================
+    // Every member of the communicator takes part in the exchange, including
+    // those which do not own any of the matrix (e.g., the non-root members
+    // of a [CIRC,CIRC] matrix)
     mpi::Comm const& comm
         = (includeViewers ? grid.ViewingComm() : grid.VCComm());
-    vector<int> sendCounts, owners(totalSend);
-    if (includeViewers)
-    {
-        const int viewingSize = mpi::Size(grid.ViewingComm());
-        sendCounts.resize(viewingSize,0);
-        for(Int k=0; k<totalSend; ++k)
-        {
-            const Entry<T>& entry = remoteUpdates_[k];
-            const int distOwner = this->Owner(entry.i,entry.j);
-            const int vcOwner =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            owners[k] = grid.VCToViewing(vcOwner);
-            ++sendCounts[owners[k]];
-        }
-    }
-    else
+    if (!includeViewers && !grid.InGrid())
+        return;
+    const int commSize = mpi::Size(comm);
+
+    // Compute the metadata
+    // ====================
+    // Each update is sent as the index of its entry within the local matrix
+    // of its owner (with the local rows padded to the maximum local height)
+    const Int maxLocalHeight =
+        Max(MaxLength(this->Height(),this->ColStride()),Int(1));
+    vector<int> owners(totalQueued);
+    vector<Int> indices(totalQueued);
+    EL_PARALLEL_FOR
+    for(Int k=0; k<totalQueued; ++k)
     {
-        if (!this->Participating())
-            return;
-        const int vcSize = mpi::Size(grid.VCComm());
-        sendCounts.resize(vcSize,0);
-        for(Int k=0; k<totalSend; ++k)
-        {
-            const Entry<T>& entry = remoteUpdates_[k];
-            const int distOwner = this->Owner(entry.i,entry.j);
-            owners[k] =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            ++sendCounts[owners[k]];
-        }
+        const Entry<T>& entry = remoteUpdates_[k];
+        const int rowOwner = this->RowOwner(entry.i);
+        const int colOwner = this->ColOwner(entry.j);
+        const int vcOwner =
+          grid.CoordsToVC(
+              colDist,rowDist,rowOwner+colOwner*this->ColStride(),
+              this->Root(),redundantRoot);
+        owners[k] = (includeViewers ? grid.VCToViewing(vcOwner) : vcOwner);
+        indices[k] = this->LocalRowOffset(entry.i,rowOwner) +
+          this->LocalColOffset(entry.j,colOwner)*maxLocalHeight;
     }
 
     // Pack the data
     // =============
-    vector<int> sendOffs;
-    Scan(sendCounts, sendOffs);
-    vector<Entry<T>> sendBuf(totalSend);
-    auto offs = sendOffs;
-    for(Int k=0; k<totalSend; ++k)
-        sendBuf[offs[owners[k]]++] = remoteUpdates_[k];
+    // The updates of each entry are summed so that it is only sent once
+    vector<int> sendCounts;
+    vector<Int> positions;
+    remote_entries::Bucket(owners, commSize, sendCounts, positions);
+    SwapClear(owners);
+    vector<Int> sendIndices(totalQueued);
+    EL_PARALLEL_FOR
+    for(Int k=0; k<totalQueued; ++k)
+        sendIndices[positions[k]] = indices[k];
+    SwapClear(indices);
+    vector<Int> where;
+    remote_entries::UniqueWithinBuckets(sendCounts, sendIndices, where);
+    vector<T> sendValues(sendIndices.size(), T(0));
+    for(Int k=0; k<totalQueued; ++k)
+        sendValues[where[positions[k]]] += remoteUpdates_[k].value;
     SwapClear(remoteUpdates_);
 
     // Exchange and unpack the data
     // ============================
     SyncInfo<Device::CPU> cpu_si;
-    auto recvBuf = mpi::AllToAll(sendBuf, sendCounts, sendOffs, comm);
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast(recvBufSize, redundantRoot, RedundantComm(), cpu_si);
-    recvBuf.resize(recvBufSize);
-    mpi::Broadcast(
-        recvBuf.data(), recvBufSize, redundantRoot, RedundantComm(), cpu_si);
-    // TODO: Make this loop faster
-    for(const auto& entry : recvBuf)
-        UpdateLocal(this->LocalRow(entry.i), this->LocalCol(entry.j),
-                    entry.value);
+    vector<int> sendOffs, recvCounts(commSize), recvOffs;
+    Scan(sendCounts, sendOffs);
+    mpi::AllToAll(sendCounts.data(), 1, recvCounts.data(), 1, comm, cpu_si);
+    Int totalRecv = Scan(recvCounts, recvOffs);
+    vector<Int> recvIndices(totalRecv);
+    vector<T> recvValues(totalRecv);
+    mpi::SparseAllToAll(
+        sendIndices, sendCounts, sendOffs,
+        recvIndices, recvCounts, recvOffs, comm);
+    mpi::SparseAllToAll(
+        sendValues, sendCounts, sendOffs,
+        recvValues, recvCounts, recvOffs, comm);
+    if (!this->Participating())
+        return;
+    if (RedundantSize() > 1)
+    {
+        mpi::Broadcast(totalRecv, redundantRoot, RedundantComm(), cpu_si);
+        recvIndices.resize(totalRecv);
+        recvValues.resize(totalRecv);
+        mpi::Broadcast(
+            recvIndices.data(), totalRecv, redundantRoot, RedundantComm(),
+            cpu_si);
+        mpi::Broadcast(
+            recvValues.data(), totalRecv, redundantRoot, RedundantComm(),
+            cpu_si);
+    }
+
+    if (D != Device::CPU)
+    {
+        for(Int k=0; k<totalRecv; ++k)
+            UpdateLocal(
+                recvIndices[k] % maxLocalHeight,
+                recvIndices[k] / maxLocalHeight, recvValues[k]);
+        return;
+    }
+
+    // The updates from different processes may share entries, so each
+    // thread applies the updates within its own range of local columns
+    T* buffer = matrix_.Buffer();
+    const Int ldim = matrix_.LDim();
+    const Int localWidth = this->LocalWidth();
+    const int numThreads = remote_entries::NumThreads(totalRecv);
+    vector<int> threadCounts(1,totalRecv);
+    vector<Int> order;
+    if (numThreads > 1)
+    {
+        vector<int> threads(totalRecv);
+        EL_PARALLEL_FOR
+        for(Int k=0; k<totalRecv; ++k)
+            threads[k] =
+              int((recvIndices[k]/maxLocalHeight)*numThreads/localWidth);
+        remote_entries::Bucket(threads, numThreads, threadCounts, positions);
+        order.resize(totalRecv);
+        EL_PARALLEL_FOR
+        for(Int k=0; k<totalRecv; ++k)
+            order[positions[k]] = k;
+    }
+    vector<int> threadOffs;
+    Scan(threadCounts, threadOffs);
+    EL_PARALLEL_FOR
+    for(int t=0; t<int(threadCounts.size()); ++t)
+    {
+        const Int kEnd = threadOffs[t] + threadCounts[t];
+        for(Int p=threadOffs[t]; p<kEnd; ++p)
+        {
+            const Int k = (order.empty() ? p : order[p]);
+            const Int iLoc = recvIndices[k] % maxLocalHeight;
+            const Int jLoc = recvIndices[k] / maxLocalHeight;
+            buffer[iLoc+jLoc*ldim] += recvValues[k];
+        }
+    }
 }
 
 template <typename T, Device D>
@@ -769,87 +941,94 @@ void DM::ProcessPullQueue(T* pullBuf, bool includeViewers) const
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
     const int root = this->Root();
-    const Int totalRecv = remotePulls_.size();
-
-    LogicError("Test.");
+    const Int totalPulls = remotePulls_.size();
 
-    // Compute the metadata
-    // ====================
     mpi::Comm const& comm
         = (includeViewers ? grid.ViewingComm() : grid.VCComm());
+    if (!includeViewers && !grid.InGrid())
+        return;
     int const commSize = comm.Size();
-    vector<int> recvCounts, owners(totalRecv);
-    if (includeViewers)
-    {
-        recvCounts.resize(commSize,0);
-        for(Int k=0; k<totalRecv; ++k)
-        {
-            const auto& valueInt = remotePulls_[k];
-            const Int i = valueInt.value;
-            const Int j = valueInt.index;
-            const int distOwner = this->Owner(i,j);
-            const int vcOwner = grid.CoordsToVC(colDist,rowDist,distOwner,root);
-            const int owner = grid.VCToViewing(vcOwner);
-            owners[k] = owner;
-            ++recvCounts[owner];
-        }
-    }
-    else
+
+    // Compute the metadata
+    // ====================
+    // Each entry is requested by its index within the local matrix of its
+    // owner (with the local rows padded to the maximum local height)
+    const Int maxLocalHeight =
+        Max(MaxLength(this->Height(),this->ColStride()),Int(1));
+    vector<int> owners(totalPulls);
+    vector<Int> indices(totalPulls);
+    EL_PARALLEL_FOR
+    for(Int k=0; k<totalPulls; ++k)
     {
-        if (!this->Participating())
-            return;
-        recvCounts.resize(commSize,0);
-        for(Int k=0; k<totalRecv; ++k)
-        {
-            const auto& valueInt = remotePulls_[k];
-            const Int i = valueInt.value;
-            const Int j = valueInt.index;
-            const int distOwner = this->Owner(i,j);
-            const int owner = grid.CoordsToVC(colDist,rowDist,distOwner,root);
-            owners[k] = owner;
-            ++recvCounts[owner];
-        }
+        const Int i = remotePulls_[k].value;
+        const Int j = remotePulls_[k].index;
+        const int rowOwner = this->RowOwner(i);
+        const int colOwner = this->ColOwner(j);
+        const int vcOwner =
+          grid.CoordsToVC(
+              colDist,rowDist,rowOwner+colOwner*this->ColStride(),root);
+        owners[k] = (includeViewers ? grid.VCToViewing(vcOwner) : vcOwner);
+        indices[k] = this->LocalRowOffset(i,rowOwner) +
+          this->LocalColOffset(j,colOwner)*maxLocalHeight;
     }
-    vector<int> recvOffs;
-    Scan(recvCounts, recvOffs);
-    vector<int> sendCounts(commSize);
-    mpi::AllToAll(recvCounts.data(), 1, sendCounts.data(), 1, comm,
-                  SyncInfo<Device::CPU>{});
-    vector<int> sendOffs;
-    const int totalSend = Scan(sendCounts, sendOffs);
-
-    auto offs = recvOffs;
-    vector<ValueInt<Int>> recvCoords(totalRecv);
-    for(Int k=0; k<totalRecv; ++k)
-        recvCoords[offs[owners[k]]++] = remotePulls_[k];
-    vector<ValueInt<Int>> sendCoords(totalSend);
-    mpi::AllToAll(
-        recvCoords.data(), recvCounts.data(), recvOffs.data(),
-        sendCoords.data(), sendCounts.data(), sendOffs.data(), comm,
-        SyncInfo<Device::CPU>{});
+
+    // Each entry is only requested once, however many times it was queued
+    vector<int> recvCounts;
+    vector<Int> positions;
+    remote_entries::Bucket(owners, commSize, recvCounts, positions);
+    SwapClear(owners);
+    vector<Int> recvIndices(totalPulls);
+    EL_PARALLEL_FOR
+    for(Int k=0; k<totalPulls; ++k)
+        recvIndices[positions[k]] = indices[k];
+    SwapClear(indices);
+    vector<Int> where;
+    remote_entries::UniqueWithinBuckets(recvCounts, recvIndices, where);
+
+    SyncInfo<Device::CPU> cpu_si;
+    vector<int> recvOffs, sendCounts(commSize), sendOffs;
+    const Int totalRecv = Scan(recvCounts, recvOffs);
+    mpi::AllToAll(recvCounts.data(), 1, sendCounts.data(), 1, comm, cpu_si);
+    const Int totalSend = Scan(sendCounts, sendOffs);
+    vector<Int> sendIndices(totalSend);
+    mpi::SparseAllToAll(
+        recvIndices, recvCounts, recvOffs,
+        sendIndices, sendCounts, sendOffs, comm);
 
     // Pack the data
     // =============
     vector<T> sendBuf;
     FastResize(sendBuf, totalSend);
-    for(Int k=0; k<totalSend; ++k)
+    if (D == Device::CPU)
+    {
+        const T* buffer = matrix_.LockedBuffer();
+        const Int ldim = matrix_.LDim();
+        EL_PARALLEL_FOR
+        for(Int k=0; k<totalSend; ++k)
+        {
+            const Int iLoc = sendIndices[k] % maxLocalHeight;
+            const Int jLoc = sendIndices[k] / maxLocalHeight;
+            sendBuf[k] = buffer[iLoc+jLoc*ldim];
+        }
+    }
+    else
     {
-        const Int i = sendCoords[k].value;
-        const Int j = sendCoords[k].index;
-        sendBuf[k] = GetLocal(this->LocalRow(i), this->LocalCol(j));
+        for(Int k=0; k<totalSend; ++k)
+            sendBuf[k] = GetLocal(
+                sendIndices[k] % maxLocalHeight,
+                sendIndices[k] / maxLocalHeight);
     }
 
     // Exchange and unpack the data
     // ============================
     vector<T> recvBuf;
     FastResize(recvBuf, totalRecv);
-    mpi::AllToAll(
-        sendBuf.data(), sendCounts.data(), sendOffs.data(),
-        recvBuf.data(), recvCounts.data(), recvOffs.data(), comm,
-        SyncInfo<Device::CPU>{});
-    offs = recvOffs;
-    for(Int k=0; k<totalRecv; ++k)
-        pullBuf[k] = recvBuf[offs[owners[k]]++];
+    mpi::SparseAllToAll(
+        sendBuf, sendCounts, sendOffs,
+        recvBuf, recvCounts, recvOffs, comm);
+    EL_PARALLEL_FOR
+    for(Int k=0; k<totalPulls; ++k)
+        pullBuf[k] = recvBuf[where[positions[k]]];
     SwapClear(remotePulls_);
 }
 
@@ -9,10 +9,119 @@
 */
 #include <El-lite.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 
 namespace El {
 
+struct Grid::Comms
+{
+    mpi::Comm owningComm,
+              cartComm,
+              mcComm, mrComm,
+              mdComm, mdPerpComm,
+              vcComm, vrComm;
+};
+
+// The derived communicators of each grid, keyed by the grid's shape and the
+// world ranks of its viewing and owning processes. The grids holding an
+// entry share it, and it is freed along with the last of them. Grids are
+// created and destroyed collectively over their viewing processes, so every
+// viewing process of a new grid either finds its entry or takes part in
+// creating it.
+class Grid::CommCache
+{
+public:
+    static shared_ptr<const Comms> Find( const vector<int>& key )
+    {
+        Registry& registry = *TheRegistry();
+        std::lock_guard<std::mutex> lock( registry.mutex );
+        auto it = registry.entries.find( key );
+        if( it == registry.entries.end() )
+            return shared_ptr<const Comms>();
+        return it->second.lock();
+    }
+
+    // Returns the cached entry if another thread inserted one meanwhile
+    static shared_ptr<const Comms>
+    Insert( const vector<int>& key, unique_ptr<Comms> comms )
+    {
+        shared_ptr<Registry> registry = TheRegistry();
+        std::lock_guard<std::mutex> lock( registry->mutex );
+        std::weak_ptr<const Comms>& entry = registry->entries[key];
+        shared_ptr<const Comms> cached = entry.lock();
+        if( cached )
+            return cached;
+        // The deleter holds the registry, which must outlive grids that
+        // are destroyed during static destruction
+        cached.reset
+        ( comms.release(),
+          [registry,key]( const Comms* expired )
+          {
+              delete expired;
+              std::lock_guard<std::mutex> lock( registry->mutex );
+              auto it = registry->entries.find( key );
+              if( it != registry->entries.end() && it->second.expired() )
+                  registry->entries.erase( it );
+          } );
+        entry = cached;
+        return cached;
+    }
+
+    static vector<int> Key( const Grid& grid )
+    {
+        mpi::Group worldGroup;
+        mpi::CommGroup( mpi::COMM_WORLD, worldGroup );
+
+        const int numViewers = mpi::Size( grid.viewingGroup_ );
+        vector<int> key( 2+numViewers+grid.size_ );
+        key[0] = grid.height_;
+        key[1] = int(grid.order_);
+
+        // The order of the viewing processes does not affect the
+        // communicators, so only their membership is recorded
+        vector<int> ranks( std::max(numViewers,grid.size_) );
+        std::iota( ranks.begin(), ranks.end(), 0 );
+        int* viewers = &key[2];
+        mpi::Translate
+        ( grid.viewingGroup_, numViewers, ranks.data(), worldGroup, viewers );
+        std::sort( viewers, viewers+numViewers );
+        mpi::Translate
+        ( grid.owningGroup_, grid.size_, ranks.data(), worldGroup,
+          viewers+numViewers );
+        mpi::Free( worldGroup );
+        return key;
+    }
+
+    static size_t Size()
+    {
+        Registry& registry = *TheRegistry();
+        std::lock_guard<std::mutex> lock( registry.mutex );
+        return registry.entries.size();
+    }
+
+    static std::atomic<bool> enabled;
+
+private:
+    struct Registry
+    {
+        std::mutex mutex;
+        std::map<vector<int>,std::weak_ptr<const Comms>> entries;
+    };
+
+    static shared_ptr<Registry> TheRegistry()
+    {
+        static shared_ptr<Registry> registry = std::make_shared<Registry>();
+        return registry;
+    }
+};
+
+std::atomic<bool> Grid::CommCache::enabled{true};
+
 void Grid::InitializeDefault()
 {
 }
@@ -63,6 +172,89 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
+unique_ptr<Grid> Grid::NodeAware( mpi::Comm const& comm, GridOrder order )
+{
+    EL_DEBUG_CSE
+    const int size = mpi::Size( comm );
+    const int rank = mpi::Rank( comm );
+    SyncInfo<Device::CPU> syncInfo;
+
+    // Identify our node and socket by the rank of their first process
+    int ids[2] = { rank, rank };
+    mpi::Comm nodeComm;
+    mpi::SplitType( comm, mpi::COMM_TYPE_SHARED, rank, nodeComm );
+    mpi::Broadcast( ids[0], 0, nodeComm, syncInfo );
+    ids[1] = ids[0];
+    if( mpi::COMM_TYPE_SOCKET != mpi::UNDEFINED )
+    {
+        // Unbound processes are not assigned a socket
+        mpi::Comm socketComm;
+        mpi::SplitType( nodeComm, mpi::COMM_TYPE_SOCKET, rank, socketComm );
+        if( socketComm.GetMPIComm() != MPI_COMM_NULL )
+        {
+            ids[1] = rank;
+            mpi::Broadcast( ids[1], 0, socketComm, syncInfo );
+        }
+    }
+    vector<int> allIds( 2*size );
+    mpi::AllGather( ids, 2, allIds.data(), 2, comm, syncInfo );
+
+    // Order the processes by node, then by socket
+    vector<int> topoOrder( size );
+    std::iota( topoOrder.begin(), topoOrder.end(), 0 );
+    std::stable_sort
+    ( topoOrder.begin(), topoOrder.end(),
+      [&]( int p, int q )
+      { return allIds[2*p] < allIds[2*q] ||
+               (allIds[2*p] == allIds[2*q] &&
+                allIds[2*p+1] < allIds[2*q+1]); } );
+    const int topoRank =
+      std::find( topoOrder.begin(), topoOrder.end(), rank ) - topoOrder.begin();
+
+    // If every node holds the same number of processes, choose the squarest
+    // grid whose columns fit within a node
+    std::map<int,int> nodeSizes;
+    for( int q=0; q<size; ++q )
+        ++nodeSizes[allIds[2*q]];
+    const int procsPerNode = nodeSizes.begin()->second;
+    const bool uniform =
+      std::all_of
+      ( nodeSizes.begin(), nodeSizes.end(),
+        [&]( const std::pair<const int,int>& node )
+        { return node.second == procsPerNode; } );
+    int height = DefaultHeight( size );
+    if( uniform )
+    {
+        double bestRatio = -1;
+        for( int h=1; h<=procsPerNode; ++h )
+        {
+            if( procsPerNode % h != 0 )
+                continue;
+            const int w = size / h;
+            const double ratio = double(std::max(h,w)) / std::min(h,w);
+            if( bestRatio < 0 || ratio <= bestRatio )
+            {
+                bestRatio = ratio;
+                height = h;
+            }
+        }
+    }
+
+    // Fill the grid column by column in topological order
+    const int width = size / height;
+    const int mcRank = topoRank % height;
+    const int mrRank = topoRank / height;
+    const int key = ( order==COLUMN_MAJOR ? mcRank + mrRank*height
+                                          : mrRank + mcRank*width );
+    mpi::Comm gridComm;
+    mpi::Split( comm, 0, key, gridComm );
+    return MakeUnique<Grid>( std::move(gridComm), height, order );
+}
+
+void Grid::SetCommCaching( bool enable ) { CommCache::enabled = enable; }
+bool Grid::CommCaching() { return CommCache::enabled; }
+size_t Grid::NumCachedComms() { return CommCache::Size(); }
+
 Grid::Grid()
     : Grid{mpi::NewWorldComm()}
 {}
@@ -104,94 +296,130 @@ void Grid::SetUpGrid()
 
     const int width = size_ / height_;
     gcd_ = El::GCD( height_, width );
-    int lcm = size_ / gcd_;
-
-    // Create the communicator for the owning group (mpi::COMM_NULL otherwise)
-    mpi::Create( viewingComm_, owningGroup_, owningComm_ );
+    const int lcm = size_ / gcd_;
+    const bool colMajor = (order_==COLUMN_MAJOR);
 
-    vcToViewing_.resize(size_);
+    // Each of the GCD diagonals is traversed from its entry in the first row,
+    // and passes through LCM processes
     diagsAndRanks_.resize(2*size_);
-    MemZero( diagsAndRanks_.data(), 2*size_ );
-    const bool colMajor = (order_==COLUMN_MAJOR);
-    if( InGrid() )
+    for( int diag=0; diag<gcd_; ++diag )
     {
-        // Create a cartesian communicator
-        // TODO: Allow for reordering and non-periodicity
-        int dims[2];
-        if( colMajor )
-        {
-            dims[0] = width;
-            dims[1] = height_;
-        }
-        else
+        int row = 0;
+        int col = diag;
+        for( int diagRank=0; diagRank<lcm; ++diagRank )
         {
-            dims[0] = height_;
-            dims[1] = width;
+            const int vcRank = row + col*height_;
+            diagsAndRanks_[2*vcRank] = diag;
+            diagsAndRanks_[2*vcRank+1] = diagRank;
+            row = (row + 1) % height_;
+            col = (col + 1) % width;
         }
-        int periods[2] = { true, true };
-        bool reorder = false;
-        mpi::CartCreate( owningComm_, 2, dims, periods, reorder, cartComm_ );
-
-        // Set up the MatrixCol and MatrixRow communicators
-        int remainingDims[2];
-        remainingDims[0] = ( colMajor ? false : true  );
-        remainingDims[1] = ( colMajor ? true  : false );
-        mpi::CartSub( cartComm_, remainingDims, mcComm_ );
-        remainingDims[0] = ( colMajor ? true  : false );
-        remainingDims[1] = ( colMajor ? false : true  );
-        mpi::CartSub( cartComm_, remainingDims, mrComm_ );
-        mcRank_ = mpi::Rank( mcComm_ );
-        mrRank_ = mpi::Rank( mrComm_ );
-
-        // Set up the VectorCol and VectorRow communicators
-        vcRank_ = mcRank_ + height_*mrRank_;
-        vrRank_ = mrRank_ + width*mcRank_;
-        mpi::Split( cartComm_, 0, vcRank_, vcComm_ );
-        mpi::Split( cartComm_, 0, vrRank_, vrComm_ );
+    }
 
-        // Set up the map from the VC group to the viewingGroup_ ranks.
-        vector<int> ranks(size_);
-        for( int i=0; i<size_; ++i )
-            ranks[i] = i;
-        mpi::Translate
-        ( vcComm_, size_, ranks.data(), viewingGroup_,  vcToViewing_.data() );
+    // Set up the map from the VC ranks to the viewingGroup_ ranks. The
+    // owning ranks are the ranks of the (unreordered) cartesian
+    // communicator, which are the VC (VR) ranks for a column-major
+    // (row-major) grid.
+    vector<int> owningRanks(size_);
+    for( int vcRank=0; vcRank<size_; ++vcRank )
+        owningRanks[vcRank] = ( colMajor ? vcRank : VCToVR(vcRank) );
+    vcToViewing_.resize(size_);
+    mpi::Translate
+    ( owningGroup_, size_, owningRanks.data(),
+      viewingGroup_, vcToViewing_.data() );
+
+    // Every viewing process makes the same choice, since caching must be
+    // enabled or disabled on all of them at once
+    const bool caching = CommCache::enabled;
+    vector<int> key;
+    if( caching )
+    {
+        key = CommCache::Key( *this );
+        comms_ = CommCache::Find( key );
+    }
+    if( !comms_ )
+    {
+        auto comms = MakeUnique<Comms>();
 
-        // Compute which diagonal we're in, and what our rank is, then
-        // perform AllGather world to store everyone's info
-        vector<int> myDiagAndRank(2);
-        myDiagAndRank[0] = mdPerpRank_ = Mod(mrRank_-mcRank_,gcd_);
-        int diagRank = 0;
-        int row = 0;
-        int col = myDiagAndRank[0];
-        for( int j=0; j<lcm; ++j )
+        // Create the communicator for the owning group (mpi::COMM_NULL
+        // otherwise)
+        mpi::Create( viewingComm_, owningGroup_, comms->owningComm );
+
+        if( InGrid() )
         {
-            if( row == mcRank_ && col == mrRank_ )
+            // Create a cartesian communicator
+            // TODO: Allow for reordering and non-periodicity
+            int dims[2];
+            if( colMajor )
             {
-                myDiagAndRank[1] = mdRank_ = diagRank;
-                break;
+                dims[0] = width;
+                dims[1] = height_;
             }
             else
             {
-                row = (row + 1) % height_;
-                col = (col + 1) % width;
-                ++diagRank;
+                dims[0] = height_;
+                dims[1] = width;
             }
+            int periods[2] = { true, true };
+            bool reorder = false;
+            mpi::CartCreate
+            ( comms->owningComm, 2, dims, periods, reorder, comms->cartComm );
+
+            // Set up the MatrixCol and MatrixRow communicators
+            int remainingDims[2];
+            remainingDims[0] = ( colMajor ? false : true  );
+            remainingDims[1] = ( colMajor ? true  : false );
+            mpi::CartSub( comms->cartComm, remainingDims, comms->mcComm );
+            remainingDims[0] = ( colMajor ? true  : false );
+            remainingDims[1] = ( colMajor ? false : true  );
+            mpi::CartSub( comms->cartComm, remainingDims, comms->mrComm );
+            const int mcRank = mpi::Rank( comms->mcComm );
+            const int mrRank = mpi::Rank( comms->mrComm );
+
+            // Set up the VectorCol and VectorRow communicators
+            const int vcRank = mcRank + height_*mrRank;
+            const int vrRank = mrRank + width*mcRank;
+            mpi::Split( comms->cartComm, 0, vcRank, comms->vcComm );
+            mpi::Split( comms->cartComm, 0, vrRank, comms->vrComm );
+
+            // Set up the MatrixDiag and MatrixDiagPerp communicators
+            const int mdPerpRank = diagsAndRanks_[2*vcRank];
+            const int mdRank = diagsAndRanks_[2*vcRank+1];
+            mpi::Split( comms->cartComm, mdPerpRank, mdRank, comms->mdComm );
+            mpi::Split
+            ( comms->cartComm, mdRank, mdPerpRank, comms->mdPerpComm );
+
+            // Name the communicators for the communication statistics
+            mpi::SetName( comms->mcComm,     "MC" );
+            mpi::SetName( comms->mrComm,     "MR" );
+            mpi::SetName( comms->vcComm,     "VC" );
+            mpi::SetName( comms->vrComm,     "VR" );
+            mpi::SetName( comms->mdComm,     "MD" );
+            mpi::SetName( comms->mdPerpComm, "MDPerp" );
+
+            EL_DEBUG_ONLY(
+              mpi::ErrorHandlerSet( comms->mcComm,     mpi::ERRORS_RETURN );
+              mpi::ErrorHandlerSet( comms->mrComm,     mpi::ERRORS_RETURN );
+              mpi::ErrorHandlerSet( comms->vcComm,     mpi::ERRORS_RETURN );
+              mpi::ErrorHandlerSet( comms->vrComm,     mpi::ERRORS_RETURN );
+              mpi::ErrorHandlerSet( comms->mdComm,     mpi::ERRORS_RETURN );
+              mpi::ErrorHandlerSet( comms->mdPerpComm, mpi::ERRORS_RETURN );
+            )
         }
-        mpi::AllGather
-        ( myDiagAndRank.data(),  2,
-          diagsAndRanks_.data(), 2, vcComm_, SyncInfo<Device::CPU>{} );
-
-        mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
-        mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
-
-        EL_DEBUG_ONLY(
-          mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( vcComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( vrComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mdComm_,     mpi::ERRORS_RETURN );
-          mpi::ErrorHandlerSet( mdPerpComm_, mpi::ERRORS_RETURN );
-        )
+        if( caching )
+            comms_ = CommCache::Insert( key, std::move(comms) );
+        else
+            comms_ = std::move(comms);
+    }
+
+    if( InGrid() )
+    {
+        mcRank_ = mpi::Rank( comms_->mcComm );
+        mrRank_ = mpi::Rank( comms_->mrComm );
+        vcRank_ = mcRank_ + height_*mrRank_;
+        vrRank_ = mrRank_ + width*mcRank_;
+        mdPerpRank_ = diagsAndRanks_[2*vcRank_];
+        mdRank_ = diagsAndRanks_[2*vcRank_+1];
     }
     else
     {
@@ -201,20 +429,11 @@ void Grid::SetUpGrid()
         mdPerpRank_ = mpi::UNDEFINED;
         vcRank_     = mpi::UNDEFINED;
         vrRank_     = mpi::UNDEFINED;
-
-        // diags and ranks are implicitly set to undefined
     }
-    // Translate the rank of the root process of the owningGroup so that we can
-    // broadcast data
-    int owningRoot = mpi::Translate( owningGroup_, 0, viewingGroup_ );
-    mpi::Broadcast(vcToViewing_.data(), size_, owningRoot, viewingComm_,
-                   SyncInfo<Device::CPU>{} );
-    mpi::Broadcast(diagsAndRanks_.data(), 2*size_, owningRoot, viewingComm_,
-                   SyncInfo<Device::CPU>{} );
 
 #ifdef EL_HAVE_SCALAPACK
-    blacsVCHandle_ = blacs::Handle( vcComm_.comm );
-    blacsVRHandle_ = blacs::Handle( vrComm_.comm );
+    blacsVCHandle_ = blacs::Handle( comms_->vcComm.comm );
+    blacsVRHandle_ = blacs::Handle( comms_->vrComm.comm );
     blacsMCMRContext_ =
       blacs::GridInit
       ( blacsVCHandle_, true /* column major */, height_, width );
@@ -230,17 +449,6 @@ Grid::~Grid()
         blacs::FreeHandle( blacsVRHandle_ );
         blacs::FreeHandle( blacsVCHandle_ );
 #endif
-        if( InGrid() )
-        {
-            mpi::Free( mdComm_ );
-            mpi::Free( mdPerpComm_ );
-            mpi::Free( mcComm_ );
-            mpi::Free( mrComm_ );
-            mpi::Free( vcComm_ );
-            mpi::Free( vrComm_ );
-            mpi::Free( cartComm_ );
-            mpi::Free( owningComm_ );
-        }
         mpi::Free( viewingComm_ );
         if( HaveViewers() )
             mpi::Free( owningGroup_ );
@@ -262,12 +470,18 @@ int Grid::MDPerpSize() const EL_NO_EXCEPT { return gcd_;          }
 int Grid::VCSize()     const EL_NO_EXCEPT { return size_;         }
 int Grid::VRSize()     const EL_NO_EXCEPT { return size_;         }
 
-mpi::Comm const& Grid::MCComm()     const EL_NO_EXCEPT { return mcComm_;     }
-mpi::Comm const& Grid::MRComm()     const EL_NO_EXCEPT { return mrComm_;     }
-mpi::Comm const& Grid::MDComm()     const EL_NO_EXCEPT { return mdComm_;     }
-mpi::Comm const& Grid::MDPerpComm() const EL_NO_EXCEPT { return mdPerpComm_; }
-mpi::Comm const& Grid::VCComm()     const EL_NO_EXCEPT { return vcComm_;     }
-mpi::Comm const& Grid::VRComm()     const EL_NO_EXCEPT { return vrComm_;     }
+mpi::Comm const& Grid::MCComm()     const EL_NO_EXCEPT
+{ return comms_->mcComm;     }
+mpi::Comm const& Grid::MRComm()     const EL_NO_EXCEPT
+{ return comms_->mrComm;     }
+mpi::Comm const& Grid::MDComm()     const EL_NO_EXCEPT
+{ return comms_->mdComm;     }
+mpi::Comm const& Grid::MDPerpComm() const EL_NO_EXCEPT
+{ return comms_->mdPerpComm; }
+mpi::Comm const& Grid::VCComm()     const EL_NO_EXCEPT
+{ return comms_->vcComm;     }
+mpi::Comm const& Grid::VRComm()     const EL_NO_EXCEPT
+{ return comms_->vrComm;     }
 
 // Provided for simplicity, but redundant
 // ======================================
@@ -391,7 +605,8 @@ int Grid::VCToViewing( int vcRank ) const EL_NO_EXCEPT
 { return vcToViewing_[vcRank]; }
 
 mpi::Group Grid::OwningGroup() const EL_NO_EXCEPT { return owningGroup_; }
-mpi::Comm const& Grid::OwningComm()  const EL_NO_EXCEPT { return owningComm_; }
+mpi::Comm const& Grid::OwningComm()  const EL_NO_EXCEPT
+{ return comms_->owningComm; }
 mpi::Comm const& Grid::ViewingComm() const EL_NO_EXCEPT { return viewingComm_; }
 
 int Grid::Diag() const EL_NO_RELEASE_EXCEPT
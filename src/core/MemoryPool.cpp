@@ -1,4 +1,9 @@
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include "El-lite.hpp"
 #include "El/core/MemoryPool.hpp"
 
@@ -13,6 +18,60 @@ std::unique_ptr<MemoryPool<true>> pinnedHostMemoryPool_;
 std::unique_ptr<MemoryPool<false>> hostMemoryPool_;
 }  // namespace <anon>
 
+namespace details
+{
+namespace
+{
+// These are intentionally never destroyed, since pools with static storage
+// duration may deregister themselves during static destruction.
+std::unordered_set<size_t>& LiveMemoryPools()
+{
+    static auto* live = new std::unordered_set<size_t>;
+    return *live;
+}
+size_t nextMemoryPoolId_ = 0;
+}  // namespace <anon>
+
+std::mutex& MemoryPoolRegistryMutex()
+{
+    static auto* mutex = new std::mutex;
+    return *mutex;
+}
+
+size_t RegisterMemoryPool()
+{
+    std::lock_guard<std::mutex> lock(MemoryPoolRegistryMutex());
+    const size_t id = nextMemoryPoolId_++;
+    LiveMemoryPools().insert(id);
+    return id;
+}
+
+void DeregisterMemoryPool(size_t id)
+{
+    std::lock_guard<std::mutex> lock(MemoryPoolRegistryMutex());
+    LiveMemoryPools().erase(id);
+}
+
+bool MemoryPoolIsLive(size_t id)
+{ return LiveMemoryPools().count(id) != 0; }
+
+bool ParseByteCount(char const* str, size_t& bytes)
+{
+    // strtoull accepts leading whitespace and a sign, which are rejected
+    if (str == nullptr || *str < '0' || *str > '9')
+        return false;
+    char* end = nullptr;
+    errno = 0;
+    const unsigned long long value = std::strtoull(str, &end, 10);
+    if (errno == ERANGE || *end != '\0'
+        || value > std::numeric_limits<size_t>::max())
+        return false;
+    bytes = value;
+    return true;
+}
+
+}  // namespace details
+
 #ifdef HYDROGEN_HAVE_CUDA
 
 MemoryPool<true>& PinnedHostMemoryPool()
@@ -30,11 +89,57 @@ void DestroyPinnedHostMemoryPool()
 MemoryPool<false>& HostMemoryPool()
 {
     if (!hostMemoryPool_)
+    {
         hostMemoryPool_.reset(new MemoryPool<false>());
+        const char* maxCached =
+            std::getenv("HYDROGEN_MEMORY_POOL_MAX_CACHED_BYTES");
+        size_t maxCachedBytes;
+        if (maxCached && details::ParseByteCount(maxCached, maxCachedBytes))
+            hostMemoryPool_->SetMaxCachedBytes(maxCachedBytes);
+        else if (maxCached)
+            Output("Warning: ignoring malformed "
+                   "HYDROGEN_MEMORY_POOL_MAX_CACHED_BYTES=", maxCached);
+    }
     return *hostMemoryPool_;
 }
 
 void DestroyHostMemoryPool()
 { hostMemoryPool_.reset(); }
 
+namespace
+{
+
+void PrintStatistics
+(std::ostream& os, const std::string& name, const MemoryPoolStatistics& stats)
+{
+    os << name << " memory pool:\n"
+       << "  bytes in use:        " << stats.bytes_in_use << "\n"
+       << "  bytes requested:     " << stats.bytes_requested << "\n"
+       << "  peak bytes in use:   " << stats.peak_bytes_in_use << "\n"
+       << "  fragmentation ratio: " << stats.FragmentationRatio() << "\n"
+       << "  bytes cached:        " << stats.bytes_cached << "\n";
+    if (stats.max_cached_bytes != (size_t) -1)
+        os << "  max cached bytes:    " << stats.max_cached_bytes << "\n";
+    os << "  bytes trimmed:       " << stats.bytes_trimmed << "\n"
+       << "  uncached allocations: " << stats.uncached_allocations << "\n"
+       << "  bin size, hits, misses:\n";
+    for (const auto& bin : stats.bins)
+        if (bin.hits != 0 || bin.misses != 0)
+            os << "    " << bin.size << ", " << bin.hits << ", "
+               << bin.misses << "\n";
+}
+
+}  // namespace <anon>
+
+void PrintMemoryPoolStatistics(std::ostream& os)
+{
+    if (hostMemoryPool_)
+        PrintStatistics(os, "Host", hostMemoryPool_->Statistics());
+#ifdef HYDROGEN_HAVE_CUDA
+    if (pinnedHostMemoryPool_)
+        PrintStatistics(
+            os, "Pinned host", pinnedHostMemoryPool_->Statistics());
+#endif  // HYDROGEN_HAVE_CUDA
+}
+
 }  // namespace El
@@ -1,5 +1,15 @@
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
 
 #include "El/hydrogen_config.h"
 #include "El/core/Profiling.hpp"
@@ -56,6 +66,384 @@ bool nvprof_runtime_enabled = true;
 bool NVProfRuntimeEnabled() noexcept { return nvprof_runtime_enabled; }
 #endif
 
+// The native profiler
+// ===================
+
+std::atomic<bool> native_enabled{false};
+std::atomic<bool> native_trace{false};
+std::vector<ProfileFormat> native_reports;
+// Each thread discards its own regions once it sees that ResetProfile has
+// started a new generation, so that no thread frees the regions of another
+std::atomic<size_t> native_generation{0};
+std::atomic<Clock::rep> native_epoch{
+    Clock::now().time_since_epoch().count()};
+
+Clock::time_point NativeEpoch()
+{
+    return Clock::time_point(Clock::duration(native_epoch.load()));
+}
+
+// Bound the memory used by the trace of each thread
+constexpr size_t max_trace_events = size_t(1) << 20;
+
+struct RegionNode
+{
+    std::string name;
+    RegionNode* parent = nullptr;
+    std::vector<std::unique_ptr<RegionNode>> children;
+    long long count = 0;
+    double inclusive = 0; // seconds
+    double bytes = 0;
+    Clock::time_point start;
+
+    RegionNode* Child(char const* childName)
+    {
+        for (auto& child : children)
+            if (child->name == childName)
+                return child.get();
+        children.emplace_back(new RegionNode);
+        auto* child = children.back().get();
+        child->name = childName;
+        child->parent = this;
+        return child;
+    }
+};
+
+struct TraceEvent
+{
+    RegionNode const* region;
+    double begin, duration; // seconds since native_epoch
+};
+
+struct ThreadProfile
+{
+    int tid;
+    std::atomic<size_t> generation;
+    RegionNode root;
+    RegionNode* current = &root;
+    std::vector<TraceEvent> events;
+
+    // Reports skip threads which have not caught up with a reset
+    bool Current() const
+    {
+        return generation.load(std::memory_order_acquire)
+            == native_generation.load(std::memory_order_acquire);
+    }
+};
+
+// Profiles outlive their threads so that pool workers are reported too
+std::mutex profiles_mutex;
+std::vector<std::unique_ptr<ThreadProfile>> profiles;
+thread_local ThreadProfile* this_thread_profile = nullptr;
+
+// Whether each region open on this thread was recorded by the native
+// profiler, innermost last, so that a region begun while the profiler was
+// disabled does not end a recorded one. Regions begun while the profiler is
+// disabled and no recorded region is open are not tracked.
+thread_local std::vector<bool> open_regions_recorded;
+
+ThreadProfile& ThisThreadProfile()
+{
+    if (!this_thread_profile)
+    {
+        std::lock_guard<std::mutex> lock(profiles_mutex);
+        profiles.emplace_back(new ThreadProfile);
+        this_thread_profile = profiles.back().get();
+        this_thread_profile->tid = static_cast<int>(profiles.size()) - 1;
+        this_thread_profile->generation = native_generation.load();
+    }
+    auto& profile = *this_thread_profile;
+    auto const generation = native_generation.load(std::memory_order_acquire);
+    if (profile.generation.load(std::memory_order_relaxed) != generation)
+    {
+        // The regions still open when the profile was reset are dropped
+        profile.root.children.clear();
+        profile.current = &profile.root;
+        profile.events.clear();
+        profile.generation.store(generation, std::memory_order_release);
+    }
+    return profile;
+}
+
+// Region paths join the names with a separator which sorts before any
+// printable character, so that sorted paths list the tree depth-first
+constexpr char path_separator = '\x01';
+
+std::string DisplayPath(std::string path)
+{
+    std::replace(path.begin(), path.end(), path_separator, '/');
+    return path;
+}
+
+void NativeBegin(char const* s)
+{
+    auto& profile = ThisThreadProfile();
+    auto* region = profile.current->Child(s);
+    ++region->count;
+    profile.current = region;
+    region->start = Clock::now();
+}
+
+void NativeEnd()
+{
+    auto& profile = ThisThreadProfile();
+    // A region discarded by ResetProfile
+    if (profile.current == &profile.root)
+        return;
+    auto* region = profile.current;
+    auto const end = Clock::now();
+    double const duration =
+        std::chrono::duration<double>(end - region->start).count();
+    region->inclusive += duration;
+    if (native_trace && profile.events.size() < max_trace_events)
+        profile.events.push_back(
+            {region,
+             std::chrono::duration<double>(
+                 region->start - NativeEpoch()).count(),
+             duration});
+    profile.current = region->parent;
+}
+
+struct RegionStats
+{
+    double count = 0, inclusive = 0, exclusive = 0, bytes = 0;
+};
+
+// Merge the trees of all threads into statistics keyed by region path
+void FlattenRegions(
+    RegionNode const& node, std::string const& path,
+    std::map<std::string, RegionStats>& stats)
+{
+    for (auto const& child : node.children)
+    {
+        auto const childPath =
+            path.empty() ? child->name : path + path_separator + child->name;
+        double childrenTime = 0;
+        for (auto const& grandchild : child->children)
+            childrenTime += grandchild->inclusive;
+        auto& entry = stats[childPath];
+        entry.count += child->count;
+        entry.inclusive += child->inclusive;
+        entry.exclusive += child->inclusive - childrenTime;
+        entry.bytes += child->bytes;
+        FlattenRegions(*child, childPath, stats);
+    }
+}
+
+struct ReducedStats
+{
+    // The minimum, average and maximum over the ranks
+    std::array<double,3> count, inclusive, exclusive, bytes;
+};
+
+void Reduce(
+    std::array<double,3>& reduced, double value, int rank, int numRanks)
+{
+    if (rank == 0)
+        reduced = {value, 0, value};
+    reduced[0] = std::min(reduced[0], value);
+    reduced[1] += value / numRanks;
+    reduced[2] = std::max(reduced[2], value);
+}
+
+double Imbalance(std::array<double,3> const& reduced)
+{
+    return reduced[1] > 0 ? reduced[2] / reduced[1] - 1 : 0;
+}
+
+// Gather the statistics of every rank at rank 0. A region which a rank
+// never entered counts as zero on that rank.
+std::map<std::string, ReducedStats> GatherRegions()
+{
+    std::map<std::string, RegionStats> local;
+    {
+        std::lock_guard<std::mutex> lock(profiles_mutex);
+        for (auto const& profile : profiles)
+            if (profile->Current())
+                FlattenRegions(profile->root, "", local);
+    }
+
+    std::ostringstream os;
+    os << std::setprecision(17);
+    for (auto const& entry : local)
+        os << entry.first << '\n'
+           << entry.second.count << ' ' << entry.second.inclusive << ' '
+           << entry.second.exclusive << ' ' << entry.second.bytes << '\n';
+    auto const packed = os.str();
+
+    mpi::Comm const& comm = mpi::COMM_WORLD;
+    SyncInfo<Device::CPU> syncInfo;
+    int const commRank = mpi::Rank(comm);
+    int const commSize = mpi::Size(comm);
+    int const size = static_cast<int>(packed.size());
+    std::vector<int> sizes(commSize), offsets(commSize);
+    mpi::Gather(&size, 1, sizes.data(), 1, 0, comm, syncInfo);
+    int totalSize = 0;
+    for (int q = 0; q < commSize; ++q)
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<byte> all(commRank == 0 ? totalSize : 0);
+    mpi::Gather(
+        reinterpret_cast<byte const*>(packed.data()), size,
+        all.data(), sizes.data(), offsets.data(), 0, comm, syncInfo);
+
+    std::map<std::string, ReducedStats> reduced;
+    if (commRank != 0)
+        return reduced;
+
+    std::vector<std::map<std::string, RegionStats>> ranks(commSize);
+    for (int q = 0; q < commSize; ++q)
+    {
+        std::istringstream is(
+            std::string(reinterpret_cast<char const*>(all.data())+offsets[q],
+                        sizes[q]));
+        std::string path;
+        while (std::getline(is, path))
+        {
+            auto& entry = ranks[q][path];
+            is >> entry.count >> entry.inclusive
+               >> entry.exclusive >> entry.bytes;
+            is.ignore();
+            reduced[path];
+        }
+    }
+    for (auto& entry : reduced)
+    {
+        for (int q = 0; q < commSize; ++q)
+        {
+            auto it = ranks[q].find(entry.first);
+            auto const stats =
+                (it == ranks[q].end() ? RegionStats{} : it->second);
+            Reduce(entry.second.count, stats.count, q, commSize);
+            Reduce(entry.second.inclusive, stats.inclusive, q, commSize);
+            Reduce(entry.second.exclusive, stats.exclusive, q, commSize);
+            Reduce(entry.second.bytes, stats.bytes, q, commSize);
+        }
+    }
+    return reduced;
+}
+
+std::string JSONString(std::string const& s)
+{
+    std::ostringstream os;
+    os << '"';
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+            os << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+               << int(c) << std::dec << std::setfill(' ');
+        else
+            os << c;
+    }
+    os << '"';
+    return os.str();
+}
+
+void WriteText(
+    std::ostream& os, std::map<std::string, ReducedStats> const& regions)
+{
+    auto const flags = os.flags();
+    auto const precision = os.precision();
+    os << "Profile over " << mpi::Size(mpi::COMM_WORLD) << " ranks "
+       << "(times in seconds, averages over ranks)\n"
+       << std::left << std::setw(40) << "Region" << std::right
+       << std::setw(10) << "Calls"
+       << std::setw(12) << "Incl"
+       << std::setw(12) << "Incl min"
+       << std::setw(12) << "Incl max"
+       << std::setw(12) << "Excl"
+       << std::setw(10) << "Imbal"
+       << std::setw(14) << "Bytes" << '\n';
+    for (auto const& entry : regions)
+    {
+        auto const& path = entry.first;
+        auto const& stats = entry.second;
+        auto const depth =
+            std::count(path.begin(), path.end(), path_separator);
+        auto const last = path.rfind(path_separator);
+        auto const name = std::string(2*depth, ' ')
+            + (last == std::string::npos ? path : path.substr(last+1));
+        os << std::left << std::setw(40) << name << std::right
+           << std::fixed << std::setprecision(1)
+           << std::setw(10) << stats.count[1]
+           << std::scientific << std::setprecision(4)
+           << std::setw(12) << stats.inclusive[1]
+           << std::setw(12) << stats.inclusive[0]
+           << std::setw(12) << stats.inclusive[2]
+           << std::setw(12) << stats.exclusive[1]
+           << std::fixed << std::setprecision(3)
+           << std::setw(10) << Imbalance(stats.inclusive)
+           << std::scientific << std::setprecision(3)
+           << std::setw(14) << stats.bytes[1] << '\n';
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void WriteJSON(
+    std::ostream& os, std::map<std::string, ReducedStats> const& regions)
+{
+    auto writeStats = [&os](char const* name, std::array<double,3> const& r)
+    {
+        os << JSONString(name) << ": {\"min\": " << r[0]
+           << ", \"avg\": " << r[1] << ", \"max\": " << r[2]
+           << ", \"imbalance\": " << Imbalance(r) << "}";
+    };
+    auto const precision = os.precision();
+    os << std::setprecision(9)
+       << "{\"ranks\": " << mpi::Size(mpi::COMM_WORLD)
+       << ", \"regions\": [";
+    bool first = true;
+    for (auto const& entry : regions)
+    {
+        os << (first ? "\n" : ",\n") << "  {\"path\": "
+           << JSONString(DisplayPath(entry.first)) << ", ";
+        writeStats("calls", entry.second.count);
+        os << ", ";
+        writeStats("inclusive_seconds", entry.second.inclusive);
+        os << ", ";
+        writeStats("exclusive_seconds", entry.second.exclusive);
+        os << ", ";
+        writeStats("bytes", entry.second.bytes);
+        os << "}";
+        first = false;
+    }
+    os << "\n]}\n";
+    os.precision(precision);
+}
+
+void WriteChromeTrace(std::ostream& os)
+{
+    int const pid = mpi::Rank(mpi::COMM_WORLD);
+    auto const flags = os.flags();
+    auto const precision = os.precision();
+    os << std::fixed << std::setprecision(3) << "{\"traceEvents\": [";
+    bool first = true;
+    std::lock_guard<std::mutex> lock(profiles_mutex);
+    for (auto const& profile : profiles)
+    {
+        if (!profile->Current())
+            continue;
+        for (auto const& event : profile->events)
+        {
+            os << (first ? "\n" : ",\n")
+               << "{\"name\": " << JSONString(event.region->name)
+               << ", \"ph\": \"X\", \"pid\": " << pid
+               << ", \"tid\": " << profile->tid
+               << ", \"ts\": " << event.begin*1e6
+               << ", \"dur\": " << event.duration*1e6 << "}";
+            first = false;
+        }
+    }
+    os << "\n]}\n";
+    os.flags(flags);
+    os.precision(precision);
+}
+
 }// namespace <anon>
 
 void EnableVTune() noexcept
@@ -86,6 +474,119 @@ void DisableNVProf() noexcept
 #endif // HYDROGEN_HAVE_NVPROF
 }
 
+void EnableNativeProfiling(bool recordTrace) noexcept
+{
+    native_trace = recordTrace;
+    native_enabled = true;
+}
+
+void DisableNativeProfiling() noexcept
+{
+    native_enabled = false;
+}
+
+bool NativeProfilingEnabled() noexcept
+{
+    return native_enabled;
+}
+
+void AddProfileBytes(size_t bytes) noexcept
+{
+    if (native_enabled)
+        ThisThreadProfile().current->bytes += bytes;
+}
+
+void ReportProfile(std::ostream& os, ProfileFormat format)
+{
+    switch (format)
+    {
+    case ProfileFormat::TEXT:
+    case ProfileFormat::JSON:
+    {
+        auto const regions = GatherRegions();
+        if (mpi::Rank(mpi::COMM_WORLD) != 0)
+            break;
+        if (format == ProfileFormat::TEXT)
+            WriteText(os, regions);
+        else
+            WriteJSON(os, regions);
+        break;
+    }
+    case ProfileFormat::CHROME_TRACE:
+        WriteChromeTrace(os);
+        break;
+    }
+}
+
+void ResetProfile() noexcept
+{
+    native_epoch = Clock::now().time_since_epoch().count();
+    native_generation.fetch_add(1, std::memory_order_acq_rel);
+    // Discard the calling thread's regions now; the others follow lazily
+    if (this_thread_profile)
+        ThisThreadProfile();
+}
+
+void InitializeProfiling()
+{
+    char const* env = std::getenv("HYDROGEN_PROFILE");
+    if (!env)
+        return;
+    std::istringstream formats(env);
+    std::string format;
+    while (std::getline(formats, format, ','))
+    {
+        if (format == "text")
+            native_reports.push_back(ProfileFormat::TEXT);
+        else if (format == "json")
+            native_reports.push_back(ProfileFormat::JSON);
+        else if (format == "chrome")
+            native_reports.push_back(ProfileFormat::CHROME_TRACE);
+        else if (!format.empty())
+            LogicError("Unknown HYDROGEN_PROFILE format \"", format, "\"");
+    }
+    native_epoch = Clock::now().time_since_epoch().count();
+    EnableNativeProfiling(
+        std::find(native_reports.begin(), native_reports.end(),
+                  ProfileFormat::CHROME_TRACE) != native_reports.end());
+}
+
+void FinalizeProfiling()
+{
+    DisableNativeProfiling();
+    if (native_reports.empty() || mpi::Finalized())
+        return;
+
+    char const* env = std::getenv("HYDROGEN_PROFILE_FILE");
+    std::string const prefix = env ? env : "hydrogen_profile";
+    int const commRank = mpi::Rank(mpi::COMM_WORLD);
+    for (auto format : native_reports)
+    {
+        switch (format)
+        {
+        case ProfileFormat::TEXT:
+            ReportProfile(std::cerr, format);
+            break;
+        case ProfileFormat::JSON:
+        {
+            std::ofstream file;
+            if (commRank == 0)
+                file.open(prefix + ".json");
+            ReportProfile(file, format);
+            break;
+        }
+        case ProfileFormat::CHROME_TRACE:
+        {
+            std::ofstream file(
+                prefix + "." + std::to_string(commRank) + ".trace.json");
+            ReportProfile(file, format);
+            break;
+        }
+        }
+    }
+    native_reports.clear();
+}
+
 Color GetNextProfilingColor() noexcept
 {
     auto id = current_color.fetch_add(1, std::memory_order_relaxed);
@@ -123,6 +624,22 @@ void BeginRegionProfile(char const* s, Color c) noexcept
     }
 #endif // HYDROGEN_HAVE_VTUNE
 
+    try
+    {
+        if (native_enabled)
+        {
+            open_regions_recorded.push_back(false);
+            NativeBegin(s);
+            open_regions_recorded.back() = true;
+        }
+        else if (!open_regions_recorded.empty())
+            open_regions_recorded.push_back(false);
+    }
+    catch (...)
+    {
+        // Profiling must not change the behavior of the program
+    }
+
     // Just so there are no nasty compiler warnings
     (void) s;
     (void) c;
@@ -130,6 +647,22 @@ void BeginRegionProfile(char const* s, Color c) noexcept
 
 void EndRegionProfile(const char *) noexcept
 {
+    // Regions opened while enabled are closed even if the profiler has
+    // since been disabled, and only those
+    if (!open_regions_recorded.empty())
+    {
+        bool const recorded = open_regions_recorded.back();
+        open_regions_recorded.pop_back();
+        try
+        {
+            if (recorded)
+                NativeEnd();
+        }
+        catch (...)
+        {
+        }
+    }
+
 #ifdef HYDROGEN_HAVE_NVPROF
     if (NVProfRuntimeEnabled())
         nvtxRangePop();
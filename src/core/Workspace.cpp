@@ -0,0 +1,230 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "El-lite.hpp"
+#include "El/core/Workspace.hpp"
+
+namespace El
+{
+
+namespace
+{
+
+// Blocks are rounded up to cache lines so that consecutive buffers do not
+// share them
+const size_t alignment = 64;
+const size_t minChunkSize = size_t(1) << 20;
+
+size_t RoundUp(size_t size)
+{ return ((size + alignment - 1) / alignment) * alignment; }
+
+struct Chunk
+{
+    char* data;
+    size_t capacity;
+    size_t offset;
+};
+
+struct Arena
+{
+    std::vector<Chunk> chunks;
+    size_t current = 0;
+    int depth = 0;
+#ifndef EL_RELEASE
+    // The outstanding blocks, in allocation order, and the blocks which
+    // were still outstanding when their scope closed
+    std::vector<std::pair<void*,size_t>> outstanding, dangling;
+#endif
+
+    ~Arena()
+    {
+        for (auto& chunk : chunks)
+            std::free(chunk.data);
+    }
+
+    Chunk NewChunk(size_t capacity)
+    {
+        // Over-allocate so that the first block can be aligned
+        char* data = static_cast<char*>(std::malloc(capacity + alignment));
+        if (data == nullptr)
+            throw std::bad_alloc();
+        return Chunk{data, capacity, 0};
+    }
+
+    char* Base(const Chunk& chunk) const
+    {
+        const size_t address = reinterpret_cast<size_t>(chunk.data);
+        return chunk.data + (RoundUp(address) - address);
+    }
+
+    // Replace the chunks with a single chunk of the same total capacity
+    void Coalesce()
+    {
+        size_t capacity = 0;
+        for (auto& chunk : chunks)
+        {
+            capacity += chunk.capacity;
+            std::free(chunk.data);
+        }
+        chunks.clear();
+        chunks.push_back(NewChunk(capacity));
+        current = 0;
+    }
+};
+
+Arena& ThreadArena()
+{
+    static thread_local Arena arena;
+    return arena;
+}
+
+} // namespace <anon>
+
+namespace workspace
+{
+
+bool Active() noexcept
+{ return ThreadArena().depth > 0; }
+
+void* Allocate(size_t size)
+{
+    Arena& arena = ThreadArena();
+    size = RoundUp(size);
+    if (arena.chunks.empty())
+        arena.chunks.push_back(arena.NewChunk(std::max(size, minChunkSize)));
+
+    Chunk* chunk = &arena.chunks[arena.current];
+    if (chunk->offset + size > chunk->capacity)
+    {
+        // Move on to the next chunk, replacing it if it is too small
+        const size_t next = arena.current + 1;
+        const size_t capacity = std::max(size, 2*chunk->capacity);
+        if (next == arena.chunks.size())
+        {
+            arena.chunks.push_back(arena.NewChunk(capacity));
+        }
+        else if (arena.chunks[next].capacity < size)
+        {
+            std::free(arena.chunks[next].data);
+            arena.chunks[next] = arena.NewChunk(capacity);
+        }
+        arena.current = next;
+        chunk = &arena.chunks[next];
+        chunk->offset = 0;
+    }
+
+    void* ptr = arena.Base(*chunk) + chunk->offset;
+    chunk->offset += size;
+#ifndef EL_RELEASE
+    arena.outstanding.emplace_back(ptr, size);
+#endif
+    return ptr;
+}
+
+void Release(void* ptr, size_t size)
+{
+    Arena& arena = ThreadArena();
+    size = RoundUp(size);
+#ifndef EL_RELEASE
+    auto& dangling = arena.dangling;
+    auto danglingIter =
+      std::find(dangling.begin(), dangling.end(), std::make_pair(ptr, size));
+    if (danglingIter != dangling.end())
+    {
+        dangling.erase(danglingIter);
+        LogicError
+        ("Released a workspace block of ",size," bytes which outlived the "
+         "WorkspaceScope it was allocated in");
+    }
+    auto& outstanding = arena.outstanding;
+    auto iter =
+      std::find(outstanding.begin(), outstanding.end(),
+                std::make_pair(ptr, size));
+    if (iter == outstanding.end())
+        LogicError
+        ("Released a workspace block of ",size," bytes which was not "
+         "allocated from the workspace");
+    if (iter+1 != outstanding.end())
+        LogicError
+        ("Workspace blocks must be released in LIFO order, but ",
+         outstanding.end()-iter-1," blocks allocated later are outstanding");
+    outstanding.pop_back();
+#endif
+    if (arena.chunks.empty())
+        return;
+    Chunk& chunk = arena.chunks[arena.current];
+    if (chunk.offset >= size &&
+        static_cast<char*>(ptr) == arena.Base(chunk) + chunk.offset - size)
+        chunk.offset -= size;
+}
+
+size_t NumOutstanding() noexcept
+{
+#ifndef EL_RELEASE
+    return ThreadArena().outstanding.size();
+#else
+    return 0;
+#endif
+}
+
+size_t Capacity() noexcept
+{
+    size_t capacity = 0;
+    for (const auto& chunk : ThreadArena().chunks)
+        capacity += chunk.capacity;
+    return capacity;
+}
+
+} // namespace workspace
+
+WorkspaceScope::WorkspaceScope()
+{
+    Arena& arena = ThreadArena();
+    chunk_ = arena.current;
+    offset_ = arena.chunks.empty() ? 0 : arena.chunks[arena.current].offset;
+#ifndef EL_RELEASE
+    numOutstanding_ = arena.outstanding.size();
+#endif
+    ++arena.depth;
+}
+
+WorkspaceScope::~WorkspaceScope()
+{
+    Arena& arena = ThreadArena();
+#ifndef EL_RELEASE
+    // Blocks which are still outstanding now dangle. Their memory is not
+    // reclaimed until they are released, which then fails, so that the
+    // stale release cannot reclaim a block which reused it.
+    auto& outstanding = arena.outstanding;
+    arena.dangling.insert
+    (arena.dangling.end(), outstanding.begin()+numOutstanding_,
+     outstanding.end());
+    outstanding.resize(numOutstanding_);
+    if (!arena.dangling.empty())
+    {
+        --arena.depth;
+        return;
+    }
+#endif
+    if (!arena.chunks.empty())
+    {
+        for (size_t chunk = chunk_+1; chunk <= arena.current; ++chunk)
+            arena.chunks[chunk].offset = 0;
+        arena.current = chunk_;
+        arena.chunks[chunk_].offset = offset_;
+    }
+    if (--arena.depth == 0 && arena.chunks.size() > 1)
+        arena.Coalesce();
+}
+
+} // namespace El
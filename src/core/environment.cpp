@@ -8,8 +8,10 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/core/Profiling.hpp>
 
 #include <algorithm>
+#include <cstdlib>
 #include <set>
 
 namespace {
@@ -318,6 +320,8 @@ void Initialize( int& argc, char**& argv )
     // Create the types and ops.
     // mpfr::SetPrecision within InitializeRandom created the BigFloat types
     mpi::CreateCustom();
+
+    InitializeProfiling();
 }
 
 void Finalize()
@@ -337,6 +341,20 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        const char* poolStats = std::getenv("HYDROGEN_MEMORY_POOL_STATS");
+        if( poolStats && string(poolStats) != "0" && !mpi::Finalized() )
+        {
+            ostringstream os;
+            os << "Process " << mpi::Rank(mpi::COMM_WORLD) << ":\n";
+            PrintMemoryPoolStatistics( os );
+            cerr << os.str();
+        }
+
+        if( mpi::CollectCommStats() && !mpi::Finalized() )
+            mpi::ReportCommStats( cerr );
+
+        FinalizeProfiling();
+
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -356,6 +374,8 @@ void Finalize()
 #endif
 
         FinalizeRandom();
+
+        hydrogen::FinalizeCPUStreams();
     }
 
 #ifdef HYDROGEN_HAVE_CUDA
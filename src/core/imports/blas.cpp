@@ -22,6 +22,9 @@ using El::dcomplex;
 #include "./blas/Scal.hpp"
 #include "./blas/Swap.hpp"
 
+// Mixed-precision support
+#include "./blas/Half.hpp"
+
 // Level 2
 #include "./blas/Gemv.hpp"
 #include "./blas/Ger.hpp"
@@ -32,6 +35,7 @@ using El::dcomplex;
 #include "./blas/Trsv.hpp"
 
 // Level 3
+#include "./blas/Packed.hpp"
 #include "./blas/Gemm.hpp"
 #include "./blas/Symm.hpp"
 #include "./blas/Syrk.hpp"
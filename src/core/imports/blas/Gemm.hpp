@@ -78,187 +78,11 @@ void Gemm
                 C[i+j*CLDim] *= beta;
     }
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
-    {
-        // C := alpha A B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt l=0; l<k; ++l )
-            {
-                gamma = alpha;
-                gamma *= B[l+j*BLDim];
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= gamma;
-                    C[i+j*CLDim] += delta;
-                }
-            }
-        }
-    }
-    else if( std::toupper(transA) == 'N' )
-    {
-        if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    gamma = alpha;
-                    gamma *= B[j+l*BLDim];
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt l=0; l<k; ++l )
-                {
-                    Conj( B[j+l*BLDim], gamma );
-                    gamma *= alpha;
-                    for( BlasInt i=0; i<m; ++i )
-                    {
-                        delta = A[i+l*ALDim];
-                        delta *= gamma;
-                        C[i+j*CLDim] += delta;
-                    }
-                }
-            }
-        }
-    }
-    else if( std::toupper(transB) == 'N' )
-    {
-        if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[l+j*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
-    else
-    {
-        if( std::toupper(transA) == 'T' && std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^T B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transA) == 'T' )
-        {
-            // C := alpha A^T B^H + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], delta );
-                        delta *= A[l+i*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else if( std::toupper(transB) == 'T' )
-        {
-            // C := alpha A^H B^T + C
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= B[j+l*BLDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            // C := alpha A^H B^H + C
-            T phi;
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<m; ++i )
-                {
-                    gamma = TypeTraits<T>::Zero();
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        Conj( B[j+l*BLDim], phi );
-                        delta *= phi;
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-    }
+    packed::Multiply
+    ( m, n, k, alpha,
+      packed::Dense<T>(A,ALDim,transA),
+      packed::Dense<T>(B,BLDim,transB),
+      C, CLDim );
 }
 template void Gemm
 ( char transA, char transB,
@@ -320,16 +144,6 @@ template void Gemm
   const Complex<Quad>& beta,
         Complex<Quad>* C, BlasInt CLDim );
 #endif
-#ifdef HYDROGEN_HAVE_HALF
-template void Gemm
-( char transA, char transB,
-  BlasInt m, BlasInt n, BlasInt k,
-  const cpu_half_type& alpha,
-  const cpu_half_type* A, BlasInt ALDim,
-  const cpu_half_type* B, BlasInt BLDim,
-  const cpu_half_type& beta,
-        cpu_half_type* C, BlasInt CLDim );
-#endif
 #ifdef HYDROGEN_GPU_USE_FP16
 template void Gemm(char transA, char transB,
                    BlasInt m, BlasInt n, BlasInt k,
@@ -532,5 +346,75 @@ void Gemm
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
 
+#ifdef HYDROGEN_HAVE_HALF
+// Each MC x NC block of C is widened to single precision, accumulated into
+// by the single-precision BLAS using widened KC-deep blocks of op(A) and
+// op(B), and then rounded back to half precision
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const cpu_half_type& alpha,
+  const cpu_half_type* A, BlasInt ALDim,
+  const cpu_half_type* B, BlasInt BLDim,
+  const cpu_half_type& beta,
+        cpu_half_type* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    using namespace half_precision;
+    const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
+    const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    const float alphaF = float(alpha);
+    const float betaF = float(beta);
+    const float one = 1;
+
+    const BlasInt mcMax = Min(MC,m);
+    const BlasInt ncMax = Min(NC,n);
+    const BlasInt kcMax = Min(KC,k);
+    std::vector<float> AF(mcMax*kcMax), BF(kcMax*ncMax), CF(mcMax*ncMax);
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt ic=0; ic<m; ic+=MC )
+        {
+            const BlasInt mc = Min(MC,m-ic);
+            if( betaF == 0.f )
+            {
+                std::fill( CF.begin(), CF.begin()+mc*nc, 0.f );
+            }
+            else
+            {
+                ToFloat( mc, nc, &C[ic+jc*CLDim], CLDim, CF.data() );
+                if( betaF != 1.f )
+                    for( BlasInt s=0; s<mc*nc; ++s )
+                        CF[s] *= betaF;
+            }
+            if( alphaF != 0.f )
+            {
+                for( BlasInt pc=0; pc<k; pc+=KC )
+                {
+                    const BlasInt kc = Min(KC,k-pc);
+                    if( normalA )
+                        ToFloat( mc, kc, &A[ic+pc*ALDim], ALDim, AF.data() );
+                    else
+                        ToFloat( kc, mc, &A[pc+ic*ALDim], ALDim, AF.data() );
+                    if( normalB )
+                        ToFloat( kc, nc, &B[pc+jc*BLDim], BLDim, BF.data() );
+                    else
+                        ToFloat( nc, kc, &B[jc+pc*BLDim], BLDim, BF.data() );
+                    const BlasInt AFLDim = ( normalA ? mc : kc );
+                    const BlasInt BFLDim = ( normalB ? kc : nc );
+                    EL_BLAS(sgemm)
+                    ( &fixedTransA, &fixedTransB, &mc, &nc, &kc,
+                      &alphaF, AF.data(), &AFLDim, BF.data(), &BFLDim,
+                      &one, CF.data(), &mc );
+                }
+            }
+            FromFloat( mc, nc, CF.data(), &C[ic+jc*CLDim], CLDim );
+        }
+    }
+}
+#endif // HYDROGEN_HAVE_HALF
+
 } // namespace blas
 } // namespace El
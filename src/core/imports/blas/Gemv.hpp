@@ -171,15 +171,6 @@ template void Gemv
   const Complex<QuadDouble>& beta,
         Complex<QuadDouble>* y, BlasInt incy );
 #endif
-#ifdef HYDROGEN_HAVE_HALF
-template void Gemv
-( char trans, BlasInt m, BlasInt n, 
-  const cpu_half_type& alpha,
-  const cpu_half_type* A, BlasInt ALDim,
-  const cpu_half_type* x, BlasInt incx, 
-  const cpu_half_type& beta,
-        cpu_half_type* y, BlasInt incy );
-#endif
 #ifdef HYDROGEN_HAVE_QUADMATH
 template void Gemv
 ( char trans, BlasInt m, BlasInt n, 
@@ -266,5 +257,55 @@ void Gemv
 { EL_BLAS(zgemv)
   ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
 
+#ifdef HYDROGEN_HAVE_HALF
+// The vectors are widened to single precision once, while A is widened in
+// blocks of columns which are applied by the single-precision BLAS
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const cpu_half_type& alpha,
+  const cpu_half_type* A, BlasInt ALDim,
+  const cpu_half_type* x, BlasInt incx,
+  const cpu_half_type& beta,
+        cpu_half_type* y, BlasInt incy )
+{
+    using namespace half_precision;
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    const float alphaF = float(alpha);
+    const float betaF = float(beta);
+    const float one = 1;
+    const BlasInt xLength = ( normal ? n : m );
+    const BlasInt yLength = ( normal ? m : n );
+
+    std::vector<float> xF(xLength), yF(yLength);
+    for( BlasInt i=0; i<xLength; ++i )
+        xF[i] = float(x[i*incx]);
+    for( BlasInt i=0; i<yLength; ++i )
+        yF[i] = ( betaF == 0.f ? 0.f : betaF*float(y[i*incy]) );
+
+    if( alphaF != 0.f && m > 0 )
+    {
+        const BlasInt incOne = 1;
+        std::vector<float> AF(m*Min(KC,n));
+        for( BlasInt jc=0; jc<n; jc+=KC )
+        {
+            const BlasInt nc = Min(KC,n-jc);
+            ToFloat( m, nc, &A[jc*ALDim], ALDim, AF.data() );
+            if( normal )
+                EL_BLAS(sgemv)
+                ( &fixedTrans, &m, &nc, &alphaF, AF.data(), &m,
+                  &xF[jc], &incOne, &one, yF.data(), &incOne );
+            else
+                EL_BLAS(sgemv)
+                ( &fixedTrans, &m, &nc, &alphaF, AF.data(), &m,
+                  xF.data(), &incOne, &one, &yF[jc], &incOne );
+        }
+    }
+
+    for( BlasInt i=0; i<yLength; ++i )
+        y[i*incy] = cpu_half_type(yF[i]);
+}
+#endif // HYDROGEN_HAVE_HALF
+
 } // namespace blas
 } // namespace El
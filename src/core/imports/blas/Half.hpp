@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Conversions between cpu_half_type and float for the mixed-precision
+// Gemm and Gemv kernels. Blocks of half-precision data are widened into
+// single-precision workspaces so that the products can be formed (and
+// accumulated) by the vendor's single-precision BLAS, and the results are
+// rounded back to half precision once at the end. The conversions use the
+// F16C instructions when they are available.
+
+#ifdef HYDROGEN_HAVE_HALF
+
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+namespace El {
+namespace blas {
+namespace half_precision {
+
+static_assert(sizeof(cpu_half_type) == sizeof(std::uint16_t),
+              "cpu_half_type is expected to be a 16-bit type");
+
+// Blocking for the conversion workspaces
+const BlasInt MC = 256;
+const BlasInt KC = 256;
+const BlasInt NC = 2048;
+
+inline void ToFloat( BlasInt n, const cpu_half_type* x, float* y )
+{
+    BlasInt i=0;
+#ifdef __F16C__
+    for( ; i+8<=n; i+=8 )
+    {
+        const __m128i h =
+          _mm_loadu_si128( reinterpret_cast<const __m128i*>(&x[i]) );
+        _mm256_storeu_ps( &y[i], _mm256_cvtph_ps(h) );
+    }
+#endif
+    for( ; i<n; ++i )
+        y[i] = float(x[i]);
+}
+
+inline void FromFloat( BlasInt n, const float* x, cpu_half_type* y )
+{
+    BlasInt i=0;
+#ifdef __F16C__
+    for( ; i+8<=n; i+=8 )
+    {
+        const __m128i h =
+          _mm256_cvtps_ph( _mm256_loadu_ps(&x[i]), _MM_FROUND_TO_NEAREST_INT );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>(&y[i]), h );
+    }
+#endif
+    for( ; i<n; ++i )
+        y[i] = cpu_half_type(x[i]);
+}
+
+// Widen the m x n column-major matrix A into the contiguous matrix AF
+inline void ToFloat
+( BlasInt m, BlasInt n, const cpu_half_type* A, BlasInt ALDim, float* AF )
+{
+    EL_PARALLEL_FOR
+    for( BlasInt j=0; j<n; ++j )
+        ToFloat( m, &A[j*ALDim], &AF[j*m] );
+}
+
+// Round the contiguous m x n matrix AF into the column-major matrix A
+inline void FromFloat
+( BlasInt m, BlasInt n, const float* AF, cpu_half_type* A, BlasInt ALDim )
+{
+    EL_PARALLEL_FOR
+    for( BlasInt j=0; j<n; ++j )
+        FromFloat( m, &AF[j*m], &A[j*ALDim] );
+}
+
+} // namespace half_precision
+} // namespace blas
+} // namespace El
+
+#endif // HYDROGEN_HAVE_HALF
@@ -0,0 +1,287 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// A packed-panel matrix-multiplication engine for the scalar types which
+// are not supported by the vendor BLAS (e.g., DoubleDouble, QuadDouble,
+// Quad, BigFloat, and cpu_half_type). It follows the usual
+// Goto/BLIS decomposition:
+//
+//   for each NC-wide column block of C (jc),
+//     for each KC-deep block of the summation dimension (pc),
+//       pack alpha op(B)(pc,jc) into NR-wide micro-panels,
+//       for each MC-tall row block of C (ic),
+//         pack op(A)(ic,pc) into MR-tall micro-panels,
+//         update C(ic,jc) with an MR x NR register-blocked micro-kernel,
+//
+// where the micro-panels of op(B) within the macro-kernel are distributed
+// over OpenMP threads. The operands are read through small accessor
+// objects so that the symmetric/Hermitian and triangular fallbacks can
+// reuse the same engine without forming explicit copies of their
+// structured operands.
+
+namespace El {
+namespace blas {
+namespace packed {
+
+// Register blocking (MR x NR), along with the L1 (KC), L2 (MC), and
+// L3 (NC) blocking. Extended-precision scalars are large and expensive
+// enough that the same modest parameters are reasonable for all of them.
+const BlasInt MR = 4;
+const BlasInt NR = 4;
+const BlasInt KC = 128;
+const BlasInt MC = 64;
+const BlasInt NC = 1024;
+
+// op(A)(i,j) of a general column-major matrix, where op is determined
+// by the BLAS 'N', 'T', or 'C' character.
+template<typename T>
+struct Dense
+{
+    const T* A;
+    BlasInt ALDim;
+    bool transpose;
+    bool conjugate;
+
+    Dense( const T* A_, BlasInt ALDim_, char trans )
+    : A(A_), ALDim(ALDim_),
+      transpose(std::toupper(trans) != 'N'),
+      conjugate(std::toupper(trans) == 'C')
+    { }
+
+    void Get( BlasInt i, BlasInt j, T& alpha ) const
+    {
+        if( !transpose )
+            alpha = A[i+j*ALDim];
+        else if( conjugate )
+            Conj( A[j+i*ALDim], alpha );
+        else
+            alpha = A[j+i*ALDim];
+    }
+};
+
+// A symmetric (or Hermitian, if 'conjugate' is true) matrix stored in the
+// specified triangle.
+template<typename T>
+struct Symmetric
+{
+    const T* A;
+    BlasInt ALDim;
+    bool lower;
+    bool conjugate;
+
+    Symmetric( const T* A_, BlasInt ALDim_, char uplo, bool conjugate_ )
+    : A(A_), ALDim(ALDim_),
+      lower(std::toupper(uplo) == 'L'), conjugate(conjugate_)
+    { }
+
+    void Get( BlasInt i, BlasInt j, T& alpha ) const
+    {
+        if( lower ? i >= j : i <= j )
+            alpha = A[i+j*ALDim];
+        else if( conjugate )
+            Conj( A[j+i*ALDim], alpha );
+        else
+            alpha = A[j+i*ALDim];
+    }
+};
+
+// op(A)(i,j) of a triangular matrix stored in the specified triangle,
+// with an implicit unit diagonal if requested.
+template<typename T>
+struct Triangular
+{
+    Dense<T> dense;
+    bool lower;
+    bool unitDiag;
+
+    Triangular
+    ( const T* A, BlasInt ALDim, char uplo, char trans, char unit )
+    : dense(A,ALDim,trans),
+      lower(std::toupper(uplo) == 'L'),
+      unitDiag(std::toupper(unit) == 'U')
+    { }
+
+    void Get( BlasInt i, BlasInt j, T& alpha ) const
+    {
+        const BlasInt iStored = ( dense.transpose ? j : i );
+        const BlasInt jStored = ( dense.transpose ? i : j );
+        if( iStored == jStored && unitDiag )
+            alpha = TypeTraits<T>::One();
+        else if( lower ? iStored >= jStored : iStored <= jStored )
+            dense.Get( i, j, alpha );
+        else
+            alpha = TypeTraits<T>::Zero();
+    }
+};
+
+// Pack the mc x kc block of op(A) beginning at (i0,l0) into MR-tall
+// micro-panels, padding the last panel with zeros
+template<typename T,typename OpA>
+void PackA
+( BlasInt mc, BlasInt kc, const OpA& opA, BlasInt i0, BlasInt l0, T* APack )
+{
+    const BlasInt numPanels = (mc+MR-1) / MR;
+    EL_PARALLEL_FOR
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        const BlasInt iOff = p*MR;
+        const BlasInt mr = Min(MR,mc-iOff);
+        T* panel = &APack[iOff*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+                opA.Get( i0+iOff+i, l0+l, panel[i+l*MR] );
+            for( BlasInt i=mr; i<MR; ++i )
+                panel[i+l*MR] = TypeTraits<T>::Zero();
+        }
+    }
+}
+
+// Pack alpha times the kc x nc block of op(B) beginning at (l0,j0) into
+// NR-wide micro-panels, padding the last panel with zeros
+template<typename T,typename OpB>
+void PackB
+( BlasInt kc, BlasInt nc, const T& alpha,
+  const OpB& opB, BlasInt l0, BlasInt j0, T* BPack )
+{
+    const bool scale = ( alpha != TypeTraits<T>::One() );
+    const BlasInt numPanels = (nc+NR-1) / NR;
+    EL_PARALLEL_FOR
+    for( BlasInt p=0; p<numPanels; ++p )
+    {
+        const BlasInt jOff = p*NR;
+        const BlasInt nr = Min(NR,nc-jOff);
+        T* panel = &BPack[jOff*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                opB.Get( l0+l, j0+jOff+j, panel[j+l*NR] );
+                if( scale )
+                    panel[j+l*NR] *= alpha;
+            }
+            for( BlasInt j=nr; j<NR; ++j )
+                panel[j+l*NR] = TypeTraits<T>::Zero();
+        }
+    }
+}
+
+// Update the mc x nc block of C beginning at (i0,j0) with the product of
+// the packed panels. If 'uplo' is 'L' (or 'U'), only the entries on and
+// below (or above) the diagonal of C are updated.
+template<typename T>
+void MacroKernel
+( BlasInt mc, BlasInt nc, BlasInt kc,
+  const T* APack, const T* BPack,
+  T* C, BlasInt CLDim, BlasInt i0, BlasInt j0, char uplo )
+{
+    const bool lower = ( uplo == 'L' );
+    const bool upper = ( uplo == 'U' );
+    const BlasInt numRowPanels = (mc+MR-1) / MR;
+    const BlasInt numColPanels = (nc+NR-1) / NR;
+    EL_PARALLEL_FOR
+    for( BlasInt q=0; q<numColPanels; ++q )
+    {
+        // NOTE: Temporaries are avoided within the inner loops since
+        //       constructing a BigInt/BigFloat involves a memory allocation
+        T AB[MR*NR];
+        T delta;
+
+        const BlasInt jOff = q*NR;
+        const BlasInt nr = Min(NR,nc-jOff);
+        const T* BPanel = &BPack[jOff*kc];
+        for( BlasInt p=0; p<numRowPanels; ++p )
+        {
+            const BlasInt iOff = p*MR;
+            const BlasInt mr = Min(MR,mc-iOff);
+            const BlasInt iBeg = i0+iOff;
+            const BlasInt jBeg = j0+jOff;
+            if( lower && iBeg+mr-1 < jBeg )
+                continue;
+            if( upper && iBeg > jBeg+nr-1 )
+                continue;
+
+            const T* APanel = &APack[iOff*kc];
+            for( BlasInt s=0; s<MR*NR; ++s )
+                AB[s] = TypeTraits<T>::Zero();
+            for( BlasInt l=0; l<kc; ++l )
+            {
+                const T* a = &APanel[l*MR];
+                const T* b = &BPanel[l*NR];
+                for( BlasInt j=0; j<NR; ++j )
+                {
+                    for( BlasInt i=0; i<MR; ++i )
+                    {
+                        delta = a[i];
+                        delta *= b[j];
+                        AB[i+j*MR] += delta;
+                    }
+                }
+            }
+
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                for( BlasInt i=0; i<mr; ++i )
+                {
+                    if( lower && iBeg+i < jBeg+j )
+                        continue;
+                    if( upper && iBeg+i > jBeg+j )
+                        continue;
+                    C[(iBeg+i)+(jBeg+j)*CLDim] += AB[i+j*MR];
+                }
+            }
+        }
+    }
+}
+
+// C := alpha op(A) op(B) + C, where op(A) is m x k and op(B) is k x n,
+// restricted to the specified triangle of C ('L', 'U', or 'F' for full)
+template<typename T,typename OpA,typename OpB>
+void Multiply
+( BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha, const OpA& opA, const OpB& opB,
+  T* C, BlasInt CLDim, char uplo='F' )
+{
+    if( m == 0 || n == 0 || k == 0 || alpha == TypeTraits<T>::Zero() )
+        return;
+    uplo = std::toupper(uplo);
+
+    const BlasInt mcMax = Min(MC,m);
+    const BlasInt ncMax = Min(NC,n);
+    const BlasInt kcMax = Min(KC,k);
+    std::vector<T> APack( ((mcMax+MR-1)/MR)*MR*kcMax );
+    std::vector<T> BPack( ((ncMax+NR-1)/NR)*NR*kcMax );
+
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+            PackB( kc, nc, alpha, opB, pc, jc, BPack.data() );
+            for( BlasInt ic=0; ic<m; ic+=MC )
+            {
+                const BlasInt mc = Min(MC,m-ic);
+                // Skip row blocks which lie entirely outside of the triangle
+                if( uplo == 'L' && ic+mc-1 < jc )
+                    continue;
+                if( uplo == 'U' && ic > jc+nc-1 )
+                    continue;
+                PackA( mc, kc, opA, ic, pc, APack.data() );
+                MacroKernel
+                ( mc, nc, kc, APack.data(), BPack.data(),
+                  C, CLDim, ic, jc, uplo );
+            }
+        }
+    }
+}
+
+} // namespace packed
+} // namespace blas
+} // namespace El
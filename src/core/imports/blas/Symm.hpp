@@ -88,156 +88,13 @@ void Hemm
                 C[i+j*CLDim] *= beta;
     }
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(side) == 'L' && std::toupper(uplo) == 'L' )
-    {
-        // C := alpha tril(A) B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=0; l<=i; ++l )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= B[l+j*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-
-        // C := alpha tril(A,-1)^H B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=i+1; l<m; ++l )
-                {
-                    Conj( A[l+i*ALDim], delta );
-                    delta *= B[l+j*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-    }
-    else if( std::toupper(side) == 'L' && std::toupper(uplo) == 'U' )
-    {
-        // C := alpha triu(A) B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=i; l<m; ++l )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= B[l+j*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-
-        // C := alpha triu(A,-)^H B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=0; l<i; ++l )
-                {
-                    Conj( A[l+i*ALDim], delta );
-                    delta *= B[l+j*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-    }
-    else if( std::toupper(side) == 'R' && std::toupper(uplo) == 'L' )
-    {
-        // C := alpha B tril(A) + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=j; l<n; ++l )
-                {
-                    delta = B[i+l*BLDim];
-                    delta *= A[l+j*ALDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-
-        // C := alpha B tril(A,-1)^H + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=0; l<j; ++l )
-                {
-                    Conj( A[j+l*ALDim], delta );
-                    delta *= B[i+l*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-    }
-    else if( std::toupper(side) == 'R' && std::toupper(uplo) == 'U' )
-    {
-        // C := alpha B triu(A) + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=0; l<=j; ++l )
-                {
-                    delta = B[i+l*BLDim];
-                    delta *= A[l+j*ALDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-
-        // C := alpha B triu(A,1)^H + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=j+1; l<n; ++l )
-                {
-                    Conj( A[j+l*ALDim], delta );
-                    delta *= B[i+l*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-    }
-    EL_DEBUG_ONLY(
-      else
-          LogicError("Unsuported Hemm option");
-    )
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    packed::Symmetric<T> ASym( A, ALDim, uplo, true );
+    packed::Dense<T> BDense( B, BLDim, 'N' );
+    if( onLeft )
+        packed::Multiply( m, n, m, alpha, ASym, BDense, C, CLDim );
+    else
+        packed::Multiply( m, n, n, alpha, BDense, ASym, C, CLDim );
 }
 template void Hemm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -396,156 +253,13 @@ void Symm
                 C[i+j*CLDim] *= beta;
     }
 
-    // Naive implementation
-    T gamma, delta;
-    if( std::toupper(side) == 'L' && std::toupper(uplo) == 'L' )
-    {
-        // C := alpha tril(A) B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=0; l<=i; ++l )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= B[l+j*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-
-        // C := alpha tril(A,-1)^T B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=i+1; l<m; ++l )
-                {
-                    delta = A[l+i*ALDim];
-                    delta *= B[l+j*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-    }
-    else if( std::toupper(side) == 'L' && std::toupper(uplo) == 'U' )
-    {
-        // C := alpha triu(A) B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=i; l<m; ++l )
-                {
-                    delta = A[i+l*ALDim];
-                    delta *= B[l+j*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-
-        // C := alpha triu(A,-)^T B + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=0; l<i; ++l )
-                {
-                    delta = A[l+i*ALDim];
-                    delta *= B[l+j*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-    }
-    else if( std::toupper(side) == 'R' && std::toupper(uplo) == 'L' )
-    {
-        // C := alpha B tril(A) + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=j; l<n; ++l )
-                {
-                    delta = B[i+l*BLDim];
-                    delta *= A[l+j*ALDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-
-        // C := alpha B tril(A,-1)^T + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=0; l<j; ++l )
-                {
-                    delta = A[j+l*ALDim];
-                    delta *= B[i+l*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-    }
-    else if( std::toupper(side) == 'R' && std::toupper(uplo) == 'U' )
-    {
-        // C := alpha B triu(A) + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=0; l<=j; ++l )
-                {
-                    delta = B[i+l*BLDim];
-                    delta *= A[l+j*ALDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-
-        // C := alpha B triu(A,1)^T + C
-        for( BlasInt j=0; j<n; ++j )
-        {
-            for( BlasInt i=0; i<m; ++i )
-            {
-                gamma = 0;
-                for( BlasInt l=j+1; l<n; ++l )
-                {
-                    delta = A[j+l*ALDim];
-                    delta *= B[i+l*BLDim];
-                    gamma += delta;
-                }
-                gamma *= alpha;
-                C[i+j*CLDim] += gamma;
-            }
-        }
-    }
-    EL_DEBUG_ONLY(
-      else
-          LogicError("Unsuported Symm option");
-    )
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    packed::Symmetric<T> ASym( A, ALDim, uplo, false );
+    packed::Dense<T> BDense( B, BLDim, 'N' );
+    if( onLeft )
+        packed::Multiply( m, n, m, alpha, ASym, BDense, C, CLDim );
+    else
+        packed::Multiply( m, n, n, alpha, BDense, ASym, C, CLDim );
 }
 template void Symm
 ( char side, char uplo, BlasInt m, BlasInt n,
@@ -87,116 +87,33 @@ void Her2k
 
     const T alphaConj = Conj(alpha);
     const bool normal = ( std::toupper(trans) == 'N' );
-    const bool lower = ( std::toupper(uplo) == 'L' );
-
-    T gamma, delta, phi;
     if( normal )
     {
-        // C := alpha A B^H + Conj(alpha) B A^H + beta C
-        if( lower )
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=j; i<n; ++i )
-                {
-                    gamma = 0;
-                    delta = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], phi );
-                        phi *= A[i+l*ALDim];
-                        gamma += phi;
-
-                        Conj( A[j+l*ALDim], phi );
-                        phi *= B[i+l*BLDim];
-                        delta += phi;
-                    }
-                    gamma *= alpha;
-                    delta *= alphaConj;
-                    gamma += delta;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<=j; ++i )
-                {
-                    gamma = 0;
-                    delta = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( B[j+l*BLDim], phi );
-                        phi *= A[i+l*ALDim];
-                        gamma += phi;
-
-                        Conj( A[j+l*ALDim], phi );
-                        phi *= B[i+l*BLDim];
-                        delta += phi;
-                    }
-                    gamma *= alpha;
-                    delta *= alphaConj;
-                    gamma += delta;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        // C := alpha A B^H + Conj(alpha) B A^H + C
+        packed::Multiply
+        ( n, n, k, alpha,
+          packed::Dense<T>(A,ALDim,'N'),
+          packed::Dense<T>(B,BLDim,'C'),
+          C, CLDim, uplo );
+        packed::Multiply
+        ( n, n, k, alphaConj,
+          packed::Dense<T>(B,BLDim,'N'),
+          packed::Dense<T>(A,ALDim,'C'),
+          C, CLDim, uplo );
     }
     else
     {
-        // C := alpha A^H B + Conj(alpha) B^H A + beta C
-        if( lower )
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=j; i<n; ++i )
-                {
-                    gamma = 0;
-                    delta = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], phi );
-                        phi *= B[l+j*BLDim];
-                        gamma += phi;
-
-                        Conj( B[l+i*BLDim], phi );
-                        phi *= A[l+j*ALDim];
-                        delta += phi;
-                    }
-                    gamma *= alpha;
-                    delta *= alphaConj;
-                    gamma += delta;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<=j; ++i )
-                {
-                    gamma = 0;
-                    delta = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], phi );
-                        phi *= B[l+j*BLDim];
-                        gamma += phi;
-
-                        Conj( B[l+i*BLDim], phi );
-                        phi *= A[l+j*ALDim];
-                        delta += phi;
-                    }
-                    gamma *= alpha;
-                    delta *= alphaConj;
-                    gamma += delta;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        // C := alpha A^H B + Conj(alpha) B^H A + C
+        packed::Multiply
+        ( n, n, k, alpha,
+          packed::Dense<T>(A,ALDim,'C'),
+          packed::Dense<T>(B,BLDim,'N'),
+          C, CLDim, uplo );
+        packed::Multiply
+        ( n, n, k, alphaConj,
+          packed::Dense<T>(B,BLDim,'C'),
+          packed::Dense<T>(A,ALDim,'N'),
+          C, CLDim, uplo );
     }
 }
 template void Her2k
@@ -370,104 +287,33 @@ void Syr2k
     }
 
     const bool normal = ( std::toupper(trans) == 'N' );
-    const bool lower = ( std::toupper(uplo) == 'L' );
-
-    T gamma, phi;
     if( normal )
     {
-        // C := alpha A B^T + alpha B A^T + beta C
-        if( lower )
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=j; i<n; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        phi = B[j+l*BLDim];
-                        phi *= A[i+l*ALDim];
-                        gamma += phi;
-
-                        phi = A[j+l*ALDim];
-                        phi *= B[i+l*BLDim];
-                        gamma += phi;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<=j; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        phi = B[j+l*BLDim];
-                        phi *= A[i+l*ALDim];
-                        gamma += phi;
-
-                        phi = A[j+l*ALDim];
-                        phi *= B[i+l*BLDim];
-                        gamma += phi;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        // C := alpha A B^T + alpha B A^T + C
+        packed::Multiply
+        ( n, n, k, alpha,
+          packed::Dense<T>(A,ALDim,'N'),
+          packed::Dense<T>(B,BLDim,'T'),
+          C, CLDim, uplo );
+        packed::Multiply
+        ( n, n, k, alpha,
+          packed::Dense<T>(B,BLDim,'N'),
+          packed::Dense<T>(A,ALDim,'T'),
+          C, CLDim, uplo );
     }
     else
     {
-        // C := alpha A^T B + alpha B^T A + beta C
-        if( lower )
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=j; i<n; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        phi = A[l+i*ALDim];
-                        phi *= B[l+j*BLDim];
-                        gamma += phi;
-
-                        phi = B[l+i*BLDim];
-                        phi *= A[l+j*ALDim];
-                        gamma += phi;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma; 
-                }
-            }
-        }
-        else
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<=j; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        phi = A[l+i*ALDim];
-                        phi *= B[l+j*BLDim];
-                        gamma += phi;
-
-                        phi = B[l+i*BLDim];
-                        phi *= A[l+j*ALDim];
-                        gamma += phi;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        // C := alpha A^T B + alpha B^T A + C
+        packed::Multiply
+        ( n, n, k, alpha,
+          packed::Dense<T>(A,ALDim,'T'),
+          packed::Dense<T>(B,BLDim,'N'),
+          C, CLDim, uplo );
+        packed::Multiply
+        ( n, n, k, alpha,
+          packed::Dense<T>(B,BLDim,'T'),
+          packed::Dense<T>(A,ALDim,'N'),
+          C, CLDim, uplo );
     }
 }
 template void Syr2k
@@ -65,102 +65,40 @@ void Herk
 {
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
+    // Only the referenced triangle of C is scaled
+    const bool lower = ( std::toupper(uplo) == 'L' );
     if( beta == Base<T>(0) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] = 0;
     }
     else if( beta != Base<T>(1) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] *= beta;
     }
 
     const bool normal = ( std::toupper(trans) == 'N' );
-    const bool lower = ( std::toupper(uplo) == 'L' );
-
-    T gamma, delta;
+    const T alphaT( alpha );
     if( normal )
     {
-        // C := alpha A A^H + beta C
-        if( lower )
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=j; i<n; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[j+l*ALDim], delta );
-                        delta *= A[i+l*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<=j; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[j+l*ALDim], delta );
-                        delta *= A[i+l*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        // C := alpha A A^H + C
+        packed::Multiply
+        ( n, n, k, alphaT,
+          packed::Dense<T>(A,ALDim,'N'),
+          packed::Dense<T>(A,ALDim,'C'),
+          C, CLDim, uplo );
     }
     else
     {
-        // C := alpha A^H A + beta C
-        if( lower )
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=j; i<n; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= A[l+j*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<=j; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        Conj( A[l+i*ALDim], delta );
-                        delta *= A[l+j*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        // C := alpha A^H A + C
+        packed::Multiply
+        ( n, n, k, alphaT,
+          packed::Dense<T>(A,ALDim,'C'),
+          packed::Dense<T>(A,ALDim,'N'),
+          C, CLDim, uplo );
     }
 }
 template void Herk
@@ -301,102 +239,39 @@ void Syrk
 {
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
+    // Only the referenced triangle of C is scaled
+    const bool lower = ( std::toupper(uplo) == 'L' );
     if( beta == T(0) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] = 0;
     }
     else if( beta != T(1) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] *= beta;
     }
 
     const bool normal = ( std::toupper(trans) == 'N' );
-    const bool lower = ( std::toupper(uplo) == 'L' );
-
-    T gamma, delta;
     if( normal )
     {
-        // C := alpha A A^T + beta C
-        if( lower )
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=j; i<n; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[j+l*ALDim];
-                        delta *= A[i+l*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<=j; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[j+l*ALDim];
-                        delta *= A[i+l*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        // C := alpha A A^T + C
+        packed::Multiply
+        ( n, n, k, alpha,
+          packed::Dense<T>(A,ALDim,'N'),
+          packed::Dense<T>(A,ALDim,'T'),
+          C, CLDim, uplo );
     }
     else
     {
-        // C := alpha A^T A + beta C
-        if( lower )
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=j; i<n; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= A[l+j*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
-        else
-        {
-            for( BlasInt j=0; j<n; ++j )
-            {
-                for( BlasInt i=0; i<=j; ++i )
-                {
-                    gamma = 0;
-                    for( BlasInt l=0; l<k; ++l )
-                    {
-                        delta = A[l+i*ALDim];
-                        delta *= A[l+j*ALDim];
-                        gamma += delta;
-                    }
-                    gamma *= alpha;
-                    C[i+j*CLDim] += gamma;
-                }
-            }
-        }
+        // C := alpha A^T A + C
+        packed::Multiply
+        ( n, n, k, alpha,
+          packed::Dense<T>(A,ALDim,'T'),
+          packed::Dense<T>(A,ALDim,'N'),
+          C, CLDim, uplo );
     }
 }
 template void Syrk
@@ -46,37 +46,26 @@ void Trmm
         T* B, BlasInt BLDim )
 {
     const bool onLeft = ( std::toupper(side) == 'L' );
-    const bool conjugate = ( std::toupper(trans) == 'C' );
 
-    // Scale B
+    // Overwrite B with alpha op(A) B (or alpha B op(A)) formed from a copy
+    // of B so that the product can be accumulated directly into B
+    std::vector<T> BCopy( m*n );
+    const BlasInt BCopyLDim = Max(m,1);
     for( BlasInt j=0; j<n; ++j )
-        for( BlasInt i=0; i<m; ++i )
-            B[i+j*BLDim] *= alpha;
-
-    // TODO: Legitimate blocked implementations...it seems offensive to
-    //       repeatedly stream all of the triangular matrix through memory
-    //       for each row/column of B
-
-    if( onLeft )
-    {
-        for( BlasInt j=0; j<n; ++j )
-            Trmv( uplo, trans, unit, m, A, ALDim, &B[j*BLDim], 1 );
-    }
-    else
     {
-        char newTrans = ( std::toupper(trans) == 'N' ? 'T' : 'N' );
         for( BlasInt i=0; i<m; ++i )
         {
-            if( conjugate )
-                for( Int j=0; j<n; ++j )
-                    B[i+j*BLDim] = Conj(B[i+j*BLDim]);
-            Trmv( uplo, newTrans, unit, n, A, ALDim, &B[i], BLDim );
-            // TODO: Avoid temporaries here
-            if( conjugate )
-                for( Int j=0; j<n; ++j )
-                    B[i+j*BLDim] = Conj(B[i+j*BLDim]);
+            BCopy[i+j*BCopyLDim] = B[i+j*BLDim];
+            B[i+j*BLDim] = TypeTraits<T>::Zero();
         }
     }
+
+    packed::Triangular<T> ATri( A, ALDim, uplo, trans, unit );
+    packed::Dense<T> BDense( BCopy.data(), BCopyLDim, 'N' );
+    if( onLeft )
+        packed::Multiply( m, n, m, alpha, ATri, BDense, B, BLDim );
+    else
+        packed::Multiply( m, n, n, alpha, BDense, ATri, B, BLDim );
 }
 template void Trmm
 ( char side, char uplo, char trans, char unit,
@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename F>
-void Trsm
+void UnblockedTrsm
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const F& alpha,
@@ -293,6 +293,80 @@ void Trsm
         }
     }
 }
+
+// The blocked algorithm only leaves the diagonal blocks to the unblocked
+// algorithm and casts the remaining updates as packed matrix multiplies
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool opLower = ( (std::toupper(uplo) == 'L') == normal );
+    const BlasInt bsize = packed::KC;
+    if( (onLeft ? m : n) <= bsize )
+    {
+        UnblockedTrsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    // Scale B
+    if( alpha != F(1) )
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+
+    // The address of the top-left entry of op(A)(i:end,j:end)
+    auto opA = [&]( BlasInt i, BlasInt j )
+    { return packed::Dense<F>
+             ( normal ? &A[i+j*ALDim] : &A[j+i*ALDim], ALDim, trans ); };
+    // The column-major view of B(i:end,j:end)
+    auto BSub = [&]( BlasInt i, BlasInt j )
+    { return packed::Dense<F>( &B[i+j*BLDim], BLDim, 'N' ); };
+
+    const BlasInt kDim = ( onLeft ? m : n );
+    for( BlasInt step=0; step<kDim; step+=bsize )
+    {
+        const BlasInt kb = Min(bsize,kDim-step);
+        // Forward substitution for lower-triangular op(A) from the left and
+        // upper-triangular op(A) from the right, backward otherwise
+        const bool forward = ( opLower == onLeft );
+        const BlasInt k = ( forward ? step : kDim-step-kb );
+        const BlasInt kAfter = k+kb;
+
+        if( onLeft )
+        {
+            UnblockedTrsm
+            ( side, uplo, trans, unit, kb, n, F(1),
+              &A[k+k*ALDim], ALDim, &B[k], BLDim );
+            if( forward )
+                packed::Multiply
+                ( m-kAfter, n, kb, F(-1), opA(kAfter,k), BSub(k,0),
+                  &B[kAfter], BLDim );
+            else
+                packed::Multiply
+                ( k, n, kb, F(-1), opA(0,k), BSub(k,0), B, BLDim );
+        }
+        else
+        {
+            UnblockedTrsm
+            ( side, uplo, trans, unit, m, kb, F(1),
+              &A[k+k*ALDim], ALDim, &B[k*BLDim], BLDim );
+            if( forward )
+                packed::Multiply
+                ( m, n-kAfter, kb, F(-1), BSub(0,k), opA(k,kAfter),
+                  &B[kAfter*BLDim], BLDim );
+            else
+                packed::Multiply
+                ( m, k, kb, F(-1), BSub(0,k), opA(k,0), B, BLDim );
+        }
+    }
+}
 #ifdef HYDROGEN_HAVE_QD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
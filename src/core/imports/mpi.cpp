@@ -20,6 +20,12 @@
 #include "mpi_collectives.hpp"
 
 #include <El/core/imports/mpi.hpp>
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <sstream>
 
 typedef unsigned char* UCP;
 
@@ -35,6 +41,13 @@ const int THREAD_FUNNELED = MPI_THREAD_FUNNELED;
 const int THREAD_SERIALIZED = MPI_THREAD_SERIALIZED;
 const int THREAD_MULTIPLE = MPI_THREAD_MULTIPLE;
 const int UNDEFINED = MPI_UNDEFINED;
+const int COMM_TYPE_SHARED = MPI_COMM_TYPE_SHARED;
+// Open MPI provides the socket split type from version 2 on
+#if defined(OPEN_MPI) && OMPI_MAJOR_VERSION >= 2
+const int COMM_TYPE_SOCKET = OMPI_COMM_TYPE_SOCKET;
+#else
+const int COMM_TYPE_SOCKET = MPI_UNDEFINED;
+#endif
 
 const Comm COMM_NULL;
 const Comm COMM_SELF = MakeControllingComm(MPI_COMM_SELF);
@@ -91,9 +104,15 @@ int InitializeThread( int& argc, char**& argv, int required ) EL_NO_EXCEPT
     return provided;
 }
 
+namespace /* <anon> */
+{
+void FreeSharedWindows();
+} // namespace <anon>
+
 void Finalize() EL_NO_EXCEPT
 {
     AUTO_NOSYNC_PROFILE_REGION("MPI.Finalize");
+    FreeSharedWindows();
 #ifdef HYDROGEN_HAVE_ALUMINUM
     // Making sure finalizing Aluminum before finalizing MPI.
     Al::Finalize();
@@ -189,6 +208,17 @@ void Split( Comm const& comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_
     newComm.Control(tmp);
 }
 
+void SplitType
+( Comm const& comm, int splitType, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE;
+    MPI_Comm tmp;
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_split_type(
+            comm.GetMPIComm(), splitType, key, MPI_INFO_NULL, &tmp ) );
+    newComm.Control(tmp);
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
@@ -224,6 +254,21 @@ bool CongruentToCommWorld( Comm const& comm ) EL_NO_RELEASE_EXCEPT
     return comm.Size() == world_size;// RawCommCongruent(comm.GetMPIcomm, MPI_COMM_WORLD);
 }
 
+void SetName( Comm const& comm, const std::string& name ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE;
+    EL_CHECK_MPI_CALL( MPI_Comm_set_name( comm.GetMPIComm(), name.c_str() ) );
+}
+
+std::string Name( Comm const& comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE;
+    char name[MPI_MAX_OBJECT_NAME];
+    int length;
+    EL_CHECK_MPI_CALL( MPI_Comm_get_name( comm.GetMPIComm(), name, &length ) );
+    return std::string( name, length );
+}
+
 Comm NewWorldComm() EL_NO_RELEASE_EXCEPT
 {
     return Comm{MPI_COMM_WORLD};
@@ -441,6 +486,398 @@ void Barrier( Comm const& comm ) EL_NO_RELEASE_EXCEPT
     EL_CHECK_MPI_CALL( MPI_Barrier( comm.GetMPIComm() ) );
 }
 
+// Node-local shared memory
+// ------------------------
+
+namespace /* <anon> */
+{
+
+bool useSharedMemory = []()
+{
+    const char* use = std::getenv("HYDROGEN_USE_SHARED_MEMORY");
+    return use && std::string(use) != "0";
+}();
+
+// The shared window of a communicator, which is cached as an attribute so
+// that it is freed along with the communicator
+struct SharedWindowState
+{
+    bool onNode;
+    unsigned long long sequence;
+    MPI_Win win = MPI_WIN_NULL;
+    size_t bytesPerProcess = 0;
+    byte* base = nullptr;
+};
+
+int sharedWindowKeyval = MPI_KEYVAL_INVALID;
+
+// The communicators with cached windows, which must be released before MPI
+// is finalized (MPI does not promise to delete the attributes of
+// MPI_COMM_WORLD while the windows may still be freed). Freeing a window is
+// collective, so they are released in the order in which they were first
+// used, which every process agrees on, rather than in handle order.
+unsigned long long numSharedWindowStates = 0;
+std::map<unsigned long long,MPI_Comm> sharedWindowComms;
+
+int FreeSharedWindowState( MPI_Comm, int, void* attribute, void* )
+{
+    auto state = static_cast<SharedWindowState*>(attribute);
+    sharedWindowComms.erase( state->sequence );
+    if( state->win != MPI_WIN_NULL )
+    {
+        MPI_Win_unlock_all( state->win );
+        MPI_Win_free( &state->win );
+    }
+    delete state;
+    return MPI_SUCCESS;
+}
+
+SharedWindowState& GetSharedWindowState( Comm const& comm )
+{
+    if( sharedWindowKeyval == MPI_KEYVAL_INVALID )
+        EL_CHECK_MPI_CALL(
+            MPI_Comm_create_keyval(
+                MPI_COMM_NULL_COPY_FN, FreeSharedWindowState,
+                &sharedWindowKeyval, nullptr ) );
+
+    void* attribute;
+    int found;
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_get_attr(
+            comm.GetMPIComm(), sharedWindowKeyval, &attribute, &found ) );
+    if( found )
+        return *static_cast<SharedWindowState*>(attribute);
+
+    Comm nodeComm;
+    SplitType( comm, COMM_TYPE_SHARED, 0, nodeComm );
+    auto state = new SharedWindowState;
+    state->onNode = ( Size(nodeComm) == Size(comm) );
+    state->sequence = numSharedWindowStates++;
+    EL_CHECK_MPI_CALL(
+        MPI_Comm_set_attr( comm.GetMPIComm(), sharedWindowKeyval, state ) );
+    sharedWindowComms[state->sequence] = comm.GetMPIComm();
+    return *state;
+}
+
+void FreeSharedWindows()
+{
+    if( sharedWindowKeyval == MPI_KEYVAL_INVALID || Finalized() )
+        return;
+    const auto comms = sharedWindowComms;
+    for( const auto& entry : comms )
+        MPI_Comm_delete_attr( entry.second, sharedWindowKeyval );
+    MPI_Comm_free_keyval( &sharedWindowKeyval );
+}
+
+} // namespace <anon>
+
+bool UseSharedMemory() EL_NO_EXCEPT { return useSharedMemory; }
+
+void SetUseSharedMemory( bool use ) EL_NO_EXCEPT { useSharedMemory = use; }
+
+byte* SharedWindow( Comm const& comm, size_t bytesPerProcess )
+{
+    EL_DEBUG_CSE;
+    if( !useSharedMemory || bytesPerProcess == 0 || Size(comm) == 1 )
+        return nullptr;
+    SharedWindowState& state = GetSharedWindowState( comm );
+    if( !state.onNode )
+        return nullptr;
+
+    // Nobody may still be reading the previous contents
+    Barrier( comm );
+    if( bytesPerProcess > state.bytesPerProcess )
+    {
+        if( state.win != MPI_WIN_NULL )
+        {
+            EL_CHECK_MPI_CALL( MPI_Win_unlock_all( state.win ) );
+            EL_CHECK_MPI_CALL( MPI_Win_free( &state.win ) );
+        }
+        // Grow geometrically to avoid frequent reallocation
+        state.bytesPerProcess =
+          std::max( bytesPerProcess, 2*state.bytesPerProcess );
+        void* segment;
+        EL_CHECK_MPI_CALL(
+            MPI_Win_allocate_shared(
+                state.bytesPerProcess, 1, MPI_INFO_NULL, comm.GetMPIComm(),
+                &segment, &state.win ) );
+        MPI_Aint size;
+        int dispUnit;
+        void* base;
+        EL_CHECK_MPI_CALL(
+            MPI_Win_shared_query( state.win, 0, &size, &dispUnit, &base ) );
+        state.base = static_cast<byte*>(base);
+        EL_CHECK_MPI_CALL( MPI_Win_lock_all( MPI_MODE_NOCHECK, state.win ) );
+    }
+    return state.base;
+}
+
+void SharedWindowSync( Comm const& comm )
+{
+    EL_DEBUG_CSE;
+    SharedWindowState& state = GetSharedWindowState( comm );
+    EL_CHECK_MPI_CALL( MPI_Win_sync( state.win ) );
+    Barrier( comm );
+    EL_CHECK_MPI_CALL( MPI_Win_sync( state.win ) );
+}
+
+// Communication statistics
+// ------------------------
+
+namespace /* <anon> */
+{
+
+// Read by every thread making MPI calls
+std::atomic<bool> collectCommStats{ []()
+{
+    const char* collect = std::getenv("HYDROGEN_COMM_STATS");
+    return collect && std::string(collect) != "0";
+}() };
+
+std::mutex commStatsMutex;
+std::map<std::pair<Collective,std::string>,CommStats> commStats;
+
+int SizeBucket( size_t bytes )
+{
+    int bucket = 0;
+    while( bytes > 0 && bucket < CommStats::numSizeBuckets-1 )
+    {
+        bytes >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+// e.g., "8KiB" for 2^13 bytes
+std::string PowerOfTwoBytes( int log2Bytes )
+{
+    const char* units[] = { "B", "KiB", "MiB", "GiB", "TiB" };
+    return std::to_string( size_t(1) << (log2Bytes % 10) )
+      + units[log2Bytes / 10];
+}
+
+std::string SizeBucketName( int bucket )
+{
+    if( bucket == 0 )
+        return "0";
+    if( bucket == CommStats::numSizeBuckets-1 )
+        return ">=" + PowerOfTwoBytes( bucket-1 );
+    return "<" + PowerOfTwoBytes( bucket );
+}
+
+} // namespace <anon>
+
+constexpr int CommStats::numSizeBuckets;
+
+std::string CollectiveName( Collective op )
+{
+    switch( op )
+    {
+    case Collective::ALLGATHER: return "AllGather";
+    case Collective::ALLREDUCE: return "AllReduce";
+    case Collective::ALLTOALL: return "AllToAll";
+    case Collective::BROADCAST: return "Broadcast";
+    case Collective::GATHER: return "Gather";
+    case Collective::REDUCE: return "Reduce";
+    case Collective::REDUCESCATTER: return "ReduceScatter";
+    case Collective::SCATTER: return "Scatter";
+    case Collective::SENDRECV: return "SendRecv";
+    }
+    return "Unknown";
+}
+
+bool CollectCommStats() EL_NO_EXCEPT { return collectCommStats; }
+void SetCollectCommStats( bool collect ) EL_NO_EXCEPT
+{ collectCommStats = collect; }
+
+std::vector<CommStats> GetCommStats()
+{
+    std::lock_guard<std::mutex> lock( commStatsMutex );
+    std::vector<CommStats> stats;
+    for( const auto& entry : commStats )
+        stats.push_back( entry.second );
+    return stats;
+}
+
+void ResetCommStats()
+{
+    std::lock_guard<std::mutex> lock( commStatsMutex );
+    commStats.clear();
+}
+
+void ReportCommStats( std::ostream& os )
+{
+    EL_DEBUG_CSE;
+    const std::vector<CommStats> local = GetCommStats();
+    std::ostringstream packedStream;
+    packedStream << std::setprecision(17);
+    for( const auto& stats : local )
+    {
+        packedStream
+          << int(stats.op) << ' ' << stats.calls << ' ' << stats.bytesSent
+          << ' ' << stats.bytesRecv << ' ' << stats.seconds;
+        for( const auto& count : stats.sizeHistogram )
+            packedStream << ' ' << count;
+        packedStream << ' ' << stats.comm << '\n';
+    }
+    const std::string packed = packedStream.str();
+
+    const Comm& comm = COMM_WORLD;
+    SyncInfo<Device::CPU> syncInfo;
+    const int commRank = Rank( comm );
+    const int commSize = Size( comm );
+    const int size = packed.size();
+    std::vector<int> sizes(commSize), offsets(commSize);
+    Gather( &size, 1, sizes.data(), 1, 0, comm, syncInfo );
+    int totalSize = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offsets[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<byte> all( commRank == 0 ? totalSize : 0 );
+    Gather
+    ( reinterpret_cast<const byte*>(packed.data()), size,
+      all.data(), sizes.data(), offsets.data(), 0, comm, syncInfo );
+    if( commRank != 0 )
+        return;
+
+    // The sums over the processes, with the extreme times of the processes
+    // taking part (those which never made a call count as zero)
+    struct Reduced
+    {
+        CommStats sum;
+        double minSeconds, maxSeconds;
+        int numProcs=0;
+    };
+    std::map<std::pair<Collective,std::string>,Reduced> reduced;
+    std::istringstream is
+    ( std::string( reinterpret_cast<const char*>(all.data()), totalSize ) );
+    int op;
+    CommStats stats;
+    while( is >> op >> stats.calls >> stats.bytesSent >> stats.bytesRecv
+              >> stats.seconds )
+    {
+        for( auto& count : stats.sizeHistogram )
+            is >> count;
+        is.ignore();
+        std::getline( is, stats.comm );
+        stats.op = Collective(op);
+
+        auto& entry = reduced[std::make_pair(stats.op,stats.comm)];
+        if( entry.numProcs++ == 0 )
+        {
+            entry.sum = stats;
+            entry.minSeconds = entry.maxSeconds = stats.seconds;
+            continue;
+        }
+        entry.sum.calls += stats.calls;
+        entry.sum.bytesSent += stats.bytesSent;
+        entry.sum.bytesRecv += stats.bytesRecv;
+        entry.sum.seconds += stats.seconds;
+        entry.minSeconds = std::min( entry.minSeconds, stats.seconds );
+        entry.maxSeconds = std::max( entry.maxSeconds, stats.seconds );
+        for( int k=0; k<CommStats::numSizeBuckets; ++k )
+            entry.sum.sizeHistogram[k] += stats.sizeHistogram[k];
+    }
+
+    std::ostringstream report;
+    report << "Communication over " << commSize << " processes "
+           << "(sums over the processes; times in seconds)\n"
+           << std::left << std::setw(15) << "Operation"
+           << std::setw(20) << "Comm" << std::right
+           << std::setw(10) << "Calls"
+           << std::setw(14) << "Bytes sent"
+           << std::setw(14) << "Bytes recv"
+           << std::setw(12) << "Time"
+           << std::setw(12) << "Time min"
+           << std::setw(12) << "Time max" << '\n';
+    for( const auto& entry : reduced )
+    {
+        const Reduced& r = entry.second;
+        const double minSeconds = r.numProcs < commSize ? 0 : r.minSeconds;
+        const std::string commName =
+          r.sum.comm.empty() ? "(unnamed)" : r.sum.comm;
+        report << std::left << std::setw(15) << CollectiveName(r.sum.op)
+               << std::setw(20) << commName << std::right
+               << std::setw(10) << r.sum.calls
+               << std::scientific << std::setprecision(3)
+               << std::setw(14) << double(r.sum.bytesSent)
+               << std::setw(14) << double(r.sum.bytesRecv)
+               << std::setw(12) << r.sum.seconds
+               << std::setw(12) << minSeconds
+               << std::setw(12) << r.maxSeconds << '\n'
+               << std::defaultfloat << "  sizes:";
+        for( int k=0; k<CommStats::numSizeBuckets; ++k )
+            if( r.sum.sizeHistogram[k] != 0 )
+                report << ' ' << SizeBucketName(k) << ':'
+                       << r.sum.sizeHistogram[k];
+        report << '\n';
+    }
+    os << report.str();
+}
+
+namespace internal
+{
+
+bool RecordingComm() EL_NO_EXCEPT
+{ return collectCommStats || NativeProfilingEnabled(); }
+
+CommRecorder::CommRecorder(
+    Collective op, Comm const& comm, size_t bytesSent, size_t bytesRecv)
+    : active_{true}, profiling_{NativeProfilingEnabled()},
+      op_{op}, comm_{comm.GetMPIComm()},
+      bytesSent_{bytesSent}, bytesRecv_{bytesRecv}
+{
+    if( profiling_ )
+    {
+        BeginRegionProfile
+        ( ("MPI."+CollectiveName(op_)).c_str(), Color::PURPLE_HEART );
+        AddProfileBytes( bytesSent_+bytesRecv_ );
+    }
+    start_ = Clock::now();
+}
+
+CommRecorder::CommRecorder(CommRecorder&& other) noexcept
+    : active_{other.active_}, profiling_{other.profiling_},
+      op_{other.op_}, comm_{other.comm_},
+      bytesSent_{other.bytesSent_}, bytesRecv_{other.bytesRecv_},
+      start_{other.start_}
+{
+    other.active_ = false;
+}
+
+CommRecorder::~CommRecorder()
+{
+    if( !active_ )
+        return;
+    const double seconds =
+      std::chrono::duration<double>( Clock::now()-start_ ).count();
+    if( profiling_ )
+        EndRegionProfile( ("MPI."+CollectiveName(op_)).c_str() );
+    if( !collectCommStats )
+        return;
+
+    char name[MPI_MAX_OBJECT_NAME];
+    int length = 0;
+    MPI_Comm_get_name( comm_, name, &length );
+    std::lock_guard<std::mutex> lock( commStatsMutex );
+    CommStats& stats =
+      commStats[std::make_pair(op_,std::string(name,length))];
+    if( stats.calls == 0 )
+    {
+        stats.op = op_;
+        stats.comm.assign( name, length );
+    }
+    ++stats.calls;
+    stats.bytesSent += bytesSent_;
+    stats.bytesRecv += bytesRecv_;
+    stats.seconds += seconds;
+    ++stats.sizeHistogram[SizeBucket(std::max(bytesSent_,bytesRecv_))];
+}
+
+} // namespace internal
+
 // Test for completion
 template <typename T>
 bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT
@@ -522,6 +959,7 @@ void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
         request.receivingPacked = false;
     }
     request.buffer.clear();
+    request.sendBuffer.clear();
 }
 
 template <typename T,
@@ -562,6 +1000,7 @@ EL_NO_RELEASE_EXCEPT
             requests[j].receivingPacked = false;
         }
         requests[j].buffer.clear();
+        requests[j].sendBuffer.clear();
     }
 }
 
@@ -1021,6 +1460,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::SENDRECV, comm,
+        sizeof(Real)*sc, sizeof(Real)*rc);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1046,6 +1488,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::SENDRECV, comm,
+        sizeof(Complex<Real>)*sc, sizeof(Complex<Real>)*rc);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1080,6 +1525,9 @@ void TaggedSendRecv(
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::SENDRECV, comm,
+        sizeof(T)*sc, sizeof(T)*rc);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_SEND_BUFFER(sbuf, sc, syncInfo);
@@ -1126,6 +1574,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::SENDRECV, comm,
+        sizeof(Real)*count, sizeof(Real)*count);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1148,6 +1599,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::SENDRECV, comm,
+        sizeof(Complex<Real>)*count, sizeof(Complex<Real>)*count);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1178,6 +1632,9 @@ void TaggedSendRecv(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::SENDRECV, comm,
+        sizeof(T)*count, sizeof(T)*count);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     ENSURE_HOST_INPLACE_BUFFER(buf, count, syncInfo);
@@ -1318,6 +1775,351 @@ void IGather
         &request.backend ) );
 }
 
+// Non-blocking reductions and exchanges
+// =====================================
+
+#ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
+// The staged host copies of device buffers do not outlive the call, so
+// device data is communicated with the blocking collective
+#define COMPLETE_IF_STAGED(request, blocking_call)      \
+    if( D != Device::CPU )                              \
+    {                                                   \
+        blocking_call;                                  \
+        request.backend = MPI_REQUEST_NULL;             \
+        return;                                         \
+    }
+#else
+#define COMPLETE_IF_STAGED(request, blocking_call)
+#endif // HYDROGEN_ENSURE_HOST_MPI_BUFFERS
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, AllReduce( sbuf, rbuf, count, op, comm, syncInfo ))
+    Synchronize( syncInfo );
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
+        NativeOp<Real>(op), comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op,
+  Comm const& comm, Request<Complex<Real>>& request,
+  SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, AllReduce( sbuf, rbuf, count, op, comm, syncInfo ))
+    Synchronize( syncInfo );
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        EL_CHECK_MPI_CALL
+        ( MPI_Iallreduce
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*count, TypeMap<Real>(),
+            NativeOp<Real>(op), comm.GetMPIComm(), &request.backend ) );
+        return;
+    }
+#endif
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, count,
+        TypeMap<Complex<Real>>(), NativeOp<Complex<Real>>(op),
+        comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename T, Device D,
+          typename/*=DisableIf<IsPacked<T>>*/,
+          typename/*=void*/>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    if( D != Device::CPU )
+        LogicError("IAllReduce: Bad device/type combination.");
+    Serialize( count, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( count, rbuf, request.buffer );
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( request.sendBuffer.data(), request.buffer.data(), count,
+        TypeMap<T>(), NativeOp<T>(op), comm.GetMPIComm(),
+        &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Real* buf, int count, Op op, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, AllReduce( buf, count, op, comm, syncInfo ))
+    Synchronize( syncInfo );
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), NativeOp<Real>(op),
+        comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm const& comm,
+  Request<Complex<Real>>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, AllReduce( buf, count, op, comm, syncInfo ))
+    Synchronize( syncInfo );
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        EL_CHECK_MPI_CALL
+        ( MPI_Iallreduce
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), NativeOp<Real>(op),
+            comm.GetMPIComm(), &request.backend ) );
+        return;
+    }
+#endif
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(),
+        NativeOp<Complex<Real>>(op), comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename T, Device D,
+          typename/*=DisableIf<IsPacked<T>>*/,
+          typename/*=void*/>
+void IAllReduce
+( T* buf, int count, Op op, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    if( D != Device::CPU )
+        LogicError("IAllReduce: Bad device/type combination.");
+    Serialize( count, buf, request.buffer );
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = buf;
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallreduce
+      ( MPI_IN_PLACE, request.buffer.data(), count, TypeMap<T>(),
+        NativeOp<T>(op), comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Real* sbuf, int sc, Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, AllGather( sbuf, sc, rbuf, rc, comm, syncInfo ))
+    Synchronize( syncInfo );
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(),
+        comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllGather
+( const Complex<Real>* sbuf, int sc, Complex<Real>* rbuf, int rc,
+  Comm const& comm, Request<Complex<Real>>& request,
+  SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, AllGather( sbuf, sc, rbuf, rc, comm, syncInfo ))
+    Synchronize( syncInfo );
+#ifdef EL_AVOID_COMPLEX_MPI
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.GetMPIComm(), &request.backend ) );
+#else
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.GetMPIComm(), &request.backend ) );
+#endif
+}
+
+template <typename T, Device D,
+          typename/*=DisableIf<IsPacked<T>>*/,
+          typename/*=void*/>
+void IAllGather
+( const T* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    if( D != Device::CPU )
+        LogicError("IAllGather: Bad device/type combination.");
+    const int commSize = mpi::Size( comm );
+    Serialize( sc, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = rc*commSize;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc*commSize, rbuf, request.buffer );
+    EL_CHECK_MPI_CALL
+    ( MPI_Iallgather
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(),
+        comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Real* sbuf, int sc, Real* rbuf, int rc, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, AllToAll( sbuf, sc, rbuf, rc, comm, syncInfo ))
+    Synchronize( syncInfo );
+    EL_CHECK_MPI_CALL
+    ( MPI_Ialltoall
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(),
+        comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc, Complex<Real>* rbuf, int rc,
+  Comm const& comm, Request<Complex<Real>>& request,
+  SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, AllToAll( sbuf, sc, rbuf, rc, comm, syncInfo ))
+    Synchronize( syncInfo );
+#ifdef EL_AVOID_COMPLEX_MPI
+    EL_CHECK_MPI_CALL
+    ( MPI_Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.GetMPIComm(), &request.backend ) );
+#else
+    EL_CHECK_MPI_CALL
+    ( MPI_Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.GetMPIComm(), &request.backend ) );
+#endif
+}
+
+template <typename T, Device D,
+          typename/*=DisableIf<IsPacked<T>>*/,
+          typename/*=void*/>
+void IAllToAll
+( const T* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    if( D != Device::CPU )
+        LogicError("IAllToAll: Bad device/type combination.");
+    const int commSize = mpi::Size( comm );
+    Serialize( sc*commSize, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = rc*commSize;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc*commSize, rbuf, request.buffer );
+    EL_CHECK_MPI_CALL
+    ( MPI_Ialltoall
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(),
+        comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm const& comm,
+  Request<Real>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, ReduceScatter( sbuf, rbuf, rc, op, comm, syncInfo ))
+    Synchronize( syncInfo );
+    EL_CHECK_MPI_CALL
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Real*>(sbuf), rbuf, rc, TypeMap<Real>(),
+        NativeOp<Real>(op), comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename Real, Device D,
+          typename/*=EnableIf<IsPacked<Real>>*/>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op,
+  Comm const& comm, Request<Complex<Real>>& request,
+  SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    COMPLETE_IF_STAGED(
+        request, ReduceScatter( sbuf, rbuf, rc, op, comm, syncInfo ))
+    Synchronize( syncInfo );
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        EL_CHECK_MPI_CALL
+        ( MPI_Ireduce_scatter_block
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*rc, TypeMap<Real>(),
+            NativeOp<Real>(op), comm.GetMPIComm(), &request.backend ) );
+        return;
+    }
+#endif
+    EL_CHECK_MPI_CALL
+    ( MPI_Ireduce_scatter_block
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, rc,
+        TypeMap<Complex<Real>>(), NativeOp<Complex<Real>>(op),
+        comm.GetMPIComm(), &request.backend ) );
+}
+
+template <typename T, Device D,
+          typename/*=DisableIf<IsPacked<T>>*/,
+          typename/*=void*/>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, Comm const& comm,
+  Request<T>& request, SyncInfo<D> const& syncInfo )
+{
+    EL_DEBUG_CSE;
+    if( D != Device::CPU )
+        LogicError("IReduceScatter: Bad device/type combination.");
+    const int commSize = mpi::Size( comm );
+    Serialize( rc*commSize, sbuf, request.sendBuffer );
+    request.receivingPacked = true;
+    request.recvCount = rc;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc, rbuf, request.buffer );
+    EL_CHECK_MPI_CALL
+    ( MPI_Ireduce_scatter_block
+      ( request.sendBuffer.data(), request.buffer.data(), rc, TypeMap<T>(),
+        NativeOp<T>(op), comm.GetMPIComm(), &request.backend ) );
+}
+
+#undef COMPLETE_IF_STAGED
+
 template <typename Real, Device D,
           typename/*=EnableIf<IsPacked<Real>>*/>
 void Gather(
@@ -1447,6 +2249,10 @@ void AllGather(
     EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::ALLGATHER, comm,
+        sizeof(Real)*sc,
+        sizeof(Real)*std::accumulate(rcs, rcs+Size(comm), size_t(0)));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1493,6 +2299,10 @@ void AllGather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::ALLGATHER, comm,
+        sizeof(Complex<Real>)*sc,
+        sizeof(Complex<Real>)*std::accumulate(rcs, rcs+Size(comm), size_t(0)));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1556,6 +2366,10 @@ void AllGather(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::ALLGATHER, comm,
+        sizeof(T)*sc,
+        sizeof(T)*std::accumulate(rcs, rcs+Size(comm), size_t(0)));
 
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1719,6 +2533,10 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::ALLTOALL, comm,
+        sizeof(Real)*std::accumulate(scs, scs+Size(comm), size_t(0)),
+        sizeof(Real)*std::accumulate(rcs, rcs+Size(comm), size_t(0)));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1748,6 +2566,10 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::ALLTOALL, comm,
+        sizeof(Complex<Real>)*std::accumulate(scs, scs+Size(comm), size_t(0)),
+        sizeof(Complex<Real>)*std::accumulate(rcs, rcs+Size(comm), size_t(0)));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commSize = Size(comm);
@@ -1797,6 +2619,10 @@ void AllToAll(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::ALLTOALL, comm,
+        sizeof(T)*std::accumulate(scs, scs+Size(comm), size_t(0)),
+        sizeof(T)*std::accumulate(rcs, rcs+Size(comm), size_t(0)));
 
     auto const commSize = Size(comm);
     auto const totalSend =
@@ -1857,6 +2683,10 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(Real)*std::accumulate(rcs, rcs+Size(comm), size_t(0)),
+        sizeof(Real)*rcs[Rank(comm)]);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = mpi::Rank(comm);
@@ -1883,6 +2713,10 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(Complex<Real>)*std::accumulate(rcs, rcs+Size(comm), size_t(0)),
+        sizeof(Complex<Real>)*rcs[Rank(comm)]);
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto const commRank = mpi::Rank(comm);
@@ -1933,6 +2767,10 @@ void ReduceScatter(
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE;
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(T)*std::accumulate(rcs, rcs+Size(comm), size_t(0)),
+        sizeof(T)*rcs[Rank(comm)]);
 
     Synchronize(syncInfo);
 
@@ -2252,10 +3090,36 @@ EL_NO_RELEASE_EXCEPT
     }
     WaitAll( numSends+numRecvs, requests.data(), statuses.data() );
 #else
-    AllToAll(
-        sendBuffer.data(), sendCounts.data(), sendDispls.data(),
-        recvBuffer.data(), recvCounts.data(), recvDispls.data(), comm,
-        SyncInfo<Device::CPU>{});
+    // Only exchange messages with the processes that we send to or receive
+    // from (which are typically few), and copy our own portion directly
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    std::vector<Request<T>> requests;
+    requests.reserve( 2*commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q != commRank && recvCounts[q] != 0 )
+        {
+            requests.emplace_back();
+            IRecv
+            ( &recvBuffer[recvDispls[q]], recvCounts[q], q, comm,
+              requests.back() );
+        }
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q != commRank && sendCounts[q] != 0 )
+        {
+            requests.emplace_back();
+            ISend
+            ( &sendBuffer[sendDispls[q]], sendCounts[q], q, comm,
+              requests.back() );
+        }
+    }
+    std::copy_n
+    ( sendBuffer.begin()+sendDispls[commRank], sendCounts[commRank],
+      recvBuffer.begin()+recvDispls[commRank] );
+    WaitAll( requests.size(), requests.data() );
 #endif
 }
 
@@ -2431,6 +3295,21 @@ EL_NO_RELEASE_EXCEPT
     template void Scan(                                                 \
         T* buf, int count, Op op, Comm const& comm, SyncInfo<D> const&)        \
         EL_NO_RELEASE_EXCEPT;                                           \
+    template void IAllReduce(                                           \
+        const T* sbuf, T* rbuf, int count, Op op, Comm const& comm,     \
+        Request<T>& request, SyncInfo<D> const&);                       \
+    template void IAllReduce(                                           \
+        T* buf, int count, Op op, Comm const& comm,                     \
+        Request<T>& request, SyncInfo<D> const&);                       \
+    template void IAllGather(                                           \
+        const T* sbuf, int sc, T* rbuf, int rc, Comm const& comm,       \
+        Request<T>& request, SyncInfo<D> const&);                       \
+    template void IAllToAll(                                            \
+        const T* sbuf, int sc, T* rbuf, int rc, Comm const& comm,       \
+        Request<T>& request, SyncInfo<D> const&);                       \
+    template void IReduceScatter(                                       \
+        const T* sbuf, T* rbuf, int rc, Op op, Comm const& comm,        \
+        Request<T>& request, SyncInfo<D> const&);                       \
     MPI_PROTO_COMMON_DEV(T,D)
 
 #define MPI_PROTO_COMPLEX_DEV(T,D)                                      \
@@ -2482,6 +3361,25 @@ EL_NO_RELEASE_EXCEPT
         Complex<T>* buf, int count, Op op, Comm const& comm,                   \
         SyncInfo<D> const&)                                             \
         EL_NO_RELEASE_EXCEPT;                                           \
+    template void IAllReduce<T>(                                        \
+        const Complex<T>* sbuf, Complex<T>* rbuf, int count, Op op,     \
+        Comm const& comm, Request<Complex<T>>& request,                 \
+        SyncInfo<D> const&);                                            \
+    template void IAllReduce<T>(                                        \
+        Complex<T>* buf, int count, Op op, Comm const& comm,            \
+        Request<Complex<T>>& request, SyncInfo<D> const&);              \
+    template void IAllGather<T>(                                        \
+        const Complex<T>* sbuf, int sc, Complex<T>* rbuf, int rc,       \
+        Comm const& comm, Request<Complex<T>>& request,                 \
+        SyncInfo<D> const&);                                            \
+    template void IAllToAll<T>(                                         \
+        const Complex<T>* sbuf, int sc, Complex<T>* rbuf, int rc,       \
+        Comm const& comm, Request<Complex<T>>& request,                 \
+        SyncInfo<D> const&);                                            \
+    template void IReduceScatter<T>(                                    \
+        const Complex<T>* sbuf, Complex<T>* rbuf, int rc, Op op,        \
+        Comm const& comm, Request<Complex<T>>& request,                 \
+        SyncInfo<D> const&);                                            \
     MPI_PROTO_COMMON_DEV(Complex<T>,D)
 
 #ifdef HYDROGEN_HAVE_CUDA
@@ -2579,6 +3477,10 @@ MPI_PROTO(Entry<Complex<BigFloat>>)
         Comm const& comm)                              \
         EL_NO_RELEASE_EXCEPT;
 
+#if defined(HYDROGEN_HAVE_CUDA) && defined(HYDROGEN_GPU_USE_FP16)
+PROTO(gpu_half_type)
+#endif
+
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
 #define EL_ENABLE_QUAD
@@ -13,6 +13,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLGATHER, comm,
+        sizeof(T)*sc, sizeof(T)*rc*Size(comm));
 
     using Backend = BestBackend<T,D,Collective::ALLGATHER>;
     Al::Allgather<Backend>(
@@ -26,6 +29,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLGATHER, comm,
+        sizeof(T)*sc, sizeof(T)*rc*Size(comm));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -61,6 +67,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLGATHER, comm,
+        sizeof(Complex<T>)*sc, sizeof(Complex<T>)*rc*Size(comm));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -101,6 +110,9 @@ void AllGather(
     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLGATHER, comm,
+        sizeof(T)*sc, sizeof(T)*rc*Size(comm));
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -13,6 +13,9 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLREDUCE, comm,
+        sizeof(T)*count, sizeof(T)*count);
     using Backend = BestBackend<T,D,Collective::ALLREDUCE>;
 
     if (count == 0)
@@ -29,6 +32,9 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLREDUCE, comm,
+        sizeof(T)*count, sizeof(T)*count);
     if (count == 0)
         return;
 
@@ -50,6 +56,9 @@ void AllReduce(Complex<T> const* sbuf, Complex<T>* rbuf, int count, Op op,
                Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLREDUCE, comm,
+        sizeof(Complex<T>)*count, sizeof(Complex<T>)*count);
 
     if (count == 0)
         return;
@@ -89,6 +98,9 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLREDUCE, comm,
+        sizeof(T)*count, sizeof(T)*count);
     if (count == 0)
         return;
 
@@ -100,6 +112,8 @@ void AllReduce(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
     ENSURE_HOST_RECV_BUFFER(rbuf, count, syncInfo);
 #endif
 
+    Synchronize(syncInfo);
+
     Serialize(count, sbuf, packedSend);
 
     ReserveSerialized(count, rbuf, packedRecv);
@@ -127,6 +141,9 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLREDUCE, comm,
+        sizeof(T)*count, sizeof(T)*count);
     using Backend = BestBackend<T,D,Collective::ALLREDUCE>;
 
     if (count == 0)
@@ -143,6 +160,9 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLREDUCE, comm,
+        sizeof(T)*count, sizeof(T)*count);
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -163,6 +183,9 @@ void AllReduce(Complex<T>* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLREDUCE, comm,
+        sizeof(Complex<T>)*count, sizeof(Complex<T>)*count);
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -201,6 +224,9 @@ void AllReduce(T* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLREDUCE, comm,
+        sizeof(T)*count, sizeof(T)*count);
     if (count == 0)
         return;
 
@@ -12,6 +12,9 @@ void AllToAll(T const* sbuf, int /*sc*/, T* rbuf, int rc, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLTOALL, comm,
+        sizeof(T)*rc*Size(comm), sizeof(T)*rc*Size(comm));
     if (rc == 0)
         return;
 
@@ -26,6 +29,9 @@ void AllToAll(T const* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLTOALL, comm,
+        sizeof(T)*sc*Size(comm), sizeof(T)*rc*Size(comm));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -47,6 +53,9 @@ void AllToAll(Complex<T> const* sbuf,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLTOALL, comm,
+        sizeof(Complex<T>)*sc*Size(comm), sizeof(Complex<T>)*rc*Size(comm));
 
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
     auto size_c = Size(comm);
@@ -79,6 +88,9 @@ void AllToAll(T const* sbuf, int sc, T* rbuf, int rc, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::ALLTOALL, comm,
+        sizeof(T)*sc*Size(comm), sizeof(T)*rc*Size(comm));
 
     const int commSize = mpi::Size(comm);
     const int totalSend = sc*commSize;
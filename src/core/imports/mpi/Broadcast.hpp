@@ -14,6 +14,10 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::BROADCAST, comm,
+        Rank(comm) == root ? sizeof(T)*count : 0,
+        Rank(comm) == root ? 0 : sizeof(T)*count);
 
     using Backend = BestBackend<T,D,Collective::BROADCAST>;
     Al::Bcast<Backend>(
@@ -26,6 +30,10 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::BROADCAST, comm,
+        Rank(comm) == root ? sizeof(T)*count : 0,
+        Rank(comm) == root ? 0 : sizeof(T)*count);
     if (Size(comm) == 1 || count == 0)
         return;
 
@@ -49,6 +57,10 @@ void Broadcast(Complex<T>* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::BROADCAST, comm,
+        Rank(comm) == root ? sizeof(Complex<T>)*count : 0,
+        Rank(comm) == root ? 0 : sizeof(Complex<T>)*count);
     if (Size(comm) == 1 || count == 0)
         return;
 
@@ -76,6 +88,10 @@ void Broadcast(T* buffer, int count, int root, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::BROADCAST, comm,
+        Rank(comm) == root ? sizeof(T)*count : 0,
+        Rank(comm) == root ? 0 : sizeof(T)*count);
     if (Size(comm) == 1 || count == 0)
         return;
 
@@ -16,6 +16,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(T)*count*Size(comm), sizeof(T)*count);
     if (count == 0)
         return;
 
@@ -31,6 +34,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                     SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(T)*count*Size(comm), sizeof(T)*count);
     if (count == 0)
         return;
 
@@ -53,6 +59,9 @@ void ReduceScatter(Complex<T> const* sbuf, Complex<T>* rbuf,
                    int count, Op op, Comm const& comm, SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(Complex<T>)*count*Size(comm), sizeof(Complex<T>)*count);
     if (count == 0)
         return;
 
@@ -83,6 +92,9 @@ void ReduceScatter(T const* sbuf, T* rbuf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(T)*count*Size(comm), sizeof(T)*count);
     if (count == 0)
         return;
 
@@ -127,6 +139,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(T)*count*Size(comm), sizeof(T)*count);
     if (count == 0)
         return;
 
@@ -142,6 +157,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
                SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(T)*count*Size(comm), sizeof(T)*count);
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -164,6 +182,9 @@ void ReduceScatter(Complex<T>* buf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(Complex<T>)*count*Size(comm), sizeof(Complex<T>)*count);
     if (count == 0 || Size(comm) == 1)
         return;
 
@@ -194,6 +215,9 @@ void ReduceScatter(T* buf, int count, Op op, Comm const& comm,
                    SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::REDUCESCATTER, comm,
+        sizeof(T)*count*Size(comm), sizeof(T)*count);
     if (count == 0)
         return;
     const int commSize = mpi::Size(comm);
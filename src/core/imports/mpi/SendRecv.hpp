@@ -13,6 +13,9 @@ void SendRecv(const T* sbuf, int sc, int to,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::SENDRECV, comm,
+        sizeof(T)*sc, sizeof(T)*rc);
 
     using Backend = BestBackend<T,D,Collective::SENDRECV>;
     Al::SendRecv<Backend>(
@@ -26,6 +29,9 @@ void SendRecv(T* buf, int count, int to, int from, Comm const& comm,
               SyncInfo<D> const& syncInfo)
 {
     EL_DEBUG_CSE
+    EL_RECORD_COMM(
+        Collective::SENDRECV, comm,
+        sizeof(T)*count, sizeof(T)*count);
 
     using Backend = BestBackend<T,D,Collective::SENDRECV>;
     // Not sure if Al is ok with this bit
@@ -56,6 +56,50 @@ MPI_Op AlNativeOp( const El::mpi::Op& op )
 
 }// namespace <anon>
 
+namespace El
+{
+namespace mpi
+{
+namespace internal
+{
+
+// Whether the calls to the collectives are being recorded, either for the
+// communication statistics or for the native profiler
+bool RecordingComm() EL_NO_EXCEPT;
+
+// Records a call for the communication statistics from its construction to
+// its destruction, and profiles it as a region of the native profiler. The
+// recorded time is that of the host thread, so it does not cover any work
+// left enqueued on a device stream.
+class CommRecorder
+{
+public:
+    CommRecorder() = default;
+    CommRecorder(
+        Collective op, Comm const& comm, size_t bytesSent, size_t bytesRecv);
+    CommRecorder(CommRecorder&& other) noexcept;
+    ~CommRecorder();
+
+private:
+    bool active_ = false, profiling_ = false;
+    Collective op_;
+    MPI_Comm comm_;
+    size_t bytesSent_, bytesRecv_;
+    Clock::time_point start_;
+};// class CommRecorder
+
+}// namespace internal
+}// namespace mpi
+}// namespace El
+
+// Record the enclosing call to 'op' over 'comm'; the byte counts are only
+// evaluated while recording
+#define EL_RECORD_COMM(op, comm, bytesSent, bytesRecv)                  \
+    ::El::mpi::internal::CommRecorder commRecorder_ =                   \
+        ( ::El::mpi::internal::RecordingComm() ?                        \
+          ::El::mpi::internal::CommRecorder(op, comm, bytesSent, bytesRecv) \
+          : ::El::mpi::internal::CommRecorder() )
+
 // This is for handling the host-blocking host-transfer stuff
 #ifdef HYDROGEN_ENSURE_HOST_MPI_BUFFERS
 namespace El
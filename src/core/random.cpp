@@ -13,6 +13,30 @@ namespace {
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+// The (rank-independent) seed of the counter-based generator, the next
+// unused stream of sequential matrices, and the next unused block of
+// streams of distributed matrices. The epoch counts the reseedings.
+std::uint64_t counterSeed = 0;
+std::uint64_t nextStream = 0;
+std::uint64_t nextStreamBlock = 0;
+std::uint64_t seedEpoch = 0;
+
+// The streams of the distributed matrices of a communicator are numbered
+// within a block which its members agree upon once. The block is cached as
+// an attribute of the communicator, so it is freed along with it.
+struct StreamBlock
+{
+    std::uint64_t epoch;
+    std::uint64_t block;
+    std::uint64_t nextStream;
+};
+
+int FreeStreamBlock( MPI_Comm, int, void* attribute, void* )
+{
+    delete static_cast<StreamBlock*>(attribute);
+    return MPI_SUCCESS;
+}
+
 #ifdef HYDROGEN_HAVE_MPC
 gmp_randstate_t gmpRandState;
 #endif
@@ -29,6 +53,14 @@ void InitializeRandom( bool deterministic )
 
     ::generator.seed( seed );
 
+    long sharedSecs = secs;
+    mpi::Broadcast
+    ( sharedSecs, 0, mpi::COMM_WORLD, SyncInfo<Device::CPU>{} );
+    ::counterSeed = std::uint64_t(sharedSecs);
+    ::nextStream = 0;
+    ::nextStreamBlock = 0;
+    ++::seedEpoch;
+
     srand( seed );
 
 #ifdef HYDROGEN_HAVE_MPC
@@ -49,6 +81,56 @@ void FinalizeRandom()
 std::mt19937& Generator()
 { return ::generator; }
 
+std::uint64_t RandomSeed()
+{ return ::counterSeed; }
+
+void SetRandomSeed( std::uint64_t seed )
+{
+    const unsigned rank = mpi::Rank( mpi::COMM_WORLD );
+    ::generator.seed( (seed<<16) | (rank & 0xFFFF) );
+    ::counterSeed = seed;
+    ::nextStream = 0;
+    ::nextStreamBlock = 0;
+    ++::seedEpoch;
+}
+
+std::uint64_t NextRandomStream()
+{ return ::nextStream++; }
+
+std::uint64_t NextRandomStream( mpi::Comm const& comm )
+{
+    EL_DEBUG_CSE
+    static int keyval = MPI_KEYVAL_INVALID;
+    if( keyval == MPI_KEYVAL_INVALID )
+        EL_CHECK_MPI_CALL(
+          MPI_Comm_create_keyval
+          ( MPI_COMM_NULL_COPY_FN, FreeStreamBlock, &keyval, nullptr ) );
+
+    void* attribute;
+    int found;
+    EL_CHECK_MPI_CALL(
+      MPI_Comm_get_attr( comm.GetMPIComm(), keyval, &attribute, &found ) );
+    StreamBlock* block = static_cast<StreamBlock*>(attribute);
+    if( !found )
+    {
+        block = new StreamBlock;
+        block->epoch = ::seedEpoch - 1;
+        EL_CHECK_MPI_CALL(
+          MPI_Comm_set_attr( comm.GetMPIComm(), keyval, block ) );
+    }
+    if( block->epoch != ::seedEpoch )
+    {
+        // Every member has reserved fewer blocks than the maximum
+        block->epoch = ::seedEpoch;
+        block->block =
+          mpi::AllReduce
+          ( ::nextStreamBlock, mpi::MAX, comm, SyncInfo<Device::CPU>{} );
+        block->nextStream = 0;
+        ::nextStreamBlock = block->block + 1;
+    }
+    return (block->block<<32) | block->nextStream++;
+}
+
 #ifdef HYDROGEN_HAVE_MPC
 namespace mpfr {
 
@@ -0,0 +1,114 @@
+#include <hydrogen/blas/gpu/Random.hpp>
+
+#include <El/hydrogen_config.h>
+#include <El/core/random/Philox.hpp>
+#include <hydrogen/device/gpu/CUDA.hpp>
+#include <cuda_runtime.h>
+
+namespace hydrogen
+{
+namespace
+{
+
+// These match El::counter_fill::UniformSampler and NormalSampler for real
+// types
+template <typename T>
+struct UniformSampler
+{
+    T center, radius;
+
+    __device__ T operator()(El::philox::Bits const& b) const
+    {
+        const double u = El::philox::UnitInterval(b.x0, b.x1);
+        return center + radius*T(2*u-1);
+    }
+};
+
+template <typename T>
+struct NormalSampler
+{
+    T mean, stddev;
+
+    __device__ T operator()(El::philox::Bits const& b) const
+    {
+        const double r =
+            sqrt(-2*log(El::philox::PositiveUnitInterval(b.x0, b.x1)));
+        const double angle =
+            2*3.14159265358979323846*El::philox::UnitInterval(b.x2, b.x3);
+        return mean + stddev*T(r*cos(angle));
+    }
+};
+
+template <typename T, typename Sampler>
+__global__ void RandomFill_kernel(size_t height, size_t width,
+                                  Sampler sample, RandomIndexing indexing,
+                                  T* buffer, size_t ldim)
+{
+    const size_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    const size_t numThreads = blockDim.x * gridDim.x;
+    const El::philox::Key key{indexing.key0, indexing.key1};
+    for (size_t pos = tid; pos < height * width; pos += numThreads)
+    {
+        const size_t i = pos % height;
+        const size_t j = pos / height;
+        buffer[i+j*ldim] = sample(
+            El::philox::Entry(
+                key,
+                indexing.col_shift + i*indexing.col_stride,
+                indexing.row_shift + j*indexing.row_stride,
+                indexing.tag));
+    }
+}
+
+template <typename T, typename Sampler>
+void LaunchRandomFill(
+    size_t height, size_t width, Sampler sample,
+    RandomIndexing indexing, T* buffer, size_t ldim, cudaStream_t stream)
+{
+    if (height <= 0 || width <= 0)
+        return;
+
+    const size_t size = height * width;
+    constexpr size_t blockDim = 256;
+    const size_t gridDim = (size + blockDim - 1) / blockDim;
+    void* args[] = {&height, &width, &sample, &indexing, &buffer, &ldim};
+    H_CHECK_CUDA(
+        cudaLaunchKernel(
+            (void const*)&RandomFill_kernel<T,Sampler>,
+            gridDim, blockDim, args, 0, stream));
+}
+
+}// namespace <anon>
+
+template <typename T, typename>
+void UniformFill_GPU_impl(
+    size_t height, size_t width, T center, T radius,
+    RandomIndexing const& indexing,
+    T* buffer, size_t ldim, cudaStream_t stream)
+{
+    LaunchRandomFill(height, width, UniformSampler<T>{center, radius},
+                     indexing, buffer, ldim, stream);
+}
+
+template <typename T, typename>
+void NormalFill_GPU_impl(
+    size_t height, size_t width, T mean, T stddev,
+    RandomIndexing const& indexing,
+    T* buffer, size_t ldim, cudaStream_t stream)
+{
+    LaunchRandomFill(height, width, NormalSampler<T>{mean, stddev},
+                     indexing, buffer, ldim, stream);
+}
+
+#define ETI(T)                                                          \
+    template void UniformFill_GPU_impl(                                 \
+        size_t, size_t, T, T, RandomIndexing const&,                    \
+        T*, size_t, cudaStream_t);                                      \
+    template void NormalFill_GPU_impl(                                  \
+        size_t, size_t, T, T, RandomIndexing const&,                    \
+        T*, size_t, cudaStream_t)
+
+ETI(float);
+ETI(double);
+
+}// namespace hydrogen
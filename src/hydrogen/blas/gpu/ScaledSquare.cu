@@ -0,0 +1,102 @@
+#include <hydrogen/blas/gpu/ScaledSquare.hpp>
+
+#include <El/hydrogen_config.h>
+#include <hydrogen/device/gpu/CUDA.hpp>
+#include <cuda_runtime.h>
+
+namespace
+{
+
+constexpr size_t ScaledSquareBlockDim = 256;
+
+// Fold the pair (betaScale, betaSquare) into (scale, scaledSquare)
+template <typename T>
+__device__ void CombineScaledSquares(T& scale, T& scaledSquare,
+                                     T betaScale, T betaSquare)
+{
+    if (betaScale == T(0))
+        return;
+    if (scale < betaScale)
+    {
+        const T relScale = scale/betaScale;
+        scaledSquare = scaledSquare*relScale*relScale + betaSquare;
+        scale = betaScale;
+    }
+    else
+    {
+        const T relScale = betaScale/scale;
+        scaledSquare += betaSquare*relScale*relScale;
+    }
+}
+
+template <typename T>
+__global__ void ScaledSquare_kernel(size_t height, size_t width,
+                                    T const* __restrict__ A, size_t lda,
+                                    T* __restrict__ partials)
+{
+    __shared__ T scales[ScaledSquareBlockDim];
+    __shared__ T scaledSquares[ScaledSquareBlockDim];
+
+    const size_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    const size_t numThreads = blockDim.x * gridDim.x;
+    T scale = T(0), scaledSquare = T(1);
+    for (size_t pos = tid; pos < height * width; pos += numThreads)
+    {
+        const size_t i = pos % height;
+        const size_t j = pos / height;
+        const T alpha = fabs(A[i+j*lda]);
+        CombineScaledSquares(scale, scaledSquare, alpha, T(1));
+    }
+    scales[threadIdx.x] = scale;
+    scaledSquares[threadIdx.x] = scaledSquare;
+    __syncthreads();
+
+    for (unsigned int stride = blockDim.x/2; stride > 0; stride /= 2)
+    {
+        if (threadIdx.x < stride)
+            CombineScaledSquares(
+                scales[threadIdx.x], scaledSquares[threadIdx.x],
+                scales[threadIdx.x+stride],
+                scaledSquares[threadIdx.x+stride]);
+        __syncthreads();
+    }
+
+    if (threadIdx.x == 0)
+    {
+        partials[2*blockIdx.x] = scales[0];
+        partials[2*blockIdx.x+1] = scaledSquares[0];
+    }
+}
+
+}// namespace <anon>
+
+namespace hydrogen
+{
+
+template <typename T, typename>
+size_t ScaledSquare_GPU_impl(
+    size_t height, size_t width, T const* A, size_t lda,
+    T* partials, cudaStream_t stream)
+{
+    if (height <= 0 || width <= 0)
+        return 0;
+
+    const size_t size = height * width;
+    constexpr size_t blockDim = ScaledSquareBlockDim;
+    size_t gridDim = (size + blockDim - 1) / blockDim;
+    if (gridDim > ScaledSquare_GPU_max_partials)
+        gridDim = ScaledSquare_GPU_max_partials;
+    void* args[] = {&height, &width, &A, &lda, &partials};
+    H_CHECK_CUDA(
+        cudaLaunchKernel(
+            (void const*)&ScaledSquare_kernel<T>,
+            gridDim, blockDim, args, 0, stream));
+    return gridDim;
+}
+
+template size_t ScaledSquare_GPU_impl(
+    size_t, size_t, float const*, size_t, float*, cudaStream_t);
+template size_t ScaledSquare_GPU_impl(
+    size_t, size_t, double const*, size_t, double*, cudaStream_t);
+
+}// namespace hydrogen
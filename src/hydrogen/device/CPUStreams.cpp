@@ -0,0 +1,345 @@
+#include <hydrogen/device/CPUStreams.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace hydrogen
+{
+namespace
+{
+
+// A fixed set of worker threads running jobs in submission order. The
+// OpenMP threads available to the caller are split among the workers, so
+// that kernels with parallel regions do not oversubscribe the cores.
+class WorkerPool
+{
+public:
+    explicit WorkerPool(unsigned numThreads)
+    {
+#ifdef _OPENMP
+        const int ompThreads =
+            std::max(omp_get_max_threads() / int(numThreads), 1);
+#endif
+        for (unsigned t = 0; t < numThreads; ++t)
+            workers_.emplace_back(
+                [=]
+                {
+#ifdef _OPENMP
+                    omp_set_num_threads(ompThreads);
+#endif
+                    Work_();
+                });
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        ready_.notify_all();
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+    void Submit(std::function<void()> job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(std::move(job));
+        }
+        ready_.notify_one();
+    }
+
+private:
+    void Work_()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true)
+        {
+            ready_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (jobs_.empty())
+                return;
+            auto job = std::move(jobs_.front());
+            jobs_.pop_front();
+            lock.unlock();
+            job();
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> jobs_;
+    std::vector<std::thread> workers_;
+    bool stop_ = false;
+};
+
+std::mutex poolMutex;
+std::unique_ptr<WorkerPool> pool;
+
+WorkerPool& Pool()
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    if (!pool)
+    {
+        unsigned numThreads = std::thread::hardware_concurrency();
+        if (char const* env = std::getenv("HYDROGEN_CPU_STREAM_THREADS"))
+            numThreads = std::atoi(env);
+        pool.reset(new WorkerPool(std::max(numThreads, 1u)));
+    }
+    return *pool;
+}
+
+// A single recording of an event, which is reached once the tasks enqueued
+// before it have finished
+class Occurrence
+{
+public:
+    // Returns false, without registering the callback, if the occurrence
+    // has already been reached
+    bool OnReached(std::function<void()> callback)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (reached_)
+            return false;
+        callbacks_.push_back(std::move(callback));
+        return true;
+    }
+
+    void Reach()
+    {
+        std::vector<std::function<void()>> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            reached_ = true;
+            callbacks.swap(callbacks_);
+        }
+        reachedCV_.notify_all();
+        for (auto& callback : callbacks)
+            callback();
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        reachedCV_.wait(lock, [this] { return reached_; });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable reachedCV_;
+    std::vector<std::function<void()>> callbacks_;
+    bool reached_ = false;
+};
+
+}// namespace <anon>
+
+struct CPUEvent_
+{
+    std::mutex mutex;
+    std::shared_ptr<Occurrence> latest;
+};
+
+// A stream is drained by at most one worker at a time, which preserves the
+// order of its tasks. 'active' is set from the submission of a drain until
+// the queue is found empty, including while the stream waits on an event.
+struct CPUStream_
+{
+    struct Task
+    {
+        std::function<void()> run;
+        std::shared_ptr<Occurrence> waitFor;
+    };
+
+    std::mutex mutex;
+    std::condition_variable idle;
+    std::deque<Task> tasks;
+    bool active = false;
+    std::exception_ptr error;
+};
+
+namespace
+{
+
+// Jobs resubmit themselves to the pool running them rather than through
+// Pool(), which FinalizeCPUStreams may have already emptied
+void Drain(cpuStream_t stream, WorkerPool& pool)
+{
+    std::unique_lock<std::mutex> lock(stream->mutex);
+    while (!stream->tasks.empty())
+    {
+        auto task = std::move(stream->tasks.front());
+        stream->tasks.pop_front();
+        lock.unlock();
+        if (task.waitFor)
+        {
+            // Resume once the event is reached rather than block a worker
+            if (task.waitFor->OnReached(
+                    [stream, &pool]
+                    {
+                        pool.Submit([stream, &pool] { Drain(stream, pool); });
+                    }))
+                return;
+        }
+        else
+        {
+            try
+            {
+                task.run();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> errorLock(stream->mutex);
+                if (!stream->error)
+                    stream->error = std::current_exception();
+            }
+        }
+        lock.lock();
+    }
+    stream->active = false;
+    stream->idle.notify_all();
+}
+
+void Enqueue(cpuStream_t stream, CPUStream_::Task task)
+{
+    bool submit;
+    {
+        std::lock_guard<std::mutex> lock(stream->mutex);
+        stream->tasks.push_back(std::move(task));
+        submit = !stream->active;
+        stream->active = true;
+    }
+    if (submit)
+    {
+        auto& pool = Pool();
+        pool.Submit([stream, &pool] { Drain(stream, pool); });
+    }
+}
+
+}// namespace <anon>
+
+cpuStream_t CreateCPUStream()
+{
+    Pool();
+    return new CPUStream_;
+}
+
+void DestroyCPUStream(cpuStream_t stream)
+{
+    if (stream == nullptr)
+        return;
+    CPUStreamWait(stream);
+    if (stream->error)
+    {
+        try
+        {
+            std::rethrow_exception(stream->error);
+        }
+        catch (std::exception const& e)
+        {
+            std::cerr << "Destroyed a CPU stream with an unreported task "
+                      << "exception: " << e.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cerr << "Destroyed a CPU stream with an unreported task "
+                      << "exception" << std::endl;
+        }
+    }
+    delete stream;
+}
+
+cpuEvent_t CreateCPUEvent()
+{
+    return new CPUEvent_;
+}
+
+void DestroyCPUEvent(cpuEvent_t event)
+{
+    delete event;
+}
+
+void CPUStreamEnqueue(cpuStream_t stream, std::function<void()> task)
+{
+    Enqueue(stream, CPUStream_::Task{std::move(task), nullptr});
+}
+
+void CPUStreamWait(cpuStream_t stream) noexcept
+{
+    std::unique_lock<std::mutex> lock(stream->mutex);
+    stream->idle.wait(lock, [stream] { return !stream->active; });
+}
+
+void CPUStreamSynchronize(cpuStream_t stream)
+{
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(stream->mutex);
+        stream->idle.wait(lock, [stream] { return !stream->active; });
+        std::swap(error, stream->error);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void CPUEventRecord(cpuEvent_t event, cpuStream_t stream)
+{
+    auto occurrence = std::make_shared<Occurrence>();
+    {
+        std::lock_guard<std::mutex> lock(event->mutex);
+        event->latest = occurrence;
+    }
+    if (stream == nullptr)
+        occurrence->Reach();
+    else
+        CPUStreamEnqueue(stream, [occurrence] { occurrence->Reach(); });
+}
+
+void CPUStreamWaitEvent(cpuStream_t stream, cpuEvent_t event)
+{
+    std::shared_ptr<Occurrence> occurrence;
+    {
+        std::lock_guard<std::mutex> lock(event->mutex);
+        occurrence = event->latest;
+    }
+    if (occurrence)
+        Enqueue(stream, CPUStream_::Task{nullptr, std::move(occurrence)});
+}
+
+void CPUEventSynchronize(cpuEvent_t event)
+{
+    std::shared_ptr<Occurrence> occurrence;
+    {
+        std::lock_guard<std::mutex> lock(event->mutex);
+        occurrence = event->latest;
+    }
+    if (occurrence)
+        occurrence->Wait();
+}
+
+void FinalizeCPUStreams()
+{
+    // Join the workers without holding poolMutex, since their last jobs
+    // may still enqueue work
+    std::unique_ptr<WorkerPool> finished;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        finished = std::move(pool);
+    }
+    finished.reset();
+}
+
+}// namespace hydrogen
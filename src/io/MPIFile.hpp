@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_MPIFILE_HPP
+#define EL_IO_MPIFILE_HPP
+
+// Collective MPI-IO access to column-major matrices on disk (i.e., the
+// BINARY and BINARY_FLAT formats). Each process describes the entries it
+// owns with a strided file view, so that every process reads (or writes)
+// its entire local matrix with a single collective call rather than the
+// root process seeking to each entry in turn.
+
+namespace El {
+namespace mpi_io {
+
+// Element-wise distributions of trivially-copyable types in host memory can
+// be described by a single strided file view, as long as the local
+// dimensions fit in the int counts of the MPI datatype constructors. Since
+// the decision must be the same on every process, it only depends upon the
+// global dimensions, which bound the local ones.
+template<typename T>
+bool Supported( const AbstractDistMatrix<T>& A )
+{
+    const Int maxCount = std::numeric_limits<int>::max();
+    return std::is_trivially_copyable<T>::value && A.Wrap() == ELEMENT &&
+      A.GetLocalDevice() == Device::CPU &&
+      A.Height() <= maxCount && A.Width() <= maxCount;
+}
+
+class File
+{
+public:
+    File( const mpi::Comm& comm, const string& filename, int amode )
+    {
+        EL_DEBUG_CSE
+        const int error =
+          MPI_File_open
+          ( comm.GetMPIComm(), const_cast<char*>(filename.c_str()), amode,
+            MPI_INFO_NULL, &file_ );
+        if( error != MPI_SUCCESS )
+            RuntimeError("Could not open ",filename);
+    }
+
+    ~File() { MPI_File_close( &file_ ); }
+
+    File( const File& ) = delete;
+    File& operator=( const File& ) = delete;
+
+    Int Size() const
+    {
+        MPI_Offset size;
+        EL_CHECK_MPI_CALL( MPI_File_get_size( file_, &size ) );
+        return Int(size);
+    }
+
+    // Collective; truncates or extends the file
+    void SetSize( Int size )
+    { EL_CHECK_MPI_CALL( MPI_File_set_size( file_, MPI_Offset(size) ) ); }
+
+    // Collective; every process reads the same bytes (e.g., a header)
+    void ReadAtAll( Int offset, void* buffer, int numBytes )
+    {
+        EL_CHECK_MPI_CALL(
+          MPI_File_read_at_all
+          ( file_, MPI_Offset(offset), buffer, numBytes, MPI_BYTE,
+            MPI_STATUS_IGNORE ) );
+    }
+
+    void WriteAt( Int offset, const void* buffer, int numBytes )
+    {
+        EL_CHECK_MPI_CALL(
+          MPI_File_write_at
+          ( file_, MPI_Offset(offset), const_cast<void*>(buffer), numBytes,
+            MPI_BYTE, MPI_STATUS_IGNORE ) );
+    }
+
+    // Collective; reads the local entries of A from a column-major matrix
+    // of A's dimensions which begins 'offset' bytes into the file
+    template<typename T>
+    void ReadAll( AbstractDistMatrix<T>& A, Int offset )
+    {
+        EL_DEBUG_CSE
+        LocalTypes<T> types( A, offset );
+        SetView( types );
+        EL_CHECK_MPI_CALL(
+          MPI_File_read_all
+          ( file_, A.Buffer(), 1, types.memType, MPI_STATUS_IGNORE ) );
+    }
+
+    // Collective; writes the local entries of A into a column-major matrix
+    // of A's dimensions which begins 'offset' bytes into the file. Only the
+    // first member of each team of redundant processes contributes.
+    template<typename T>
+    void WriteAll( const AbstractDistMatrix<T>& A, Int offset )
+    {
+        EL_DEBUG_CSE
+        LocalTypes<T> types( A, offset, A.RedundantRank() == 0 );
+        SetView( types );
+        EL_CHECK_MPI_CALL(
+          MPI_File_write_all
+          ( file_, const_cast<T*>(A.LockedBuffer()), 1, types.memType,
+            MPI_STATUS_IGNORE ) );
+    }
+
+private:
+    // The file view and memory layout of the local entries of A. Local
+    // entry (iLoc,jLoc) is global entry
+    //
+    //   (colShift + iLoc colStride, rowShift + jLoc rowStride),
+    //
+    // so each local column is a vector with stride colStride, and the local
+    // columns are rowStride global columns apart. The strides between
+    // columns are given in bytes, since they need not fit in an int.
+    template<typename T>
+    struct LocalTypes
+    {
+        MPI_Datatype entryType, colType, fileType, localColType, memType;
+        MPI_Offset disp;
+
+        LocalTypes
+        ( const AbstractDistMatrix<T>& A, Int offset, bool participate=true )
+        {
+            EL_DEBUG_ONLY(
+              if( !Supported(A) )
+                  LogicError("The matrix cannot be described by MPI-IO views");
+            )
+            const int localHeight = ( participate ? int(A.LocalHeight()) : 0 );
+            const int localWidth = ( participate ? int(A.LocalWidth()) : 0 );
+            const MPI_Aint colBytes = MPI_Aint(A.Height())*sizeof(T);
+
+            EL_CHECK_MPI_CALL(
+              MPI_Type_contiguous( sizeof(T), MPI_BYTE, &entryType ) );
+            EL_CHECK_MPI_CALL(
+              MPI_Type_vector
+              ( localHeight, 1, A.ColStride(), entryType, &colType ) );
+            EL_CHECK_MPI_CALL(
+              MPI_Type_create_hvector
+              ( localWidth, 1, A.RowStride()*colBytes, colType, &fileType ) );
+            EL_CHECK_MPI_CALL(
+              MPI_Type_contiguous( localHeight, entryType, &localColType ) );
+            EL_CHECK_MPI_CALL(
+              MPI_Type_create_hvector
+              ( localWidth, 1, MPI_Aint(A.LDim())*sizeof(T), localColType,
+                &memType ) );
+            EL_CHECK_MPI_CALL( MPI_Type_commit( &entryType ) );
+            EL_CHECK_MPI_CALL( MPI_Type_commit( &fileType ) );
+            EL_CHECK_MPI_CALL( MPI_Type_commit( &memType ) );
+
+            disp = MPI_Offset(offset) +
+              MPI_Offset(A.ColShift())*sizeof(T) + A.RowShift()*colBytes;
+        }
+
+        ~LocalTypes()
+        {
+            MPI_Type_free( &memType );
+            MPI_Type_free( &localColType );
+            MPI_Type_free( &fileType );
+            MPI_Type_free( &colType );
+            MPI_Type_free( &entryType );
+        }
+    };
+
+    template<typename T>
+    void SetView( const LocalTypes<T>& types )
+    {
+        EL_CHECK_MPI_CALL(
+          MPI_File_set_view
+          ( file_, types.disp, types.entryType, types.fileType,
+            const_cast<char*>("native"), MPI_INFO_NULL ) );
+    }
+
+    MPI_File file_;
+};
+
+} // namespace mpi_io
+} // namespace El
+
+#endif // ifndef EL_IO_MPIFILE_HPP
@@ -0,0 +1,206 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#ifdef HYDROGEN_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // HYDROGEN_HAVE_MMAP
+
+namespace El {
+
+#ifdef HYDROGEN_HAVE_MMAP
+namespace {
+
+int AdviceFlag( MapAdvice advice )
+{
+    switch( advice )
+    {
+    case MAP_ADVICE_SEQUENTIAL: return MADV_SEQUENTIAL;
+    case MAP_ADVICE_RANDOM:     return MADV_RANDOM;
+    case MAP_ADVICE_WILLNEED:   return MADV_WILLNEED;
+    default:                    return MADV_NORMAL;
+    }
+}
+
+} // namespace <anon>
+#endif // HYDROGEN_HAVE_MMAP
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix
+( const string filename, FileFormat format,
+  Int height, Int width, bool writable, MapAdvice advice )
+: writable_(writable)
+{
+    EL_DEBUG_CSE
+    if( !std::is_trivially_copyable<T>::value )
+        LogicError("Only trivially-copyable types can be mapped");
+    if( format != BINARY && format != BINARY_FLAT )
+        LogicError("Only BINARY and BINARY_FLAT files can be mapped");
+#ifdef HYDROGEN_HAVE_MMAP
+    const int fd = open( filename.c_str(), writable ? O_RDWR : O_RDONLY );
+    if( fd < 0 )
+        RuntimeError("Could not open ",filename);
+    struct stat info;
+    if( fstat( fd, &info ) != 0 )
+    {
+        close( fd );
+        RuntimeError("Could not stat ",filename);
+    }
+    numBytes_ = info.st_size;
+    if( numBytes_ > 0 )
+    {
+        const int protection = PROT_READ | ( writable ? PROT_WRITE : 0 );
+        data_ = mmap( nullptr, numBytes_, protection, MAP_SHARED, fd, 0 );
+    }
+    // The mapping holds its own reference to the file
+    close( fd );
+    if( data_ == MAP_FAILED )
+    {
+        data_ = nullptr;
+        RuntimeError("Could not map ",filename);
+    }
+    if( data_ != nullptr && advice != MAP_ADVICE_NORMAL )
+        madvise( data_, numBytes_, AdviceFlag(advice) );
+
+    const char* bytes = static_cast<const char*>(data_);
+    Int metaBytes = 0;
+    if( format == BINARY )
+    {
+        metaBytes = 2*sizeof(Int);
+        if( numBytes_ < size_t(metaBytes) )
+        {
+            Unmap();
+            RuntimeError(filename," is too small to hold a BINARY header");
+        }
+        std::memcpy( &height, bytes, sizeof(Int) );
+        std::memcpy( &width, bytes+sizeof(Int), sizeof(Int) );
+    }
+    const size_t numBytesExp = metaBytes + height*width*sizeof(T);
+    if( numBytes_ != numBytesExp )
+    {
+        Unmap();
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes_);
+    }
+
+    // Mappings are page-aligned, so only the header could misalign the data
+    if( metaBytes % alignof(T) != 0 )
+    {
+        Unmap();
+        LogicError("The entries of ",filename," are misaligned for mapping");
+    }
+    T* buffer = reinterpret_cast<T*>(static_cast<char*>(data_)+metaBytes);
+    if( writable )
+        A_.Attach( height, width, buffer, Max(height,1) );
+    else
+        A_.LockedAttach( height, width, buffer, Max(height,1) );
+#else
+    RuntimeError("Memory-mapped files are not supported on this platform");
+#endif // HYDROGEN_HAVE_MMAP
+}
+
+template<typename T>
+MappedMatrix<T>::~MappedMatrix()
+{ Unmap(); }
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix( MappedMatrix<T>&& A ) EL_NO_EXCEPT
+: data_(A.data_), numBytes_(A.numBytes_), writable_(A.writable_),
+  A_(std::move(A.A_))
+{
+    A.data_ = nullptr;
+    A.numBytes_ = 0;
+    // Moving a matrix keeps its dimensions, so drop the stale view
+    A.A_.Empty();
+}
+
+template<typename T>
+MappedMatrix<T>& MappedMatrix<T>::operator=( MappedMatrix<T>&& A )
+{
+    if( this != &A )
+    {
+        Unmap();
+        data_ = A.data_;
+        numBytes_ = A.numBytes_;
+        writable_ = A.writable_;
+        A_ = std::move(A.A_);
+        A.data_ = nullptr;
+        A.numBytes_ = 0;
+        A.A_.Empty();
+    }
+    return *this;
+}
+
+template<typename T>
+El::Matrix<T>& MappedMatrix<T>::Matrix()
+{
+    EL_DEBUG_CSE
+    if( !writable_ )
+        LogicError("Cannot modify a read-only mapping");
+    return A_;
+}
+
+template<typename T>
+void MappedMatrix<T>::Sync()
+{
+    EL_DEBUG_CSE
+#ifdef HYDROGEN_HAVE_MMAP
+    if( writable_ && data_ != nullptr && msync( data_, numBytes_, MS_SYNC ) )
+        RuntimeError("Could not synchronize the mapped file");
+#endif // HYDROGEN_HAVE_MMAP
+}
+
+template<typename T>
+void MappedMatrix<T>::Unmap() EL_NO_EXCEPT
+{
+#ifdef HYDROGEN_HAVE_MMAP
+    if( data_ != nullptr )
+        munmap( data_, numBytes_ );
+#endif // HYDROGEN_HAVE_MMAP
+    data_ = nullptr;
+    numBytes_ = 0;
+    A_.Empty();
+}
+
+template<typename T>
+MappedMatrix<T> MapBinary
+( const string filename, bool writable, MapAdvice advice )
+{
+    EL_DEBUG_CSE
+    return MappedMatrix<T>( filename, BINARY, 0, 0, writable, advice );
+}
+
+template<typename T>
+MappedMatrix<T> MapBinaryFlat
+( const string filename, Int height, Int width,
+  bool writable, MapAdvice advice )
+{
+    EL_DEBUG_CSE
+    return MappedMatrix<T>
+      ( filename, BINARY_FLAT, height, width, writable, advice );
+}
+
+#define PROTO(T) \
+  template class MappedMatrix<T>; \
+  template MappedMatrix<T> MapBinary \
+  ( const string filename, bool writable, MapAdvice advice ); \
+  template MappedMatrix<T> MapBinaryFlat \
+  ( const string filename, Int height, Int width, \
+    bool writable, MapAdvice advice );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_HALF
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./MPIFile.hpp"
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
@@ -81,8 +82,11 @@ void Read
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
         {
-            Read( A.Matrix(), filename, format );
-            A.Resize( A.Matrix().Height(), A.Matrix().Width() );
+            // The local matrix has a fixed size, so read into a temporary
+            Matrix<T> ALoc( A.Height(), A.Width() );
+            Read( ALoc, filename, format );
+            A.Resize( ALoc.Height(), ALoc.Width() );
+            Copy( ALoc, A.Matrix() );
         }
         A.MakeSizeConsistent();
     }
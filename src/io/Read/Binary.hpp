@@ -45,6 +45,26 @@ inline void
 Binary( AbstractDistMatrix<T>& A, const string filename )
 {
     EL_DEBUG_CSE
+    if( mpi_io::Supported(A) )
+    {
+        mpi_io::File file
+        ( A.Grid().ViewingComm(), filename, MPI_MODE_RDONLY );
+        Int dims[2];
+        file.ReadAtAll( 0, dims, 2*sizeof(Int) );
+        const Int height = dims[0];
+        const Int width = dims[1];
+        const Int numBytes = file.Size();
+        const Int metaBytes = 2*sizeof(Int);
+        const Int numBytesExp = metaBytes + height*width*sizeof(T);
+        if( numBytes != numBytesExp )
+            RuntimeError
+            ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+        A.Resize( height, width );
+        file.ReadAll( A, metaBytes );
+        return;
+    }
+
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
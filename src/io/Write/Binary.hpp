@@ -35,6 +35,26 @@ Binary( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Collectively write the matrix with MPI-IO; see mpi_io::Supported
+template<typename T>
+inline void
+Binary( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY);
+    mpi_io::File file
+    ( A.Grid().ViewingComm(), filename, MPI_MODE_CREATE|MPI_MODE_WRONLY );
+
+    const Int metaBytes = 2*sizeof(Int);
+    file.SetSize( metaBytes + A.Height()*A.Width()*sizeof(T) );
+    if( A.Grid().ViewingRank() == 0 )
+    {
+        const Int dims[2] = { A.Height(), A.Width() };
+        file.WriteAt( 0, dims, metaBytes );
+    }
+    file.WriteAll( A, metaBytes );
+}
+
 } // namespace write
 } // namespace El
 
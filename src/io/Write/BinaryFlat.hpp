@@ -30,6 +30,19 @@ BinaryFlat( const Matrix<T>& A, string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Collectively write the matrix with MPI-IO; see mpi_io::Supported
+template<typename T>
+inline void
+BinaryFlat( const AbstractDistMatrix<T>& A, string basename="matrix" )
+{
+    EL_DEBUG_CSE
+    string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi_io::File file
+    ( A.Grid().ViewingComm(), filename, MPI_MODE_CREATE|MPI_MODE_WRONLY );
+    file.SetSize( A.Height()*A.Width()*sizeof(T) );
+    file.WriteAll( A, 0 );
+}
+
 } // namespace write
 } // namespace El
 
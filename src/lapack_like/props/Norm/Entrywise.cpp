@@ -10,22 +10,26 @@
 
 namespace El {
 
+template<typename Field>
+local_norm::ScaledSum<Base<Field>>
+LocalScaledPowers( const AbstractMatrix<Field>& A, Base<Field> p )
+{
+    if( A.GetDevice() == Device::CPU )
+        return local_norm::Powers
+          ( static_cast<const Matrix<Field,Device::CPU>&>(A), p );
+    AbstractMatrixReadDeviceProxy<Field,Device::CPU> AProxy( A );
+    return local_norm::Powers( AProxy.GetLocked(), p );
+}
+
 template<typename Field>
 Base<Field> EntrywiseNorm( const AbstractMatrix<Field>& A, Base<Field> p )
 {
     EL_DEBUG_CSE
-    if(A.GetDevice() != Device::CPU)
-      LogicError("EntrywiseNorm: Unsupported function for non-CPU Matrix");
-
-    // TODO(poulson): Make this more numerically stable
-    typedef Base<Field> Real;
-    Real sum{0};
-    const Int width = A.Width();
-    const Int height = A.Height();
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            sum += Pow( Abs(A(i,j)), p );
-    return Pow( sum, 1/p );
+    // The two-norm has a device reduction
+    if( p == Base<Field>(2) )
+        return FrobeniusNorm( A );
+    const local_norm::Power<Base<Field>> power{p};
+    return local_norm::Root( LocalScaledPowers( A, p ), power );
 }
 
 template<typename Field>
@@ -86,23 +90,69 @@ Base<Field> EntrywiseNorm( const AbstractDistMatrix<Field>& A, Base<Field> p )
     EL_DEBUG_CSE
     typedef Base<Field> Real;
     Real norm;
+    if( p == Real(2) )
+        return FrobeniusNorm( A );
     if( A.Participating() )
     {
-        Real localSum{0};
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        const Matrix<Field>& ALoc = A.LockedMatrix();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                localSum += Pow( Abs(ALoc(iLoc,jLoc)), p );
-        const Real sum = mpi::AllReduce( localSum, A.DistComm(),
-                                         SyncInfo<Device::CPU>{} );
-        norm = Pow( sum, 1/p );
+        const local_norm::Power<Real> power{p};
+        auto localSum = LocalScaledPowers( A.LockedMatrix(), p );
+
+        // Equilibrate the local sums to the maximum scale before combining
+        const Real scale = mpi::AllReduce
+          ( localSum.scale, mpi::MAX, A.DistComm(), SyncInfo<Device::CPU>{} );
+        if( scale != Real(0) )
+        {
+            // Equal scales are not divided, so that infinite ones give Inf
+            if( localSum.scale == Real(0) )
+                localSum.scaledSum = Real(0);
+            else if( localSum.scale != scale )
+                localSum.scaledSum *= power(localSum.scale/scale);
+            localSum.scale = scale;
+            localSum.scaledSum = mpi::AllReduce
+              ( localSum.scaledSum, A.DistComm(), SyncInfo<Device::CPU>{} );
+            norm = local_norm::Root( localSum, power );
+        }
+        else
+            norm = Real(0);
     }
     mpi::Broadcast( norm, A.Root(), A.CrossComm(), SyncInfo<Device::CPU>{} );
     return norm;
 }
 
+template<typename Field>
+vector<Base<Field>> EntrywiseNorms
+( const vector<const AbstractDistMatrix<Field>*>& matrices, Base<Field> p )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( p == Real(2) )
+        return FrobeniusNorms( matrices );
+    const Int numMatrices = matrices.size();
+    vector<Real> norms(numMatrices, Real(0));
+    if( numMatrices == 0 )
+        return norms;
+    const Grid& g = matrices[0]->Grid();
+    for( auto const* A : matrices )
+        if( A->Grid() != g )
+            LogicError("EntrywiseNorms: The matrices must share a grid");
+    if( !g.InGrid() )
+        return norms;
+
+    // Each entry is contributed by exactly one process of the grid
+    const local_norm::Power<Real> power{p};
+    vector<local_norm::ScaledSum<Real>> sums(numMatrices);
+    for( Int k=0; k<numMatrices; ++k )
+    {
+        auto const& A = *matrices[k];
+        if( A.Participating() && A.RedundantRank() == 0 )
+            sums[k] = LocalScaledPowers( A.LockedMatrix(), p );
+    }
+    local_norm::AllReduce( sums, power, g.Comm() );
+    for( Int k=0; k<numMatrices; ++k )
+        norms[k] = local_norm::Root( sums[k], power );
+    return norms;
+}
+
 template<typename Field>
 Base<Field> HermitianEntrywiseNorm
 ( UpperOrLower uplo, const AbstractDistMatrix<Field>& A, Base<Field> p )
@@ -172,6 +222,9 @@ Base<Field> SymmetricEntrywiseNorm
   template Base<Field> EntrywiseNorm( const AbstractMatrix<Field>& A, Base<Field> p ); \
   template Base<Field> \
   EntrywiseNorm( const AbstractDistMatrix<Field>& A, Base<Field> p ); \
+  template vector<Base<Field>> EntrywiseNorms \
+  ( const vector<const AbstractDistMatrix<Field>*>& matrices, \
+    Base<Field> p ); \
   template Base<Field> HermitianEntrywiseNorm \
   ( UpperOrLower uplo, const Matrix<Field>& A, Base<Field> p ); \
   template Base<Field> HermitianEntrywiseNorm \
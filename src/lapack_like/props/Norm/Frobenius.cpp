@@ -8,40 +8,81 @@
 */
 #include <El.hpp>
 
+#ifdef HYDROGEN_HAVE_CUDA
+#include <hydrogen/blas/gpu/ScaledSquare.hpp>
+#endif
+
 namespace El {
 
-template <typename Field>
-Base<Field> FrobeniusNorm(AbstractMatrix<Field> const& A)
+#ifdef HYDROGEN_HAVE_CUDA
+// Reduce the local matrix on the device, so that only the partial sums are
+// copied to the host
+template<typename Field,typename=EnableIf<std::is_floating_point<Field>>>
+local_norm::ScaledSum<Base<Field>>
+LocalScaledSquare(Matrix<Field,Device::GPU> const& A)
+{
+    typedef Base<Field> Real;
+    // The partials must be allocated, written, and copied on A's stream
+    Matrix<Real,Device::GPU> partials;
+    SetSyncInfo(partials, SyncInfoFromMatrix(A));
+    partials.Resize(2*hydrogen::ScaledSquare_GPU_max_partials, 1);
+    const Int numPartials =
+        hydrogen::ScaledSquare_GPU_impl(
+            A.Height(), A.Width(), A.LockedBuffer(), A.LDim(),
+            partials.Buffer(), SyncInfoFromMatrix(A).stream_);
+    Matrix<Real,Device::CPU> partialsCPU(partials);
+
+    local_norm::ScaledSum<Real> sum;
+    for (Int k=0; k<numPartials; ++k)
+        local_norm::Combine(
+            sum,
+            local_norm::ScaledSum<Real>{partialsCPU(2*k), partialsCPU(2*k+1)},
+            local_norm::Square());
+    return sum;
+}
+
+template<typename Field,typename=DisableIf<std::is_floating_point<Field>>,
+         typename=void>
+local_norm::ScaledSum<Base<Field>>
+LocalScaledSquare(Matrix<Field,Device::GPU> const& A)
+{
+    Matrix<Field,Device::CPU> ACPU(A);
+    return local_norm::Squares(ACPU);
+}
+#endif // HYDROGEN_HAVE_CUDA
+
+template<typename Field>
+local_norm::ScaledSum<Base<Field>>
+LocalScaledSquare(AbstractMatrix<Field> const& A)
 {
     switch (A.GetDevice())
     {
     case Device::CPU:
-        return FrobeniusNorm(static_cast<Matrix<Field,Device::CPU> const&>(A));
+        return local_norm::Squares(
+            static_cast<Matrix<Field,Device::CPU> const&>(A));
 #ifdef HYDROGEN_HAVE_CUDA
     case Device::GPU:
-    {
-        AbstractMatrixReadDeviceProxy<Field,Device::CPU> ALocProxy{A};
-        return FrobeniusNorm(ALocProxy.GetLocked());
-    }
+        return LocalScaledSquare(
+            static_cast<Matrix<Field,Device::GPU> const&>(A));
 #endif //HYDROGEN_HAVE_CUDA
     default:
         LogicError("FrobeniusNorm: Bad Device.");
     }
+    return local_norm::ScaledSum<Base<Field>>();
+}
+
+template <typename Field>
+Base<Field> FrobeniusNorm(AbstractMatrix<Field> const& A)
+{
+    EL_DEBUG_CSE
+    return local_norm::Root(LocalScaledSquare(A), local_norm::Square());
 }
 
 template<typename Field>
 Base<Field> FrobeniusNorm(const Matrix<Field>& A)
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    Real scale = TypeTraits<Real>::Zero();
-    Real scaledSquare = TypeTraits<Real>::One();
-    const Int width = A.Width();
-    const Int height = A.Height();
-    for (Int j=0; j<width; ++j)
-        for (Int i=0; i<height; ++i)
-            UpdateScaledSquare(A(i,j), scale, scaledSquare);
-    return scale*Sqrt(scaledSquare);
+    return local_norm::Root(local_norm::Squares(A), local_norm::Square());
 }
 
 template<typename Field>
@@ -51,36 +92,29 @@ Base<Field> HermitianFrobeniusNorm(UpperOrLower uplo, const Matrix<Field>& A)
     if (A.Height() != A.Width())
         LogicError("Hermitian matrices must be square.");
 
+    // Each off-diagonal entry of the stored triangle is counted twice
     typedef Base<Field> Real;
-    Real scale = TypeTraits<Real>::Zero();
-    Real scaledSquare = TypeTraits<Real>::One();
-    const Int height = A.Height();
-    const Int width = A.Width();
-    if (uplo == UPPER)
+    const Int n = A.Width();
+    const Field* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    vector<local_norm::ScaledSum<Real>> sums(n);
+    EL_PARALLEL_FOR
+    for (Int j=0; j<n; ++j)
     {
-        for (Int j=0; j<width; ++j)
-        {
-            for (Int i=0; i<j; ++i)
-            {
-                UpdateScaledSquare(A(i,j), scale, scaledSquare);
-                UpdateScaledSquare(A(i,j), scale, scaledSquare);
-            }
-            UpdateScaledSquare(A(j,j), scale, scaledSquare);
-        }
-    }
-    else
-    {
-        for (Int j=0; j<width; ++j)
-        {
-            for (Int i=j+1; i<height; ++i)
-            {
-                UpdateScaledSquare(A(i,j), scale, scaledSquare);
-                UpdateScaledSquare(A(i,j), scale, scaledSquare);
-            }
-            UpdateScaledSquare(A(j,j), scale, scaledSquare);
-        }
+        const Int offDiagBeg = (uplo == UPPER ? 0 : j+1);
+        const Int offDiagEnd = (uplo == UPPER ? j : n);
+        auto& sum = sums[j];
+        sum = local_norm::VectorSum(
+            &ABuf[offDiagBeg+j*ALDim], offDiagEnd-offDiagBeg,
+            local_norm::SquaresKernel());
+        sum.scaledSum *= 2;
+        local_norm::UpdateSum(sum, ABuf[j+j*ALDim], local_norm::Square());
     }
-    return scale*Sqrt(scaledSquare);
+
+    local_norm::ScaledSum<Real> sum;
+    for (Int j=0; j<n; ++j)
+        local_norm::Combine(sum, sums[j], local_norm::Square());
+    return local_norm::Root(sum, local_norm::Square());
 }
 
 template<typename Field>
@@ -100,9 +134,13 @@ Real NormFromScaledSquare
 
     if (scale != TypeTraits<Real>::Zero())
     {
-        // Equilibrate our local scaled sum to the maximum scale
-        Real relScale = localScale/scale;
-        localScaledSquare *= relScale*relScale;
+        // Equilibrate our local scaled sum to the maximum scale. Equal
+        // scales are not divided, so that infinite scales give Inf, not NaN.
+        if (localScale != scale)
+        {
+            Real relScale = localScale/scale;
+            localScaledSquare *= relScale*relScale;
+        }
 
         // The scaled square is now the sum of the local contributions
         const Real scaledSquare = mpi::AllReduce(localScaledSquare, comm,
@@ -121,20 +159,9 @@ Base<Field> FrobeniusNorm(const AbstractDistMatrix<Field>& A)
     Real norm;
     if (A.Participating())
     {
-        Real localScale = TypeTraits<Real>::Zero(),
-            localScaledSquare = TypeTraits<Real>::One();
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-
-        AbstractMatrixReadDeviceProxy<Field,Device::CPU>
-            ALocProxy{A.LockedMatrix()};
-
-        auto const& ALoc = ALocProxy.GetLocked();
-
-        for (Int jLoc=0; jLoc<localWidth; ++jLoc)
-            for (Int iLoc=0; iLoc<localHeight; ++iLoc)
-                UpdateScaledSquare
-                    (ALoc(iLoc,jLoc), localScale, localScaledSquare);
+        const auto localSum = LocalScaledSquare(A.LockedMatrix());
+        Real localScale = localSum.scale,
+            localScaledSquare = localSum.scaledSum;
         norm = NormFromScaledSquare
             (localScale, localScaledSquare, A.DistComm());
     }
@@ -142,6 +169,158 @@ Base<Field> FrobeniusNorm(const AbstractDistMatrix<Field>& A)
     return norm;
 }
 
+// Each entry is contributed by exactly one process of the grid: the member
+// of the first redundant copy of the matrix that participates in its root.
+// Returns false if this process holds no part of the matrices.
+template<typename Field>
+bool LocalScaledSquares
+(vector<const AbstractDistMatrix<Field>*> const& matrices,
+ vector<local_norm::ScaledSum<Base<Field>>>& sums)
+{
+    const Int numMatrices = matrices.size();
+    sums.assign(numMatrices, local_norm::ScaledSum<Base<Field>>());
+    if (numMatrices == 0)
+        return false;
+    const Grid& g = matrices[0]->Grid();
+    for (auto const* A : matrices)
+        if (A->Grid() != g)
+            LogicError("FrobeniusNorms: The matrices must share a grid");
+    if (!g.InGrid())
+        return false;
+
+    for (Int k=0; k<numMatrices; ++k)
+    {
+        auto const& A = *matrices[k];
+        if (A.Participating() && A.RedundantRank() == 0)
+            sums[k] = LocalScaledSquare(A.LockedMatrix());
+    }
+    return true;
+}
+
+template<typename Field>
+vector<Base<Field>> FrobeniusNorms
+(vector<const AbstractDistMatrix<Field>*> const& matrices)
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int numMatrices = matrices.size();
+    vector<Real> norms(numMatrices, Real(0));
+    vector<local_norm::ScaledSum<Real>> sums;
+    if (!LocalScaledSquares(matrices, sums))
+        return norms;
+    local_norm::AllReduce(
+        sums, local_norm::Square(), matrices[0]->Grid().Comm());
+    for (Int k=0; k<numMatrices; ++k)
+        norms[k] = local_norm::Root(sums[k], local_norm::Square());
+    return norms;
+}
+
+// A nonblocking reduction cannot use the shared user-defined operation,
+// which another reduction could replace before this one completes, so the
+// scaled squares are combined by an operation of their own
+template<typename Real>
+void CombineScaledSquares
+(void* inVoid, void* inOutVoid, int* length, mpi::Datatype*)
+{
+    auto const* in = static_cast<Complex<Real> const*>(inVoid);
+    auto* inOut = static_cast<Complex<Real>*>(inOutVoid);
+    for (int k=0; k<*length; ++k)
+    {
+        local_norm::ScaledSum<Real>
+            gamma{RealPart(inOut[k]), ImagPart(inOut[k])};
+        local_norm::Combine(
+            gamma,
+            local_norm::ScaledSum<Real>{RealPart(in[k]), ImagPart(in[k])},
+            local_norm::Square());
+        inOut[k] = Complex<Real>(gamma.scale, gamma.scaledSum);
+    }
+}
+
+// The operation is created on first use and freed when MPI is finalized,
+// which deletes the attributes of MPI_COMM_SELF
+template<typename Real>
+int FreeScaledSquaresOp(MPI_Comm, int, void* op, void*)
+{
+    mpi::Op* mpiOp = static_cast<mpi::Op*>(op);
+    MPI_Op_free(&mpiOp->op);
+    delete mpiOp;
+    return MPI_SUCCESS;
+}
+
+template<typename Real>
+mpi::Op ScaledSquaresOp()
+{
+    static mpi::Op op = []()
+    {
+        mpi::Op* newOp = new mpi::Op;
+        mpi::Create(&CombineScaledSquares<Real>, true, *newOp);
+        int keyval;
+        MPI_Comm_create_keyval(
+            MPI_COMM_NULL_COPY_FN, &FreeScaledSquaresOp<Real>, &keyval,
+            nullptr);
+        MPI_Comm_set_attr(MPI_COMM_SELF, keyval, newOp);
+        MPI_Comm_free_keyval(&keyval);
+        return *newOp;
+    }();
+    return op;
+}
+
+template<typename Real>
+using HasNonblockingPairReduction =
+    hydrogen::And<local_norm::HasPairReduction<Real>, IsPacked<Real>>;
+
+template<typename Real,
+         typename=EnableIf<HasNonblockingPairReduction<Real>>>
+void IAllReduceScaledSquares
+(vector<local_norm::ScaledSum<Real>> const& sums, mpi::Comm const& comm,
+ vector<Complex<Real>>& pairs, mpi::Request<Complex<Real>>& request,
+ bool& active)
+{
+    const Int numSums = sums.size();
+    pairs.resize(numSums);
+    for (Int k=0; k<numSums; ++k)
+        pairs[k] = Complex<Real>(sums[k].scale, sums[k].scaledSum);
+    mpi::IAllReduce(
+        pairs.data(), numSums, ScaledSquaresOp<Real>(), comm, request,
+        SyncInfo<Device::CPU>{});
+    active = true;
+}
+
+// Types without a native pair reduction are reduced before returning
+template<typename Real,
+         typename=DisableIf<HasNonblockingPairReduction<Real>>,
+         typename=void>
+void IAllReduceScaledSquares
+(vector<local_norm::ScaledSum<Real>> sums, mpi::Comm const& comm,
+ vector<Complex<Real>>& pairs, mpi::Request<Complex<Real>>&, bool& active)
+{
+    local_norm::AllReduce(sums, local_norm::Square(), comm);
+    const Int numSums = sums.size();
+    pairs.resize(numSums);
+    for (Int k=0; k<numSums; ++k)
+        pairs[k] = Complex<Real>(sums[k].scale, sums[k].scaledSum);
+    active = false;
+}
+
+template<typename Field>
+FrobeniusNormsRequest<Base<Field>> FrobeniusNormsAsync
+(vector<const AbstractDistMatrix<Field>*> const& matrices)
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    FrobeniusNormsRequest<Real> request;
+    vector<local_norm::ScaledSum<Real>> sums;
+    if (LocalScaledSquares(matrices, sums))
+        IAllReduceScaledSquares(
+            sums, matrices[0]->Grid().Comm(),
+            request.pairs_, request.request_, request.active_);
+    else
+        request.pairs_.assign(matrices.size(), Complex<Real>(0));
+    if (!request.active_)
+        request.Finish();
+    return request;
+}
+
 template<typename Field>
 Base<Field> HermitianFrobeniusNorm
 (UpperOrLower uplo, const AbstractDistMatrix<Field>& A)
@@ -211,8 +390,13 @@ Base<Field> SymmetricFrobeniusNorm
 }
 
 #define PROTO(Field) \
+  template Base<Field> FrobeniusNorm(AbstractMatrix<Field> const& A); \
   template Base<Field> FrobeniusNorm(const Matrix<Field>& A); \
   template Base<Field> FrobeniusNorm (const AbstractDistMatrix<Field>& A); \
+  template vector<Base<Field>> FrobeniusNorms \
+  (vector<const AbstractDistMatrix<Field>*> const& matrices); \
+  template FrobeniusNormsRequest<Base<Field>> FrobeniusNormsAsync \
+  (vector<const AbstractDistMatrix<Field>*> const& matrices); \
   template Base<Field> HermitianFrobeniusNorm \
   (UpperOrLower uplo, const Matrix<Field>& A); \
   template Base<Field> HermitianFrobeniusNorm \
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterFill.hpp"
+
 namespace El {
 
 template<typename T>
@@ -21,13 +23,18 @@ void Bernoulli( Matrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
-    auto doubleCoin = [=]() -> T
-    {
-        const double alpha = SampleUniform<double>(0,1);
-        if( alpha <= q ) return T(0); 
-        else             return T(1);
-    };
-    EntrywiseFill( A, function<T()>(doubleCoin) );
+    counter_fill::FillOr
+    ( A, counter_fill::BernoulliSampler<T>{p},
+      [&]()
+      {
+          auto doubleCoin = [=]() -> T
+          {
+              const double alpha = SampleUniform<double>(0,1);
+              if( alpha <= q ) return T(0);
+              else             return T(1);
+          };
+          EntrywiseFill( A, function<T()>(doubleCoin) );
+      } );
 }
 
 template<typename T>
@@ -39,13 +46,18 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
-    auto doubleCoin = [=]() -> T
-    {
-        const double alpha = SampleUniform<double>(0,1);
-        if( alpha <= q ) return T(0); 
-        else             return T(1);
-    };
-    EntrywiseFill( A, function<T()>(doubleCoin) );
+    counter_fill::FillOr
+    ( A, counter_fill::BernoulliSampler<T>{p},
+      [&]()
+      {
+          auto doubleCoin = [=]() -> T
+          {
+              const double alpha = SampleUniform<double>(0,1);
+              if( alpha <= q ) return T(0);
+              else             return T(1);
+          };
+          EntrywiseFill( A, function<T()>(doubleCoin) );
+      } );
 }
 
 #define PROTO(T) \
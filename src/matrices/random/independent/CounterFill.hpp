@@ -0,0 +1,327 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_RANDOM_COUNTERFILL_HPP
+#define EL_MATRICES_RANDOM_COUNTERFILL_HPP
+
+// Fill random matrices with the counter-based generator (see
+// El/core/random/Philox.hpp). Since each entry only depends upon the seed,
+// the stream, and its global indices, the entries can be generated in
+// parallel by every thread of every process, the redundant copies of a
+// distributed matrix are generated locally rather than broadcast, and the
+// result does not depend upon the process grid.
+//
+// Each sampler maps the random bits of an entry to a value. Its 'supported'
+// member states whether the entry type can be sampled, as the generator
+// only produces float and double precision values; unsupported types fall
+// back to the sequential Mersenne twister. Likewise, 'gpuSupported' states
+// whether the sampler has a device kernel (see hydrogen/blas/gpu/Random.hpp),
+// which generates the same values as the host from the same counters.
+
+#ifdef HYDROGEN_HAVE_CUDA
+#include <hydrogen/blas/gpu/Random.hpp>
+#endif
+
+namespace El {
+namespace counter_fill {
+
+template<typename Real>
+struct IsSampledReal
+{
+    static const bool value =
+      std::is_same<Real,float>::value || std::is_same<Real,double>::value;
+};
+
+// Uniform over the (closed) ball of the given radius
+// --------------------------------------------------
+template<typename Real>
+Real SampleBall( const philox::Bits& b, const Real& center, const Real& radius )
+{
+    const double u = philox::UnitInterval( b.x0, b.x1 );
+    return center + radius*Real(2*u-1);
+}
+
+template<typename Real>
+Complex<Real> SampleBall
+( const philox::Bits& b, const Complex<Real>& center, const Real& radius )
+{
+    const double r = radius*philox::UnitInterval( b.x0, b.x1 );
+    const double angle = 2*Pi<double>()*philox::UnitInterval( b.x2, b.x3 );
+    return center + Complex<Real>( Real(r*Cos(angle)), Real(r*Sin(angle)) );
+}
+
+template<typename T>
+struct UniformSampler
+{
+    static const bool supported = IsSampledReal<Base<T>>::value;
+    static const bool gpuSupported = IsSampledReal<T>::value;
+    T center;
+    Base<T> radius;
+
+    T operator()( const philox::Bits& b ) const
+    { return SampleBall( b, center, radius ); }
+
+#ifdef HYDROGEN_HAVE_CUDA
+    void FillGPU
+    ( Int height, Int width, const hydrogen::RandomIndexing& indexing,
+      T* buffer, Int ldim, cudaStream_t stream ) const
+    {
+        hydrogen::UniformFill_GPU_impl
+        ( height, width, center, radius, indexing, buffer, ldim, stream );
+    }
+#endif
+};
+
+// Normal (via the Box-Muller transform)
+// -------------------------------------
+template<typename Real>
+Real SampleNormal( const philox::Bits& b, const Real& mean, const Real& stddev )
+{
+    const double r = Sqrt(-2*Log(philox::PositiveUnitInterval( b.x0, b.x1 )));
+    const double angle = 2*Pi<double>()*philox::UnitInterval( b.x2, b.x3 );
+    return mean + stddev*Real(r*Cos(angle));
+}
+
+// Both components are independently drawn, as in El::SampleNormal
+template<typename Real>
+Complex<Real> SampleNormal
+( const philox::Bits& b, const Complex<Real>& mean, const Real& stddev )
+{
+    const double r = Sqrt(-2*Log(philox::PositiveUnitInterval( b.x0, b.x1 )));
+    const double angle = 2*Pi<double>()*philox::UnitInterval( b.x2, b.x3 );
+    const Real stddevAdj = stddev/Sqrt(Real(2));
+    return mean +
+      stddevAdj*Complex<Real>( Real(r*Cos(angle)), Real(r*Sin(angle)) );
+}
+
+template<typename F>
+struct NormalSampler
+{
+    static const bool supported = IsSampledReal<Base<F>>::value;
+    static const bool gpuSupported = IsSampledReal<F>::value;
+    F mean;
+    Base<F> stddev;
+
+    F operator()( const philox::Bits& b ) const
+    { return SampleNormal( b, mean, stddev ); }
+
+#ifdef HYDROGEN_HAVE_CUDA
+    void FillGPU
+    ( Int height, Int width, const hydrogen::RandomIndexing& indexing,
+      F* buffer, Int ldim, cudaStream_t stream ) const
+    {
+        hydrogen::NormalFill_GPU_impl
+        ( height, width, mean, stddev, indexing, buffer, ldim, stream );
+    }
+#endif
+};
+
+// -1 and +1 each with probability p/2, and 0 otherwise
+// ----------------------------------------------------
+template<typename T>
+struct ThreeValuedSampler
+{
+    static const bool supported = IsStdScalar<T>::value;
+    static const bool gpuSupported = false;
+    double p;
+
+    T operator()( const philox::Bits& b ) const
+    {
+        const double alpha = philox::UnitInterval( b.x0, b.x1 );
+        if( alpha <= p/2 ) return T(-1);
+        else if( alpha <= p ) return T(1);
+        else return T(0);
+    }
+};
+
+// 1 with probability p, and 0 otherwise
+// -------------------------------------
+template<typename T>
+struct BernoulliSampler
+{
+    static const bool supported = IsStdScalar<T>::value;
+    static const bool gpuSupported = false;
+    double p;
+
+    T operator()( const philox::Bits& b ) const
+    {
+        const double alpha = philox::UnitInterval( b.x0, b.x1 );
+        if( alpha <= 1-p ) return T(0);
+        else return T(1);
+    }
+};
+
+// The kernel
+// ----------
+// Local entry (iLoc,jLoc) of A is global entry (rows[iLoc],cols[jLoc])
+template<typename T,typename Sampler>
+void Fill
+( Matrix<T,Device::CPU>& A, const vector<Int>& rows, const vector<Int>& cols,
+  const philox::Key& key, std::uint32_t tag, const Sampler& sample )
+{
+    const Int localHeight = rows.size();
+    const Int localWidth = cols.size();
+    const Int* rowBuf = rows.data();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = cols[jLoc];
+        T* col = &ABuf[jLoc*ALDim];
+        EL_SIMD
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            col[iLoc] = sample( philox::Entry( key, rowBuf[iLoc], j, tag ) );
+    }
+}
+
+template<typename Sampler,Device D>
+struct Sampled
+{
+    static const bool value = D == Device::CPU && Sampler::supported;
+};
+
+#ifdef HYDROGEN_HAVE_CUDA
+template<typename Sampler>
+struct Sampled<Sampler,Device::GPU>
+{
+    static const bool value = Sampler::gpuSupported;
+};
+
+// Launch the device kernel on local entry (iLoc,jLoc), which is global entry
+// (colShift+iLoc*colStride,rowShift+jLoc*rowStride)
+template<typename T,typename Sampler>
+void FillGPU
+( Matrix<T,Device::GPU>& A,
+  Int colShift, Int colStride, Int rowShift, Int rowStride,
+  const philox::Key& key, std::uint32_t tag, const Sampler& sample )
+{
+    hydrogen::RandomIndexing indexing;
+    indexing.col_shift = colShift;
+    indexing.col_stride = colStride;
+    indexing.row_shift = rowShift;
+    indexing.row_stride = rowStride;
+    indexing.key0 = key.k0;
+    indexing.key1 = key.k1;
+    indexing.tag = tag;
+    sample.FillGPU
+    ( A.Height(), A.Width(), indexing, A.Buffer(), A.LDim(),
+      SyncInfoFromMatrix(A).stream_ );
+}
+#endif // HYDROGEN_HAVE_CUDA
+
+template<typename T,typename Sampler>
+void FillLocal
+( Matrix<T,Device::CPU>& A,
+  const philox::Key& key, std::uint32_t tag, const Sampler& sample )
+{
+    vector<Int> rows(A.Height()), cols(A.Width());
+    std::iota( rows.begin(), rows.end(), Int(0) );
+    std::iota( cols.begin(), cols.end(), Int(0) );
+    Fill( A, rows, cols, key, tag, sample );
+}
+
+#ifdef HYDROGEN_HAVE_CUDA
+template<typename T,typename Sampler>
+void FillLocal
+( Matrix<T,Device::GPU>& A,
+  const philox::Key& key, std::uint32_t tag, const Sampler& sample )
+{ FillGPU( A, 0, 1, 0, 1, key, tag, sample ); }
+#endif // HYDROGEN_HAVE_CUDA
+
+// Fill a sequential matrix with a new stream, or call 'fallback' if it is
+// not supported. The stream is tagged with the process rank so that the
+// sequential matrices of different processes differ.
+template<typename T,Device D,typename Sampler,typename Fallback,
+         typename=EnableIf<Sampled<Sampler,D>>>
+void FillOr( Matrix<T,D>& A, const Sampler& sample, Fallback fallback )
+{
+    EL_DEBUG_CSE
+    const auto key = philox::MakeKey( RandomSeed(), NextRandomStream() );
+    const std::uint32_t tag = mpi::Rank(mpi::COMM_WORLD) + 1;
+    FillLocal( A, key, tag, sample );
+}
+
+template<typename T,Device D,typename Sampler,typename Fallback,
+         typename=DisableIf<Sampled<Sampler,D>>,typename=void>
+void FillOr( Matrix<T,D>& A, const Sampler& sample, Fallback fallback )
+{ fallback(); }
+
+// Generate the local entries of an elementally-distributed matrix stored on
+// the GPU in place; returns false if that is not possible
+#ifdef HYDROGEN_HAVE_CUDA
+template<typename T,typename Sampler,
+         typename=EnableIf<Sampled<Sampler,Device::GPU>>>
+bool TryFillGPU
+( AbstractDistMatrix<T>& A, const philox::Key& key, const Sampler& sample )
+{
+    if( A.GetLocalDevice() != Device::GPU || A.Wrap() != ELEMENT )
+        return false;
+    auto& ALoc = static_cast<Matrix<T,Device::GPU>&>(A.Matrix());
+    FillGPU
+    ( ALoc, A.ColShift(), A.ColStride(), A.RowShift(), A.RowStride(),
+      key, 0, sample );
+    return true;
+}
+
+template<typename T,typename Sampler,
+         typename=DisableIf<Sampled<Sampler,Device::GPU>>,typename=void>
+bool TryFillGPU
+( AbstractDistMatrix<T>&, const philox::Key&, const Sampler& )
+{ return false; }
+#endif // HYDROGEN_HAVE_CUDA
+
+// Fill a distributed matrix with a new stream agreed upon by its grid, or
+// call 'fallback' if it is not supported
+template<typename T,typename Sampler,typename Fallback,
+         typename=EnableIf<Sampled<Sampler,Device::CPU>>>
+void FillOr
+( AbstractDistMatrix<T>& A, const Sampler& sample, Fallback fallback )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    const auto key =
+      philox::MakeKey( RandomSeed(), NextRandomStream(g.Comm()) );
+#ifdef HYDROGEN_HAVE_CUDA
+    if( TryFillGPU( A, key, sample ) )
+        return;
+#endif // HYDROGEN_HAVE_CUDA
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    vector<Int> rows(localHeight), cols(localWidth);
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        rows[iLoc] = A.GlobalRow(iLoc);
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        cols[jLoc] = A.GlobalCol(jLoc);
+
+    if( A.GetLocalDevice() == Device::CPU )
+    {
+        auto& ALoc = static_cast<Matrix<T,Device::CPU>&>(A.Matrix());
+        Fill( ALoc, rows, cols, key, 0, sample );
+    }
+    else
+    {
+        Matrix<T,Device::CPU> ALoc( localHeight, localWidth );
+        Fill( ALoc, rows, cols, key, 0, sample );
+        Copy( ALoc, A.Matrix() );
+    }
+}
+
+template<typename T,typename Sampler,typename Fallback,
+         typename=DisableIf<Sampled<Sampler,Device::CPU>>,typename=void>
+void FillOr
+( AbstractDistMatrix<T>& A, const Sampler& sample, Fallback fallback )
+{ fallback(); }
+
+} // namespace counter_fill
+} // namespace El
+
+#endif // ifndef EL_MATRICES_RANDOM_COUNTERFILL_HPP
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterFill.hpp"
+
 namespace El {
 
 
@@ -18,8 +20,13 @@ template<typename F,Device D,typename>
 void MakeGaussian( Matrix<F,D>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
-    auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
-    EntrywiseFill( A, function<F()>(sampleNormal) );
+    counter_fill::FillOr
+    ( A, counter_fill::NormalSampler<F>{mean,stddev},
+      [&]()
+      {
+          auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
+          EntrywiseFill( A, function<F()>(sampleNormal) );
+      } );
 }
 
 template<typename F, Device D, typename, typename>
@@ -51,9 +58,14 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
-    if( A.RedundantRank() == 0 )
-        MakeGaussian( A.Matrix(), mean, stddev );
-    Broadcast( A, A.RedundantComm(), 0 );
+    counter_fill::FillOr
+    ( A, counter_fill::NormalSampler<F>{mean,stddev},
+      [&]()
+      {
+          if( A.RedundantRank() == 0 )
+              MakeGaussian( A.Matrix(), mean, stddev );
+          Broadcast( A, A.RedundantComm(), 0 );
+      } );
 }
 
 template<typename F>
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterFill.hpp"
+
 namespace El {
 
 template <typename T>
@@ -29,14 +31,19 @@ void ThreeValued( Matrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
-    auto tripleCoin = [=]() -> T
-    {
-        const double alpha = SampleUniform<double>(0,1);
-        if( alpha <= p/2 ) return T(-1);
-        else if( alpha <= p ) return T(1);
-        else return T(0);
-    };
-    EntrywiseFill( A, function<T()>(tripleCoin) );
+    counter_fill::FillOr
+    ( A, counter_fill::ThreeValuedSampler<T>{p},
+      [&]()
+      {
+          auto tripleCoin = [=]() -> T
+          {
+              const double alpha = SampleUniform<double>(0,1);
+              if( alpha <= p/2 ) return T(-1);
+              else if( alpha <= p ) return T(1);
+              else return T(0);
+          };
+          EntrywiseFill( A, function<T()>(tripleCoin) );
+      } );
 }
 
 template<typename T>
@@ -44,9 +51,14 @@ void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
-    if( A.RedundantRank() == 0 )
-        ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
-    Broadcast( A, A.RedundantComm(), 0 );
+    counter_fill::FillOr
+    ( A, counter_fill::ThreeValuedSampler<T>{p},
+      [&]()
+      {
+          if( A.RedundantRank() == 0 )
+              ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
+          Broadcast( A, A.RedundantComm(), 0 );
+      } );
 }
 
 #define PROTO(T) \
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./CounterFill.hpp"
+
 namespace El {
 
 // Draw each entry from a uniform PDF over a closed ball.
@@ -37,8 +39,13 @@ template<typename T, Device D>
 void MakeUniform( Matrix<T,D>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
-    auto sampleBall = [=]() { return SampleBall(center,radius); };
-    EntrywiseFill( A, function<T()>(sampleBall) );
+    counter_fill::FillOr
+    ( A, counter_fill::UniformSampler<T>{center,radius},
+      [&]()
+      {
+          auto sampleBall = [=]() { return SampleBall(center,radius); };
+          EntrywiseFill( A, function<T()>(sampleBall) );
+      } );
 }
 
 template<typename T>
@@ -53,9 +60,14 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
-    if( A.RedundantRank() == 0 )
-        MakeUniform( A.Matrix(), center, radius );
-    Broadcast( A, A.RedundantComm(), 0 );
+    counter_fill::FillOr
+    ( A, counter_fill::UniformSampler<T>{center,radius},
+      [&]()
+      {
+          if( A.RedundantRank() == 0 )
+              MakeUniform( A.Matrix(), center, radius );
+          Broadcast( A, A.RedundantComm(), 0 );
+      } );
 }
 
 template<typename T>
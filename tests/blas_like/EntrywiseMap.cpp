@@ -92,6 +92,107 @@ void TestEntrywiseMap
     PopIndent();
 }
 
+template<typename T>
+void TestFusedEntrywiseMap( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing fused map with ",TypeName<T>());
+    PushIndent();
+
+    // B is redistributed to match A and C within the map
+    DistMatrix<T> A(g), C(g);
+    DistMatrix<T,VC,STAR> B(g);
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    EntrywiseMap( A, B, C, []( const T& alpha, const T& beta )
+                           { return alpha + T(2)*beta; } );
+
+    DistMatrix<T> D( A );
+    Axpy( T(2), B, D );
+    Axpy( T(-1), C, D );
+    const Base<T> error = FrobeniusNorm( D );
+    OutputFromRoot(g.Comm(),"|| C - (A + 2 B) ||_F = ",error);
+    if( error > m*n*limits::Epsilon<Base<T>>() )
+        LogicError("Fused EntrywiseMap was incorrect");
+
+    PopIndent();
+}
+
+// A callable which opts into being applied to GPU matrices by a kernel.
+// Host matrices must still be mapped on the host.
+template<typename T>
+struct AffineMap
+{
+    T alpha, beta;
+    T operator()( const T& x ) const { return alpha*x + beta; }
+};
+
+namespace El {
+template<typename T>
+struct IsDeviceMappable<AffineMap<T>> : std::true_type {};
+} // namespace El
+
+static_assert
+( !IsDeviceMappable<std::function<double(const double&)>>::value,
+  "std::function cannot be applied on the device" );
+static_assert
+( IsDeviceMappable<AffineMap<double>>::value,
+  "AffineMap opts into device maps" );
+
+template<typename T>
+void TestDeviceMappableOnHost( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing a device-mappable callable on the host with ",
+     TypeName<T>());
+    PushIndent();
+
+    const AffineMap<T> map{ T(3), T(-1) };
+    auto entry = []( Int i, Int j ) { return T(i) - T(2)*T(j); };
+
+    // A non-contiguous view of a sequential matrix
+    Matrix<T> A( m+3, n );
+    IndexDependentFill( A, entry );
+    auto AView = A( IR(1,m+1), ALL );
+    EntrywiseMap( AView, map );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m+3; ++i )
+        {
+            const T expected =
+              ( i >= 1 && i < m+1 ? map(entry(i,j)) : entry(i,j) );
+            if( A(i,j) != expected )
+                LogicError
+                ("Sequential map of entry (",i,",",j,") was ",A(i,j),
+                 " instead of ",expected);
+        }
+
+    // In place, between aligned matrices, and with a redistribution
+    DistMatrix<T> B(g), C(g);
+    DistMatrix<T,VC,STAR> D(g);
+    B.Resize( m, n );
+    IndexDependentFill( B, entry );
+    EntrywiseMap( B, C, map );
+    EntrywiseMap( B, D, map );
+    EntrywiseMap( B, map );
+
+    Int numWrong = 0;
+    DistMatrix<T,STAR,STAR> B_STAR_STAR( B ), C_STAR_STAR( C ),
+                            D_STAR_STAR( D );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            const T expected = map(entry(i,j));
+            if( B_STAR_STAR.GetLocal(i,j) != expected ||
+                C_STAR_STAR.GetLocal(i,j) != expected ||
+                D_STAR_STAR.GetLocal(i,j) != expected )
+                ++numWrong;
+        }
+    numWrong = mpi::AllReduce( numWrong, g.Comm(), SyncInfo<Device::CPU>{} );
+    if( numWrong != 0 )
+        LogicError("Distributed maps had ",numWrong," wrong entries");
+
+    PopIndent();
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -167,8 +268,16 @@ main( int argc, char* argv[] )
         TestEntrywiseMap<Complex<float>>( m, n, funcComplexFloat, numThreads, g, print );
         TestEntrywiseMap<double>( m, n, funcDouble, numThreads, g, print );
         TestEntrywiseMap<Complex<double>>( m, n, funcComplexDouble, numThreads, g, print );
+        TestFusedEntrywiseMap<float>( m, n, g );
+        TestFusedEntrywiseMap<Complex<double>>( m, n, g );
+        TestDeviceMappableOnHost<float>( m, n, g );
+        TestDeviceMappableOnHost<Complex<double>>( m, n, g );
+    }
+    catch( exception& e )
+    {
+        ReportException(e);
+        return 1;
     }
-    catch( exception& e ) { ReportException(e); }
 
     return 0;
 }
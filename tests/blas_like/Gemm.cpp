@@ -82,6 +82,7 @@ void TestGemm
  T alpha, T beta,
  const Grid& g,
  bool print, bool correctness,
+ Int numLayers,
  Int colAlignA=0, Int rowAlignA=0,
  Int colAlignB=0, Int rowAlignB=0,
  Int colAlignC=0, Int rowAlignC=0)
@@ -196,6 +197,86 @@ void TestGemm
             (orientA, orientB, alpha, A, B, beta, COrig, C, print);
     PopIndent();
 
+    // Test the variant of Gemm that keeps C stationary and overlaps the
+    // panel gathers with the local updates
+    C = COrig;
+    OutputFromRoot(g.Comm(),"Pipelined Stationary C Algorithm:");
+    PushIndent();
+    mpi::Barrier(g.Comm());
+    timer.Start();
+    START_CUDA_TIMER;
+    Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_C_PIPELINED);
+    STOP_CUDA_TIMER;
+
+    mpi::Barrier(g.Comm());
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+    if (D == Device::CPU)
+        OutputFromRoot
+            (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    SUMMARIZE_CUDA_TIMER;
+    if (print)
+        Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+    if (correctness)
+        TestAssociativity
+            (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+    PopIndent();
+
+    // Test the autotuned selection; the second call reuses the table entry
+    // recorded by the first
+    for (Int trial=0; trial<2; ++trial)
+    {
+        C = COrig;
+        OutputFromRoot
+            (g.Comm(),"Tuned algorithm (",trial==0 ? "tuning" : "cached","):");
+        PushIndent();
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        START_CUDA_TIMER;
+        Gemm(orientA, orientB, alpha, A, B, beta, C, GEMM_AUTO);
+        STOP_CUDA_TIMER;
+
+        mpi::Barrier(g.Comm());
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+        if (D == Device::CPU)
+            OutputFromRoot
+                (g.Comm(),"Finished in ",runTime," seconds (",gFlops,
+                 " GFlop/s)");
+        SUMMARIZE_CUDA_TIMER;
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+    }
+
+    // Test the 2.5D variant when the grid can be split into layers
+    if (D == Device::CPU && numLayers > 1 && g.Size() % numLayers == 0)
+    {
+        C = COrig;
+        OutputFromRoot(g.Comm(),"2.5D algorithm with ",numLayers," layers:");
+        PushIndent();
+        mpi::Barrier(g.Comm());
+        timer.Start();
+        Gemm25D(orientA, orientB, alpha, A, B, beta, C, numLayers);
+        mpi::Barrier(g.Comm());
+        runTime = timer.Stop();
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = (IsComplex<T>::value ? 4*realGFlops : realGFlops);
+        OutputFromRoot
+            (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if (print)
+            Print(C, BuildString("C := ",alpha," A B + ",beta," C"));
+        if (correctness)
+            TestAssociativity
+                (orientA, orientB, alpha, A, B, beta, COrig, C, print);
+        PopIndent();
+    }
+
     if (orientA == NORMAL && orientB == NORMAL)
     {
         // Test the variant of Gemm for panel-panel dot products
@@ -248,6 +329,7 @@ main(int argc, char* argv[])
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int numLayers = Input("--numLayers","layers for 2.5D Gemm",2);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -283,6 +365,7 @@ main(int argc, char* argv[])
                  gpu_half_type(3.f), gpu_half_type(4.f),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -293,6 +376,7 @@ main(int argc, char* argv[])
                  float(3), float(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -302,6 +386,7 @@ main(int argc, char* argv[])
                  double(3), double(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -317,6 +402,7 @@ main(int argc, char* argv[])
                  float(3), float(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -326,6 +412,7 @@ main(int argc, char* argv[])
                  Complex<float>(3), Complex<float>(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -336,6 +423,7 @@ main(int argc, char* argv[])
                  double(3), double(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -345,6 +433,7 @@ main(int argc, char* argv[])
                  Complex<double>(3), Complex<double>(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -356,6 +445,7 @@ main(int argc, char* argv[])
                  DoubleDouble(3), DoubleDouble(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -365,6 +455,7 @@ main(int argc, char* argv[])
                  QuadDouble(3), QuadDouble(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -375,6 +466,7 @@ main(int argc, char* argv[])
                  Complex<DoubleDouble>(3), Complex<DoubleDouble>(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -384,6 +476,7 @@ main(int argc, char* argv[])
                  Complex<QuadDouble>(3), Complex<QuadDouble>(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -396,6 +489,7 @@ main(int argc, char* argv[])
                  cpu_half_type(3), cpu_half_type(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -408,6 +502,7 @@ main(int argc, char* argv[])
                  Quad(3), Quad(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -417,6 +512,7 @@ main(int argc, char* argv[])
                  Complex<Quad>(3), Complex<Quad>(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -429,6 +525,7 @@ main(int argc, char* argv[])
                  BigFloat(3), BigFloat(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
@@ -438,6 +535,7 @@ main(int argc, char* argv[])
                  Complex<BigFloat>(3), Complex<BigFloat>(4),
                  g,
                  print, correctness,
+                 numLayers,
                  colAlignA, rowAlignA,
                  colAlignB, rowAlignB,
                  colAlignC, rowAlignC);
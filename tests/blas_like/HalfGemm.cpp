@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef HYDROGEN_HAVE_HALF
+
+// The entries are small integers, so the products and their sums are exact
+// in single precision. Since half-precision Gemm and Gemv accumulate in
+// single precision and round once, each result must be exactly the rounding
+// of the exact result, even once the sums no longer fit in half precision.
+
+Int TestEntry( Int i, Int j, Int seed )
+{ return ((i+1)*5 + (j+1)*3 + seed) % 11 - 5; }
+
+void FillMatrix( Matrix<cpu_half_type>& A, Int m, Int n, Int seed )
+{
+    A.Resize( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            A(i,j) = cpu_half_type(float(TestEntry(i,j,seed)));
+}
+
+float Op( const Matrix<cpu_half_type>& A, char trans, Int i, Int j )
+{ return float( trans == 'N' ? A(i,j) : A(j,i) ); }
+
+void TestSequentialGemm( Int m, Int n, Int k )
+{
+    const cpu_half_type alpha(2.f), beta(-3.f);
+    const char transes[2] = { 'N', 'T' };
+    for( const char transA : transes )
+    {
+        for( const char transB : transes )
+        {
+            Matrix<cpu_half_type> A, B, C;
+            if( transA == 'N' ) FillMatrix( A, m, k, 1 );
+            else                FillMatrix( A, k, m, 1 );
+            if( transB == 'N' ) FillMatrix( B, k, n, 2 );
+            else                FillMatrix( B, n, k, 2 );
+            FillMatrix( C, m, n, 3 );
+
+            Matrix<float> CRef( m, n );
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<m; ++i )
+                {
+                    float sum = 0;
+                    for( Int l=0; l<k; ++l )
+                        sum += Op(A,transA,i,l)*Op(B,transB,l,j);
+                    CRef(i,j) = 2.f*sum - 3.f*float(C(i,j));
+                }
+
+            blas::Gemm
+            ( transA, transB, m, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.LockedBuffer(), B.LDim(),
+              beta,  C.Buffer(),       C.LDim() );
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<m; ++i )
+                    if( float(C(i,j)) != float(cpu_half_type(CRef(i,j))) )
+                        LogicError
+                        ("Half Gemm ",transA,transB,": entry (",i,",",j,
+                         ") was ",float(C(i,j))," instead of ",
+                         float(cpu_half_type(CRef(i,j))));
+        }
+    }
+}
+
+void TestSequentialGemv( Int m, Int n )
+{
+    const cpu_half_type alpha(-2.f), beta(3.f);
+    const char transes[2] = { 'N', 'T' };
+    for( const char trans : transes )
+    {
+        const Int xLength = ( trans == 'N' ? n : m );
+        const Int yLength = ( trans == 'N' ? m : n );
+        Matrix<cpu_half_type> A, x, y;
+        FillMatrix( A, m, n, 4 );
+        FillMatrix( x, xLength, 1, 5 );
+        FillMatrix( y, yLength, 1, 6 );
+
+        Matrix<float> yRef( yLength, 1 );
+        for( Int i=0; i<yLength; ++i )
+        {
+            float sum = 0;
+            for( Int l=0; l<xLength; ++l )
+                sum += Op(A,trans,i,l)*float(x(l,0));
+            yRef(i,0) = -2.f*sum + 3.f*float(y(i,0));
+        }
+
+        blas::Gemv
+        ( trans, m, n,
+          alpha, A.LockedBuffer(), A.LDim(), x.LockedBuffer(), 1,
+          beta,  y.Buffer(), 1 );
+        for( Int i=0; i<yLength; ++i )
+            if( float(y(i,0)) != float(cpu_half_type(yRef(i,0))) )
+                LogicError
+                ("Half Gemv ",trans,": entry ",i," was ",float(y(i,0)),
+                 " instead of ",float(cpu_half_type(yRef(i,0))));
+    }
+}
+
+// The distributed algorithms add the local products of several panels (and
+// processes) in half precision, so only a rounding error per panel and per
+// process is allowed
+void TestDistributedGemm( Int m, Int n, Int k, const Grid& g )
+{
+    DistMatrix<cpu_half_type> A(g), B(g), C(g);
+    A.Resize( m, k );
+    B.Resize( k, n );
+    C.Resize( m, n );
+    IndexDependentFill
+    ( A, []( Int i, Int j ) { return cpu_half_type(float(TestEntry(i,j,7))); } );
+    IndexDependentFill
+    ( B, []( Int i, Int j ) { return cpu_half_type(float(TestEntry(i,j,8))); } );
+    Zero( C );
+    Gemm
+    ( NORMAL, NORMAL, cpu_half_type(1.f), A, B, cpu_half_type(0.f), C );
+
+    DistMatrix<cpu_half_type,STAR,STAR> A_STAR_STAR(A), B_STAR_STAR(B),
+                                        C_STAR_STAR(C);
+    const Int numPanels = (k+Blocksize()-1)/Blocksize();
+    const float unitRoundoff = 1.f/2048;
+    Int numWrong = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            float sum = 0, absSum = 0;
+            for( Int l=0; l<k; ++l )
+            {
+                const float product = float(A_STAR_STAR.GetLocal(i,l))*
+                                      float(B_STAR_STAR.GetLocal(l,j));
+                sum += product;
+                absSum += Abs(product);
+            }
+            const float error = Abs(float(C_STAR_STAR.GetLocal(i,j))-sum);
+            if( error > (numPanels+g.Size())*unitRoundoff*absSum )
+                ++numWrong;
+        }
+    numWrong = mpi::AllReduce( numWrong, g.Comm(), SyncInfo<Device::CPU>{} );
+    if( numWrong != 0 )
+        LogicError("Distributed half Gemm had ",numWrong," inaccurate entries");
+}
+
+#endif // HYDROGEN_HAVE_HALF
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--m","height of C",70);
+        const Int n = Input("--n","width of C",67);
+        const Int k = Input("--k","inner dimension",300);
+        const Int nb = Input("--nb","algorithmic blocksize",64);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        const Grid g( std::move(comm) );
+#ifdef HYDROGEN_HAVE_HALF
+        OutputFromRoot(g.Comm(),"Testing half-precision Gemm and Gemv");
+        TestSequentialGemm( m, n, k );
+        TestSequentialGemv( m, k );
+        OutputFromRoot(g.Comm(),"Testing distributed half-precision Gemm");
+        TestDistributedGemm( m, n, k, g );
+#else
+        (void) m;
+        (void) n;
+        (void) k;
+        OutputFromRoot(g.Comm(),"Half precision is not enabled; skipping");
+#endif // HYDROGEN_HAVE_HALF
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
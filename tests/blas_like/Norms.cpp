@@ -0,0 +1,339 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The blocked norm kernels scale each block by its largest entry, so the
+// Frobenius, entrywise, and row two-norms must neither overflow nor
+// underflow on extreme entries, must propagate NaN and infinite entries,
+// and must not depend on the number of threads splitting the work.
+
+template<typename Real>
+void CheckClose
+( Real value, long double expected, Real tol, const string& msg )
+{
+    const long double error = std::abs( (long double)(value) - expected );
+    if( error > tol*std::abs(expected) )
+        LogicError
+        (msg,": computed ",value," but expected ",double(expected));
+}
+
+template<typename T>
+long double ReferenceNorm( const Matrix<T>& A, Base<T> p )
+{
+    long double sum = 0;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            sum += std::pow( (long double)(Abs(A(i,j))), (long double)(p) );
+    return std::pow( sum, 1.L/p );
+}
+
+template<typename T>
+void TestScaling( Int m, Int n, const Grid& g )
+{
+    typedef Base<T> Real;
+    const Real tol = 100*m*n*limits::Epsilon<Real>();
+    // The squares of the large entries overflow, and the small entries are
+    // subnormal, while the norms themselves remain representable
+    const Real extremes[2] =
+      { limits::Max<Real>()/Real(8*m*n), limits::SafeMin<Real>()/4 };
+    for( const Real extreme : extremes )
+    {
+        // The reference accumulates the entries divided by 'extreme'
+        Matrix<T> A( m, n );
+        IndexDependentFill
+        ( A, [=]( Int i, Int j ) { return T(extreme*((i+2*j)%5+1)); } );
+        Matrix<T> AUnit( m, n );
+        IndexDependentFill
+        ( AUnit, []( Int i, Int j ) { return T((i+2*j)%5+1); } );
+        const long double twoNorm = ReferenceNorm( AUnit, Real(2) );
+        const long double oneNorm = ReferenceNorm( AUnit, Real(1) );
+
+        const string desc =
+          BuildString(TypeName<T>()," entries near ",extreme);
+        CheckClose
+        ( FrobeniusNorm(A)/extreme, twoNorm, tol,
+          "Sequential Frobenius norm of "+desc );
+        CheckClose
+        ( EntrywiseNorm(A,Real(1))/extreme, oneNorm, tol,
+          "Sequential entrywise one-norm of "+desc );
+
+        DistMatrix<T> ADist(g);
+        ADist.Resize( m, n );
+        IndexDependentFill
+        ( ADist, [=]( Int i, Int j ) { return T(extreme*((i+2*j)%5+1)); } );
+        CheckClose
+        ( FrobeniusNorm(ADist)/extreme, twoNorm, tol,
+          "Distributed Frobenius norm of "+desc );
+        CheckClose
+        ( EntrywiseNorm(ADist,Real(1))/extreme, oneNorm, tol,
+          "Distributed entrywise one-norm of "+desc );
+    }
+}
+
+template<typename T>
+void TestNonFinite( Int m, Int n, const Grid& g )
+{
+    typedef Base<T> Real;
+    const Real inf = limits::Infinity<Real>();
+    const Real nan = std::numeric_limits<Real>::quiet_NaN();
+
+    // Infinite entries in different blocks (and on different processes)
+    // must combine to an infinite norm rather than NaN
+    Matrix<T> A;
+    Ones( A, m, n );
+    A(0,0) = T(inf);
+    A(m-1,n-1) = T(-inf);
+    if( FrobeniusNorm(A) != inf )
+        LogicError("Sequential Frobenius norm with Inf was not Inf");
+    if( EntrywiseNorm(A,Real(3)) != inf )
+        LogicError("Sequential entrywise norm with Inf was not Inf");
+    DistMatrix<T> ADist(g);
+    Ones( ADist, m, n );
+    ADist.Set( 0, 0, T(inf) );
+    ADist.Set( m-1, n-1, T(-inf) );
+    if( FrobeniusNorm(ADist) != inf )
+        LogicError("Distributed Frobenius norm with Inf was not Inf");
+    if( EntrywiseNorm(ADist,Real(3)) != inf )
+        LogicError("Distributed entrywise norm with Inf was not Inf");
+    DistMatrix<Real,MC,STAR> rowNormsDist(g);
+    RowTwoNorms( ADist, rowNormsDist );
+    if( rowNormsDist.Get(0,0) != inf || rowNormsDist.Get(m-1,0) != inf )
+        LogicError("Distributed row two-norms with Inf were not Inf");
+
+    // A NaN entry, even next to an infinite one, must give NaN
+    A(m/2,n/2) = T(nan);
+    if( !std::isnan(FrobeniusNorm(A)) )
+        LogicError("Sequential Frobenius norm with NaN was not NaN");
+    if( !std::isnan(EntrywiseNorm(A,Real(3))) )
+        LogicError("Sequential entrywise norm with NaN was not NaN");
+    ADist.Set( m/2, n/2, T(nan) );
+    if( !std::isnan(FrobeniusNorm(ADist)) )
+        LogicError("Distributed Frobenius norm with NaN was not NaN");
+    if( !std::isnan(EntrywiseNorm(ADist,Real(3))) )
+        LogicError("Distributed entrywise norm with NaN was not NaN");
+
+    Matrix<Real> rowNorms;
+    RowTwoNorms( A, rowNorms );
+    if( rowNorms(0,0) != inf || !std::isnan(rowNorms(m/2,0)) )
+        LogicError("Row two-norms did not propagate Inf and NaN");
+    for( Int i=1; i<m-1; ++i )
+        if( i != m/2 && rowNorms(i,0) != Sqrt(Real(n)) )
+            LogicError("Row two-norm ",i," of ones was ",rowNorms(i,0));
+}
+
+template<typename T>
+void TestEntrywise( Int m, Int n, const Grid& g )
+{
+    typedef Base<T> Real;
+    const Real tol = 100*m*n*limits::Epsilon<Real>();
+    Matrix<T> A;
+    Uniform( A, m, n );
+    DistMatrix<T> ADist(g);
+    Uniform( ADist, m, n );
+    DistMatrix<T,STAR,STAR> ADist_STAR_STAR( ADist );
+    const Real ps[3] = { Real(1), Real(2), Real(3) };
+    for( const Real p : ps )
+    {
+        CheckClose
+        ( EntrywiseNorm(A,p), ReferenceNorm(A,p), tol,
+          BuildString("Sequential ",TypeName<T>()," entrywise ",p,"-norm") );
+        CheckClose
+        ( EntrywiseNorm(ADist,p),
+          ReferenceNorm(ADist_STAR_STAR.LockedMatrix(),p), tol,
+          BuildString("Distributed ",TypeName<T>()," entrywise ",p,"-norm") );
+    }
+}
+
+template<typename T>
+void TestRowTwoNorms( Int m, Int n, const Grid& g )
+{
+    typedef Base<T> Real;
+    const Real tol = 100*n*limits::Epsilon<Real>();
+
+    // A view with a padded leading dimension takes the strided path
+    Matrix<T> AData, A;
+    Uniform( AData, m+3, n );
+    View( A, AData, IR(0,m), ALL );
+    Matrix<Real> norms;
+    RowTwoNorms( A, norms );
+    for( Int i=0; i<m; ++i )
+    {
+        long double sum = 0;
+        for( Int j=0; j<n; ++j )
+            sum += std::pow( (long double)(Abs(A(i,j))), 2.L );
+        CheckClose
+        ( norms(i,0), std::sqrt(sum), tol,
+          BuildString("Sequential row two-norm ",i) );
+    }
+
+    DistMatrix<T> ADist(g);
+    Uniform( ADist, m, n );
+    DistMatrix<Real,MC,STAR> normsDist(g);
+    RowTwoNorms( ADist, normsDist );
+    DistMatrix<T,STAR,STAR> ADist_STAR_STAR( ADist );
+    DistMatrix<Real,STAR,STAR> normsDist_STAR_STAR( normsDist );
+    for( Int i=0; i<m; ++i )
+    {
+        long double sum = 0;
+        for( Int j=0; j<n; ++j )
+            sum += std::pow
+              ( (long double)(Abs(ADist_STAR_STAR.GetLocal(i,j))), 2.L );
+        CheckClose
+        ( normsDist_STAR_STAR.GetLocal(i,0), std::sqrt(sum), tol,
+          BuildString("Distributed row two-norm ",i) );
+    }
+}
+
+// The batched norms must agree with the norms of the individual matrices,
+// whatever their distributions
+template<typename T>
+void TestBatchedNorms( Int m, Int n, const Grid& g )
+{
+    typedef Base<T> Real;
+    const Real tol = 100*m*n*limits::Epsilon<Real>();
+    DistMatrix<T> A(g);
+    DistMatrix<T,STAR,STAR> B(g);
+    DistMatrix<T,VC,STAR> C(g);
+    DistMatrix<T,CIRC,CIRC> D(g,g.Size()-1);
+    DistMatrix<T> E(g);
+    Uniform( A, m, n );
+    Uniform( B, n, m );
+    Uniform( C, m/2, n );
+    Uniform( D, m, 3 );
+    E.Resize( 0, n );
+    const vector<const AbstractDistMatrix<T>*> matrices =
+      { &A, &B, &C, &D, &E };
+
+    // The nonblocking reduction is overlapped with blocking ones, which
+    // replace the shared user-defined reduction operation
+    auto request = FrobeniusNormsAsync( matrices );
+    const vector<Real> frobNorms = FrobeniusNorms( matrices );
+    const vector<Real> oneNorms = EntrywiseNorms( matrices, Real(1) );
+    const vector<Real> threeNorms = EntrywiseNorms( matrices, Real(3) );
+    const vector<Real> asyncNorms = request.Wait();
+    if( request.Active() )
+        LogicError("FrobeniusNormsAsync was still active after Wait");
+
+    if( frobNorms.size() != matrices.size() ||
+        asyncNorms.size() != matrices.size() )
+        LogicError("Batched norms returned the wrong number of norms");
+    for( size_t k=0; k<matrices.size(); ++k )
+    {
+        const auto& M = *matrices[k];
+        const string desc = BuildString(TypeName<T>()," matrix ",k);
+        CheckClose
+        ( frobNorms[k], FrobeniusNorm(M), tol,
+          "Batched Frobenius norm of "+desc );
+        CheckClose
+        ( asyncNorms[k], FrobeniusNorm(M), tol,
+          "Nonblocking Frobenius norm of "+desc );
+        CheckClose
+        ( oneNorms[k], EntrywiseNorm(M,Real(1)), tol,
+          "Batched entrywise one-norm of "+desc );
+        CheckClose
+        ( threeNorms[k], EntrywiseNorm(M,Real(3)), tol,
+          "Batched entrywise three-norm of "+desc );
+    }
+    if( frobNorms[4] != Real(0) || asyncNorms[4] != Real(0) )
+        LogicError("The norm of an empty matrix was not zero");
+
+    // Overflow is avoided as in the individual norms
+    Ones( B, n, m );
+    Scale( limits::Max<Real>()/Real(4*m*n), B );
+    const vector<const AbstractDistMatrix<T>*> scaled = { &B, &A };
+    auto scaledRequest = FrobeniusNormsAsync( scaled );
+    CheckClose
+    ( scaledRequest.Wait()[0], FrobeniusNorm(B), tol,
+      "Nonblocking Frobenius norm of large "+TypeName<T>()+" entries" );
+
+    if( !FrobeniusNormsAsync( vector<const AbstractDistMatrix<T>*>() )
+        .Wait().empty() )
+        LogicError("The norms of no matrices were not empty");
+}
+
+// The pieces that the threads reduce are fixed by the matrix size, not by
+// the number of threads, so the results must agree bit for bit
+template<typename T>
+void TestThreadDeterminism( Int m, Int n )
+{
+#ifdef _OPENMP
+    typedef Base<T> Real;
+    const int maxThreads = omp_get_max_threads();
+    Matrix<T> A;
+    Uniform( A, m, n );
+
+    omp_set_num_threads( 1 );
+    const Real frob = FrobeniusNorm( A );
+    const Real entry = EntrywiseNorm( A, Real(3) );
+    Matrix<Real> rowNorms;
+    RowTwoNorms( A, rowNorms );
+
+    omp_set_num_threads( Max(maxThreads,4) );
+    const Real frobThreaded = FrobeniusNorm( A );
+    const Real entryThreaded = EntrywiseNorm( A, Real(3) );
+    Matrix<Real> rowNormsThreaded;
+    RowTwoNorms( A, rowNormsThreaded );
+    omp_set_num_threads( maxThreads );
+
+    if( frob != frobThreaded )
+        LogicError
+        ("Frobenius norm changed from ",frob," to ",frobThreaded,
+         " with more threads");
+    if( entry != entryThreaded )
+        LogicError
+        ("Entrywise norm changed from ",entry," to ",entryThreaded,
+         " with more threads");
+    for( Int i=0; i<m; ++i )
+        if( rowNorms(i,0) != rowNormsThreaded(i,0) )
+            LogicError("Row two-norm ",i," changed with more threads");
+#else
+    (void) m;
+    (void) n;
+#endif // _OPENMP
+}
+
+template<typename T>
+void TestNorms( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing norms with ",TypeName<T>());
+    TestScaling<T>( m, n, g );
+    TestNonFinite<T>( m, n, g );
+    TestEntrywise<T>( m, n, g );
+    TestRowTwoNorms<T>( m, n, g );
+    TestBatchedNorms<T>( m, n, g );
+    TestThreadDeterminism<T>( 8*m, 4*n );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--m","height of A",300);
+        const Int n = Input("--n","width of A",37);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+        TestNorms<float>( m, n, g );
+        TestNorms<double>( m, n, g );
+        TestNorms<Complex<double>>( m, n, g );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
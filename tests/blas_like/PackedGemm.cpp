@@ -0,0 +1,230 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The packed engine behind the templated BLAS fallbacks is exercised with
+// integer matrices, whose products are exact, so the results must match a
+// naive triple loop entry for entry. The dimensions straddle the engine's
+// register and cache blocksizes.
+
+Int TestEntry( Int i, Int j, Int seed )
+{ return ((i+1)*7 + (j+1)*3 + seed) % 11 - 5; }
+
+void FillMatrix( Matrix<Int>& A, Int m, Int n, Int seed )
+{
+    A.Resize( m, n );
+    IndexDependentFill( A, [=]( Int i, Int j ) { return TestEntry(i,j,seed); } );
+}
+
+Int Op( const Matrix<Int>& A, char trans, Int i, Int j )
+{ return ( trans == 'N' ? A(i,j) : A(j,i) ); }
+
+void CheckEqual
+( const Matrix<Int>& C, const Matrix<Int>& CRef, const string& msg )
+{
+    for( Int j=0; j<C.Width(); ++j )
+        for( Int i=0; i<C.Height(); ++i )
+            if( C(i,j) != CRef(i,j) )
+                LogicError
+                (msg,": entry (",i,",",j,") was ",C(i,j),
+                 " instead of ",CRef(i,j));
+}
+
+void TestSequentialGemm( Int m, Int n, Int k )
+{
+    const Int alpha = 2, beta = -3;
+    const char transes[2] = { 'N', 'T' };
+    for( const char transA : transes )
+    {
+        for( const char transB : transes )
+        {
+            Matrix<Int> A, B, C, CRef;
+            if( transA == 'N' ) FillMatrix( A, m, k, 1 );
+            else                FillMatrix( A, k, m, 1 );
+            if( transB == 'N' ) FillMatrix( B, k, n, 2 );
+            else                FillMatrix( B, n, k, 2 );
+            FillMatrix( C, m, n, 3 );
+
+            CRef = C;
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<m; ++i )
+                {
+                    Int sum = 0;
+                    for( Int l=0; l<k; ++l )
+                        sum += Op(A,transA,i,l)*Op(B,transB,l,j);
+                    CRef(i,j) = alpha*sum + beta*CRef(i,j);
+                }
+
+            blas::Gemm
+            ( transA, transB, m, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.LockedBuffer(), B.LDim(),
+              beta,  C.Buffer(),       C.LDim() );
+            CheckEqual( C, CRef, BuildString("Gemm ",transA,transB) );
+        }
+    }
+}
+
+void TestSequentialSyrk( Int n, Int k )
+{
+    const Int alpha = 3, beta = 2;
+    const char uplos[2] = { 'L', 'U' };
+    const char transes[2] = { 'N', 'T' };
+    for( const char uplo : uplos )
+    {
+        for( const char trans : transes )
+        {
+            Matrix<Int> A, C, CRef;
+            if( trans == 'N' ) FillMatrix( A, n, k, 4 );
+            else               FillMatrix( A, k, n, 4 );
+            FillMatrix( C, n, n, 5 );
+
+            // Only the referenced triangle is updated
+            CRef = C;
+            for( Int j=0; j<n; ++j )
+                for( Int i=0; i<n; ++i )
+                {
+                    if( (uplo == 'L' && i < j) || (uplo == 'U' && i > j) )
+                        continue;
+                    Int sum = 0;
+                    for( Int l=0; l<k; ++l )
+                        sum += Op(A,trans,i,l)*Op(A,trans,j,l);
+                    CRef(i,j) = alpha*sum + beta*CRef(i,j);
+                }
+
+            blas::Syrk
+            ( uplo, trans, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+              beta,  C.Buffer(),       C.LDim() );
+            CheckEqual( C, CRef, BuildString("Syrk ",uplo,trans) );
+        }
+    }
+}
+
+void TestSequentialTrmm( Int m, Int n )
+{
+    const Int alpha = -2;
+    const char sides[2] = { 'L', 'R' };
+    const char uplos[2] = { 'L', 'U' };
+    const char transes[2] = { 'N', 'T' };
+    const char units[2] = { 'N', 'U' };
+    for( const char side : sides )
+    for( const char uplo : uplos )
+    for( const char trans : transes )
+    for( const char unit : units )
+    {
+        const Int t = ( side == 'L' ? m : n );
+        Matrix<Int> T, TFull, B, BRef;
+        FillMatrix( T, t, t, 6 );
+        FillMatrix( B, m, n, 7 );
+
+        // Form the triangular operand explicitly for the reference
+        TFull = T;
+        for( Int j=0; j<t; ++j )
+            for( Int i=0; i<t; ++i )
+            {
+                if( (uplo == 'L' && i < j) || (uplo == 'U' && i > j) )
+                    TFull(i,j) = 0;
+                else if( i == j && unit == 'U' )
+                    TFull(i,j) = 1;
+            }
+
+        BRef.Resize( m, n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+            {
+                Int sum = 0;
+                if( side == 'L' )
+                    for( Int l=0; l<m; ++l )
+                        sum += Op(TFull,trans,i,l)*B(l,j);
+                else
+                    for( Int l=0; l<n; ++l )
+                        sum += B(i,l)*Op(TFull,trans,l,j);
+                BRef(i,j) = alpha*sum;
+            }
+
+        blas::Trmm
+        ( side, uplo, trans, unit, m, n,
+          alpha, T.LockedBuffer(), T.LDim(), B.Buffer(), B.LDim() );
+        CheckEqual( B, BRef, BuildString("Trmm ",side,uplo,trans,unit) );
+    }
+}
+
+// The local updates of the distributed Gemm also run through the engine
+void TestDistributedGemm( Int m, Int n, Int k, const Grid& g )
+{
+    const Int alpha = 2, beta = -1;
+    DistMatrix<Int> A(g), B(g), C(g);
+    A.Resize( m, k );
+    B.Resize( k, n );
+    C.Resize( m, n );
+    IndexDependentFill( A, []( Int i, Int j ) { return TestEntry(i,j,8); } );
+    IndexDependentFill( B, []( Int i, Int j ) { return TestEntry(i,j,9); } );
+    IndexDependentFill( C, []( Int i, Int j ) { return TestEntry(i,j,10); } );
+
+    DistMatrix<Int,STAR,STAR> A_STAR_STAR(A), B_STAR_STAR(B),
+                              C_STAR_STAR(C);
+    Gemm( NORMAL, NORMAL, alpha, A, B, beta, C );
+
+    Matrix<Int> CRef( C_STAR_STAR.Matrix() );
+    const Matrix<Int>& ALoc = A_STAR_STAR.LockedMatrix();
+    const Matrix<Int>& BLoc = B_STAR_STAR.LockedMatrix();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            Int sum = 0;
+            for( Int l=0; l<k; ++l )
+                sum += ALoc(i,l)*BLoc(l,j);
+            CRef(i,j) = alpha*sum + beta*CRef(i,j);
+        }
+
+    DistMatrix<Int,STAR,STAR> CResult( C );
+    Int numWrong = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( CResult.GetLocal(i,j) != CRef(i,j) )
+                ++numWrong;
+    numWrong = mpi::AllReduce( numWrong, g.Comm(), SyncInfo<Device::CPU>{} );
+    if( numWrong != 0 )
+        LogicError("Distributed integer Gemm had ",numWrong," wrong entries");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--m","height of C",70);
+        const Int n = Input("--n","width of C",67);
+        const Int k = Input("--k","inner dimension",131);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        const Grid g( std::move(comm) );
+        OutputFromRoot(g.Comm(),"Testing the packed integer kernels");
+        TestSequentialGemm( m, n, k );
+        TestSequentialSyrk( n, k );
+        TestSequentialTrmm( m, n );
+        OutputFromRoot(g.Comm(),"Testing distributed integer Gemm");
+        TestDistributedGemm( m, n, k, g );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -9,6 +9,29 @@
 #include <El.hpp>
 using namespace El;
 
+template<typename T>
+void FillWithIndices( AbstractDistMatrix<T>& A )
+{
+    const Int height = A.Height();
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            A.SetLocal
+            ( iLoc, jLoc, T(A.GlobalRow(iLoc)+height*A.GlobalCol(jLoc)) );
+}
+
+template<typename T>
+Int NumWrongIndices( const AbstractDistMatrix<T>& A, mpi::Comm const& comm )
+{
+    const Int height = A.Height();
+    Int numWrong = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) !=
+                T(A.GlobalRow(iLoc)+height*A.GlobalCol(jLoc)) )
+                ++numWrong;
+    return mpi::AllReduce( numWrong, comm, SyncInfo<Device::CPU>{} );
+}
+
 int
 main( int argc, char* argv[] )
 {
@@ -48,6 +71,40 @@ main( int argc, char* argv[] )
         A = AElem;
         if( print )
             Print( A, "A" );
+
+        // Redistribute between layouts with mismatched block sizes,
+        // alignments, and cuts
+        DistMatrix<double,MC,MR,BLOCK> B(g);
+        B.AlignAndResize
+        ( mb, nb, g.Height()-1, g.Width()-1, mb/3, nb/2, n, n+7 );
+        FillWithIndices( B );
+        DistMatrix<double,VC,STAR> BElem( B );
+        DistMatrix<double,MC,MR,BLOCK> BReblock(g);
+        BReblock.AlignAndResize( mb+5, nb+3, 0, 0, 1, 2, n, n+7 );
+        BReblock = BElem;
+        DistMatrix<double,STAR,VR,BLOCK> BStarVR( BReblock );
+
+        // Reuse a redistribution plan
+        DistMatrix<double,MC,MR,BLOCK> C(g);
+        C.AlignAndResize( mb, nb, 0, g.Width()-1, 0, nb/3, n, n+7 );
+        DistMatrix<double,STAR,VC> CStarVC(g);
+        RedistPlan<double> plan( C, CStarVC );
+        Int numWrongPlan = 0;
+        for( Int k=0; k<2; ++k )
+        {
+            Zeros( CStarVC, n, n+7 );
+            FillWithIndices( C );
+            plan.Execute( C, CStarVC );
+            numWrongPlan += NumWrongIndices( CStarVC, g.Comm() );
+        }
+
+        const Int numWrong =
+          NumWrongIndices( BElem, g.Comm() ) +
+          NumWrongIndices( BReblock, g.Comm() ) +
+          NumWrongIndices( BStarVR, g.Comm() ) + numWrongPlan;
+        if( numWrong != 0 )
+            LogicError(numWrong," entries were redistributed incorrectly");
+        OutputFromRoot(g.Comm(),"Block redistributions were correct");
 #ifdef EL_HAVE_SCALAPACK
         // NOTE: There appears to be a bug in the parallel eigenvalue
         //       reordering in ScaLAPACK's P{S,D}HSEQR (within P{S,D}TRORD).
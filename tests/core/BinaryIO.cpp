@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <cstdio>
+#include <El.hpp>
+using namespace El;
+
+// Round-trips distributed matrices through the BINARY and BINARY_FLAT
+// formats, which element-wise distributions read and write with collective
+// MPI-IO, and checks every entry against the index-dependent fill.
+
+double TestEntry( Int i, Int j )
+{ return double(i) + 1000.*double(j); }
+
+template<Dist U,Dist V>
+Int CountWrong( const DistMatrix<double,U,V>& A )
+{
+    Int numWrong = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) !=
+                TestEntry(A.GlobalRow(iLoc),A.GlobalCol(jLoc)) )
+                ++numWrong;
+    return mpi::AllReduce
+      ( numWrong, A.Grid().Comm(), SyncInfo<Device::CPU>{} );
+}
+
+template<Dist U,Dist V,Dist S,Dist T>
+void TestRoundTrip
+( Int m, Int n, FileFormat format, const string& basename, const Grid& g )
+{
+    const string filename = basename + "." + FileExtension(format);
+    DistMatrix<double,U,V> A(g);
+    // Pad the leading dimension so that the local columns are not contiguous
+    A.Resize( m, n );
+    A.Resize( m, n, Max(A.LocalHeight(),Int(1))+3 );
+    IndexDependentFill( A, []( Int i, Int j ) { return TestEntry(i,j); } );
+    Write( A, basename, format );
+    mpi::Barrier( g.Comm() );
+
+    DistMatrix<double,S,T> B(g);
+    B.Resize( m, n );
+    B.Resize( m, n, Max(B.LocalHeight(),Int(1))+5 );
+    Read( B, filename, format );
+    if( B.Height() != m || B.Width() != n )
+        LogicError
+        ("Read a ",B.Height()," x ",B.Width()," matrix instead of ",m," x ",n);
+    const Int numWrong = CountWrong( B );
+    if( numWrong != 0 )
+        LogicError
+        ("Round trip from [",DistToString(U),",",DistToString(V),"] to [",
+         DistToString(S),",",DistToString(T),"] in ",FileExtension(format),
+         " format had ",numWrong," wrong entries");
+
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+        std::remove( filename.c_str() );
+}
+
+template<Dist U,Dist V,Dist S,Dist T>
+void TestFormats( Int m, Int n, const string& basename, const Grid& g )
+{
+    TestRoundTrip<U,V,S,T>( m, n, BINARY, basename, g );
+    TestRoundTrip<U,V,S,T>( m, n, BINARY_FLAT, basename, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",29);
+        const string prefix =
+          Input("--prefix","prefix of the test files",string("BinaryIOTest"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+        // Runs on different numbers of processes may share a directory
+        const string basename = BuildString(prefix,"_np",g.Size());
+        OutputFromRoot(g.Comm(),"Testing BINARY and BINARY_FLAT round trips");
+        TestFormats<MC,MR,MC,MR>( m, n, basename, g );
+        TestFormats<MC,MR,VC,STAR>( m, n, basename, g );
+        TestFormats<VR,STAR,MR,MC>( m, n, basename, g );
+        TestFormats<STAR,STAR,MC,MR>( m, n, basename, g );
+        TestFormats<MC,MR,STAR,VR>( m, n, basename, g );
+        TestFormats<MD,STAR,MC,MR>( m, n, basename, g );
+        // Empty local matrices on some processes
+        TestFormats<MC,MR,VC,STAR>( 2, 1, basename, g );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <iomanip>
+using namespace El;
+
+// The collectives are called over a named communicator of their own, so
+// the counts of each process have closed forms in its rank
+
+const mpi::CommStats& FindStats
+( const vector<mpi::CommStats>& stats, Collective op, const string& comm )
+{
+    for( const auto& entry : stats )
+        if( entry.op == op && entry.comm == comm )
+            return entry;
+    LogicError("No statistics for ",mpi::CollectiveName(op)," over ",comm);
+    return stats.front();
+}
+
+void CheckStats
+( const mpi::CommStats& stats, long long calls,
+  size_t bytesSent, size_t bytesRecv )
+{
+    const string name = mpi::CollectiveName( stats.op );
+    if( stats.calls != calls )
+        LogicError(name," had ",stats.calls," calls instead of ",calls);
+    if( stats.bytesSent != bytesSent || stats.bytesRecv != bytesRecv )
+        LogicError
+        (name," sent ",stats.bytesSent," and received ",stats.bytesRecv,
+         " bytes instead of ",bytesSent," and ",bytesRecv);
+    long long histogramCalls = 0;
+    for( const auto& count : stats.sizeHistogram )
+        histogramCalls += count;
+    if( histogramCalls != calls )
+        LogicError(name," had ",histogramCalls," calls in its histogram");
+    if( stats.seconds < 0 )
+        LogicError(name," had a negative time");
+}
+
+void TestCounters( const mpi::Comm& comm )
+{
+    OutputFromRoot(comm,"Testing the communication counters");
+    const string name = "TestStats";
+    mpi::SetName( comm, name );
+    const int rank = mpi::Rank( comm );
+    const int size = mpi::Size( comm );
+    SyncInfo<Device::CPU> syncInfo;
+
+    mpi::SetCollectCommStats( true );
+    mpi::ResetCommStats();
+    vector<double> send(100, rank), recv(100*size);
+    mpi::AllReduce( send.data(), recv.data(), 3, mpi::SUM, comm, syncInfo );
+    mpi::AllReduce( send.data(), recv.data(), 3, mpi::SUM, comm, syncInfo );
+    mpi::AllReduce( send.data(), recv.data(), 0, mpi::SUM, comm, syncInfo );
+    mpi::Broadcast( send.data(), 100, 0, comm, syncInfo );
+    mpi::AllGather( send.data(), 2, recv.data(), 2, comm, syncInfo );
+
+    // Calls made while collection is off are not counted
+    mpi::SetCollectCommStats( false );
+    mpi::AllReduce( send.data(), recv.data(), 3, mpi::SUM, comm, syncInfo );
+    mpi::SetCollectCommStats( true );
+
+    const auto stats = mpi::GetCommStats();
+    const auto& allReduce = FindStats( stats, Collective::ALLREDUCE, name );
+    CheckStats( allReduce, 3, 48, 48 );
+    // The empty call is in bucket 0 and the others in [16,32) bytes
+    if( allReduce.sizeHistogram[0] != 1 || allReduce.sizeHistogram[5] != 2 )
+        LogicError("The AllReduce size histogram was wrong");
+    const size_t broadcastBytes = 100*sizeof(double);
+    CheckStats
+    ( FindStats( stats, Collective::BROADCAST, name ), 1,
+      rank == 0 ? broadcastBytes : 0, rank == 0 ? 0 : broadcastBytes );
+    CheckStats
+    ( FindStats( stats, Collective::ALLGATHER, name ), 1,
+      2*sizeof(double), 2*size*sizeof(double) );
+
+    // The report sums the calls over the processes
+    std::ostringstream report;
+    mpi::ReportCommStats( report );
+    if( rank == 0 )
+    {
+        std::ostringstream row;
+        row << std::left << std::setw(15) << "AllReduce" << std::setw(20)
+            << name << std::right << std::setw(10) << 3*size;
+        if( report.str().find( row.str() ) == string::npos )
+            LogicError("The report had no row \"",row.str(),"\"");
+    }
+    else if( !report.str().empty() )
+        LogicError("A process other than the root wrote the report");
+
+    mpi::ResetCommStats();
+    if( !mpi::GetCommStats().empty() )
+        LogicError("ResetCommStats kept statistics");
+    mpi::SetCollectCommStats( false );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        TestCounters( comm );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Grids over the same processes share their derived communicators, which
+// are freed with the last grid using them, unless caching is disabled
+
+bool SameComms( const Grid& g1, const Grid& g2 )
+{
+    return g1.VCComm().GetMPIComm() == g2.VCComm().GetMPIComm() &&
+           g1.MCComm().GetMPIComm() == g2.MCComm().GetMPIComm() &&
+           g1.MDComm().GetMPIComm() == g2.MDComm().GetMPIComm();
+}
+
+void CheckNumCached( size_t expected, const string& msg )
+{
+    if( Grid::NumCachedComms() != expected )
+        LogicError
+        (msg,": ",Grid::NumCachedComms(),
+         " cached communicator sets instead of ",expected);
+}
+
+// The communicators of a grid must remain usable once the grid which
+// created them is gone
+void CheckUsable( const Grid& g )
+{
+    const Int sum =
+      mpi::AllReduce( Int(1), g.VCComm(), SyncInfo<Device::CPU>{} );
+    if( sum != g.Size() )
+        LogicError("Reduction over a cached VC communicator gave ",sum);
+    DistMatrix<double> A(g);
+    Ones( A, 20, 10 );
+    if( FrobeniusNorm(A) != Sqrt(200.) )
+        LogicError("Norm over a grid with cached communicators was wrong");
+}
+
+void TestCache( const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing the grid communicator cache");
+    const size_t baseline = Grid::NumCachedComms();
+
+    // An identical grid reuses the communicators
+    {
+        Grid gSame( mpi::NewWorldComm(), g.Height() );
+        if( !SameComms( g, gSame ) )
+            LogicError("An identical grid did not reuse the communicators");
+        CheckNumCached( baseline, "After creating an identical grid" );
+    }
+    CheckNumCached( baseline, "After destroying an identical grid" );
+
+    // A grid of another shape has communicators of its own, which are freed
+    // with the last grid sharing them
+    {
+        auto gRow = MakeUnique<Grid>( mpi::NewWorldComm(), 1, ROW_MAJOR );
+        Grid gRowCopy( mpi::NewWorldComm(), 1, ROW_MAJOR );
+        if( !SameComms( *gRow, gRowCopy ) )
+            LogicError("Identical row grids did not share communicators");
+        if( SameComms( g, gRowCopy ) )
+            LogicError("Grids of different shapes shared communicators");
+        CheckNumCached( baseline+1, "After creating a row grid" );
+        gRow.reset();
+        CheckNumCached( baseline+1, "While a row grid remains" );
+        CheckUsable( gRowCopy );
+    }
+    CheckNumCached( baseline, "After destroying the row grids" );
+
+    // Grids over changing subsets of the processes do not accumulate
+    const int commSize = mpi::Size( mpi::COMM_WORLD );
+    mpi::Group worldGroup;
+    mpi::CommGroup( mpi::COMM_WORLD, worldGroup );
+    for( int iter=0; iter<50; ++iter )
+    {
+        const int numOwners = 1 + iter % commSize;
+        vector<int> owners( numOwners );
+        for( int q=0; q<numOwners; ++q )
+            owners[q] = (q+iter) % commSize;
+        mpi::Group ownerGroup;
+        mpi::Incl( worldGroup, numOwners, owners.data(), ownerGroup );
+        {
+            Grid gSub( mpi::NewWorldComm(), ownerGroup, 1, ROW_MAJOR );
+            if( gSub.InGrid() )
+                CheckUsable( gSub );
+            CheckNumCached( baseline+1, "With a subgrid" );
+        }
+        mpi::Free( ownerGroup );
+        CheckNumCached( baseline, "After destroying a subgrid" );
+    }
+    mpi::Free( worldGroup );
+
+    // Grids created without caching have private communicators
+    Grid::SetCommCaching( false );
+    {
+        Grid gPrivate( mpi::NewWorldComm(), g.Height() );
+        Grid::SetCommCaching( true );
+        if( SameComms( g, gPrivate ) )
+            LogicError("A grid without caching shared its communicators");
+        CheckNumCached( baseline, "After creating a grid without caching" );
+        CheckUsable( gPrivate );
+    }
+    if( !Grid::CommCaching() )
+        LogicError("Caching was not reenabled");
+}
+
+void TestNodeAware( const Grid& g, GridOrder order )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing node-aware grids in ",
+     order==COLUMN_MAJOR ? "column-major" : "row-major"," order");
+    auto gNode = Grid::NodeAware( mpi::COMM_WORLD, order );
+    if( gNode->Size() != mpi::Size(mpi::COMM_WORLD) )
+        LogicError("A node-aware grid did not contain every process");
+    if( gNode->Order() != order )
+        LogicError("A node-aware grid had the wrong order");
+
+    // Identify each node by its lowest world rank
+    const int worldRank = mpi::Rank( mpi::COMM_WORLD );
+    mpi::Comm nodeComm;
+    mpi::SplitType
+    ( mpi::COMM_WORLD, mpi::COMM_TYPE_SHARED, worldRank, nodeComm );
+    const int nodeId =
+      mpi::AllReduce( worldRank, mpi::MIN, nodeComm, SyncInfo<Device::CPU>{} );
+    const int nodeSize = mpi::Size( nodeComm );
+
+    // If the nodes are of equal size, the process columns lie within them
+    const int minNodeSize =
+      mpi::AllReduce
+      ( nodeSize, mpi::MIN, mpi::COMM_WORLD, SyncInfo<Device::CPU>{} );
+    const int maxNodeSize =
+      mpi::AllReduce
+      ( nodeSize, mpi::MAX, mpi::COMM_WORLD, SyncInfo<Device::CPU>{} );
+    if( minNodeSize == maxNodeSize )
+    {
+        if( nodeSize % gNode->Height() != 0 )
+            LogicError
+            ("The node-aware grid height, ",gNode->Height(),
+             ", does not divide the node size, ",nodeSize);
+        const int minColId =
+          mpi::AllReduce
+          ( nodeId, mpi::MIN, gNode->ColComm(), SyncInfo<Device::CPU>{} );
+        const int maxColId =
+          mpi::AllReduce
+          ( nodeId, mpi::MAX, gNode->ColComm(), SyncInfo<Device::CPU>{} );
+        if( minColId != maxColId )
+            LogicError("A node-aware process column spans several nodes");
+    }
+
+    // Redistributions over the reordered grid preserve the entries
+    const Int m = 23, n = 17;
+    DistMatrix<double> A(*gNode);
+    A.Resize( m, n );
+    IndexDependentFill( A, []( Int i, Int j ) { return double(i+m*j); } );
+    DistMatrix<double,VR,STAR> A_VR_STAR( A );
+    DistMatrix<double,MR,MC> A_MR_MC( A_VR_STAR );
+    DistMatrix<double,STAR,STAR> A_STAR_STAR( A_MR_MC );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != double(i+m*j) )
+                LogicError
+                ("Entry (",i,",",j,") over a node-aware grid was ",
+                 A_STAR_STAR.GetLocal(i,j));
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+        TestCache( g );
+        TestNodeAware( g, COLUMN_MAJOR );
+        TestNodeAware( g, ROW_MAJOR );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
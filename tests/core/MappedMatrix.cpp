@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <cstdio>
+#include <El.hpp>
+using namespace El;
+
+// The root writes BINARY and BINARY_FLAT files which every process then
+// maps, so that the processes share the mapped pages. The root also
+// modifies a writable mapping and checks that the file was updated.
+
+double TestEntry( Int i, Int j )
+{ return double(i) - 100.*double(j); }
+
+Int CountWrong( const Matrix<double>& A, Int m, Int n, double shift )
+{
+    if( A.Height() != m || A.Width() != n )
+        return m*n+1;
+    Int numWrong = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A(i,j) != TestEntry(i,j)+shift )
+                ++numWrong;
+    return numWrong;
+}
+
+void CheckCollectively( Int numWrong, const string& msg, const Grid& g )
+{
+    numWrong = mpi::AllReduce( numWrong, g.Comm(), SyncInfo<Device::CPU>{} );
+    if( numWrong != 0 )
+        LogicError(msg," had ",numWrong," wrong entries");
+}
+
+void TestMapping( Int m, Int n, const string& basename, const Grid& g )
+{
+    const string binaryName = basename + "." + FileExtension(BINARY);
+    const string flatName = basename + "." + FileExtension(BINARY_FLAT);
+    if( g.Rank() == 0 )
+    {
+        Matrix<double> A( m, n );
+        IndexDependentFill( A, []( Int i, Int j ) { return TestEntry(i,j); } );
+        Write( A, basename, BINARY );
+        Write( A, basename, BINARY_FLAT );
+    }
+    mpi::Barrier( g.Comm() );
+
+    // Read-only mappings on every process
+    {
+        auto A = MapBinary<double>( binaryName, false, MAP_ADVICE_SEQUENTIAL );
+        CheckCollectively
+        ( CountWrong( A.LockedMatrix(), m, n, 0. ), "MapBinary", g );
+        if( A.Writable() || !A.LockedMatrix().Locked() )
+            LogicError("A read-only mapping was writable");
+
+        auto B = MapBinaryFlat<double>( flatName, m, n );
+        CheckCollectively
+        ( CountWrong( B.LockedMatrix(), m, n, 0. ), "MapBinaryFlat", g );
+
+        // Moving transfers the mapping
+        MappedMatrix<double> C( std::move(B) );
+        CheckCollectively
+        ( CountWrong( C.LockedMatrix(), m, n, 0. ), "Moved mapping", g );
+        if( B.LockedMatrix().Height() != 0 )
+            LogicError("A moved-from mapping still had a view");
+
+        // The dimensions of a BINARY_FLAT file must match its size
+        bool threw = false;
+        try { MapBinaryFlat<double>( flatName, m, n+1 ); }
+        catch( std::exception& ) { threw = true; }
+        if( !threw )
+            LogicError("Mapping with the wrong dimensions did not throw");
+    }
+    mpi::Barrier( g.Comm() );
+
+    // A writable mapping on the root updates the file
+    if( g.Rank() == 0 )
+    {
+        auto A = MapBinary<double>( binaryName, true );
+        Matrix<double>& AMat = A.Matrix();
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                AMat(i,j) += 1.;
+        A.Sync();
+    }
+    mpi::Barrier( g.Comm() );
+    {
+        Matrix<double> A;
+        Read( A, binaryName, BINARY );
+        CheckCollectively
+        ( CountWrong( A, m, n, 1. ), "Writable mapping", g );
+    }
+
+    mpi::Barrier( g.Comm() );
+    if( g.Rank() == 0 )
+    {
+        std::remove( binaryName.c_str() );
+        std::remove( flatName.c_str() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",53);
+        const Int n = Input("--n","width of matrix",41);
+        const string prefix =
+          Input("--prefix","prefix of the test files",
+                string("MappedMatrixTest"));
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+#ifdef HYDROGEN_HAVE_MMAP
+        // Runs on different numbers of processes may share a directory
+        const string basename = BuildString(prefix,"_np",g.Size());
+        OutputFromRoot(g.Comm(),"Testing memory-mapped matrices");
+        TestMapping( m, n, basename, g );
+        TestMapping( 1, 0, basename, g );
+#else
+        (void) m;
+        (void) n;
+        (void) prefix;
+        OutputFromRoot(g.Comm(),"Memory mapping is not supported; skipping");
+#endif // HYDROGEN_HAVE_MMAP
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
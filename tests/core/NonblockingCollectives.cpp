@@ -0,0 +1,208 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every nonblocking collective is started before any of them is waited
+// upon, and the results are compared with closed-form expressions of the
+// ranks, which are exact for small integers in every type.
+
+template<typename T>
+void CheckEntry( const T& value, const T& expected, const string& msg, Int i )
+{
+    if( value != expected )
+        LogicError(msg,": entry ",i," was ",value," instead of ",expected);
+}
+
+template<typename T>
+void TestCollectives( const mpi::Comm& comm, Int count )
+{
+    OutputFromRoot(comm,"Testing nonblocking collectives with ",TypeName<T>());
+    const Int rank = mpi::Rank( comm );
+    const Int size = mpi::Size( comm );
+    SyncInfo<Device::CPU> syncInfo;
+
+    vector<T> reduceSend(count), reduceRecv(count), reduceInPlace(count);
+    for( Int i=0; i<count; ++i )
+    {
+        reduceSend[i] = T(rank+i);
+        reduceInPlace[i] = T(rank*i);
+    }
+    vector<T> gatherSend = { T(rank), T(10*rank) };
+    vector<T> gatherRecv(2*size);
+    vector<T> allToAllSend(2*size), allToAllRecv(2*size);
+    vector<T> scatterSend(2*size), scatterRecv(2);
+    for( Int q=0; q<size; ++q )
+        for( Int j=0; j<2; ++j )
+        {
+            allToAllSend[2*q+j] = T(100*rank+10*q+j);
+            scatterSend[2*q+j] = T(rank+q+j);
+        }
+
+    mpi::Request<T> reduceRequest, inPlaceRequest, gatherRequest,
+      allToAllRequest, scatterRequest;
+    mpi::IAllReduce
+    ( reduceSend.data(), reduceRecv.data(), count, mpi::SUM, comm,
+      reduceRequest, syncInfo );
+    mpi::IAllReduce
+    ( reduceInPlace.data(), count, mpi::SUM, comm, inPlaceRequest, syncInfo );
+    mpi::IAllGather
+    ( gatherSend.data(), 2, gatherRecv.data(), 2, comm, gatherRequest,
+      syncInfo );
+    mpi::IAllToAll
+    ( allToAllSend.data(), 2, allToAllRecv.data(), 2, comm, allToAllRequest,
+      syncInfo );
+    mpi::IReduceScatter
+    ( scatterSend.data(), scatterRecv.data(), 2, mpi::SUM, comm,
+      scatterRequest, syncInfo );
+
+    // Complete the requests out of order, polling one of them
+    while( !mpi::Test( scatterRequest ) ) { }
+    mpi::Wait( scatterRequest );
+    mpi::Wait( allToAllRequest );
+    mpi::Wait( gatherRequest );
+    mpi::Wait( inPlaceRequest );
+    mpi::Wait( reduceRequest );
+
+    const Int rankSum = size*(size-1)/2;
+    for( Int i=0; i<count; ++i )
+    {
+        CheckEntry( reduceRecv[i], T(rankSum+size*i), "IAllReduce", i );
+        CheckEntry( reduceInPlace[i], T(rankSum*i), "In-place IAllReduce", i );
+    }
+    for( Int q=0; q<size; ++q )
+    {
+        CheckEntry( gatherRecv[2*q], T(q), "IAllGather", 2*q );
+        CheckEntry( gatherRecv[2*q+1], T(10*q), "IAllGather", 2*q+1 );
+        for( Int j=0; j<2; ++j )
+            CheckEntry
+            ( allToAllRecv[2*q+j], T(100*q+10*rank+j), "IAllToAll", 2*q+j );
+    }
+    for( Int j=0; j<2; ++j )
+        CheckEntry
+        ( scatterRecv[j], T(rankSum+size*(rank+j)), "IReduceScatter", j );
+}
+
+// ValueInt is not packed, so its buffers are serialized and the result is
+// only unpacked by Wait
+void TestSerializedAllReduce( const mpi::Comm& comm )
+{
+    OutputFromRoot(comm,"Testing a nonblocking reduction of ValueInt");
+    const Int rank = mpi::Rank( comm );
+    const Int size = mpi::Size( comm );
+    vector<ValueInt<double>> send(2), recv(2);
+    send[0].value = double((rank+1)%size);
+    send[0].index = rank;
+    send[1].value = -double(rank);
+    send[1].index = 2*rank;
+
+    mpi::Request<ValueInt<double>> request;
+    mpi::IAllReduce
+    ( send.data(), recv.data(), 2, mpi::MaxLocOp<double>(), comm, request,
+      SyncInfo<Device::CPU>{} );
+    mpi::Wait( request );
+    if( recv[0].value != double(size-1) || recv[0].index != size-2+(size==1) )
+        LogicError
+        ("Serialized IAllReduce gave (",recv[0].value,",",recv[0].index,")");
+    if( recv[1].value != 0. || recv[1].index != 0 )
+        LogicError
+        ("Serialized IAllReduce gave (",recv[1].value,",",recv[1].index,")");
+}
+
+template<typename T>
+void CheckSummed
+( const Matrix<T>& A, Int size, Int rankSum, const string& msg )
+{
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A(i,j) != T(size*(i+j)+rankSum) )
+                LogicError
+                (msg,": entry (",i,",",j,") was ",A(i,j)," instead of ",
+                 T(size*(i+j)+rankSum));
+}
+
+template<typename T>
+void TestAllReduceAsync( const Grid& g, Int m, Int n )
+{
+    OutputFromRoot(g.Comm(),"Testing AllReduceAsync with ",TypeName<T>());
+    const Int rank = g.Rank();
+    const Int size = g.Size();
+    const Int rankSum = size*(size-1)/2;
+    auto fill = [=]( Int i, Int j ) { return T(i+j+rank); };
+
+    // A contiguous matrix is reduced in place
+    Matrix<T> A( m, n );
+    IndexDependentFill( A, fill );
+    auto requestA = AllReduceAsync( A, g.Comm() );
+
+    // A view is reduced through a packed copy, and the rows outside of it
+    // must not change
+    Matrix<T> BData( m+2, n ), B;
+    Fill( BData, T(-1) );
+    View( B, BData, IR(1,m+1), ALL );
+    IndexDependentFill( B, fill );
+    auto requestB = AllReduceAsync( B, g.Comm() );
+
+    // A distributed matrix is reduced over the given communicator
+    DistMatrix<T,STAR,STAR> C( m, n, g );
+    IndexDependentFill( C.Matrix(), fill );
+    auto requestC = AllReduceAsync( C, g.Comm() );
+
+    // A moved request is completed by its new owner's destructor
+    {
+        auto movedB = std::move(requestB);
+        if( requestB.Active() )
+            LogicError("A moved-from AllReduceRequest was still active");
+    }
+    CheckSummed( B, size, rankSum, "AllReduceAsync of a view" );
+    for( Int j=0; j<n; ++j )
+        if( BData(0,j) != T(-1) || BData(m+1,j) != T(-1) )
+            LogicError("AllReduceAsync of a view wrote outside of the view");
+
+    while( !requestA.Test() ) { }
+    if( requestA.Active() )
+        LogicError("A completed AllReduceRequest was still active");
+    CheckSummed( A, size, rankSum, "AllReduceAsync of a matrix" );
+
+    requestC.Wait();
+    CheckSummed
+    ( C.LockedMatrix(), size, rankSum, "AllReduceAsync of a DistMatrix" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int count = Input("--count","number of reduced entries",1000);
+        const Int m = Input("--m","height of the reduced matrices",37);
+        const Int n = Input("--n","width of the reduced matrices",11);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+        TestCollectives<Int>( g.Comm(), count );
+        TestCollectives<float>( g.Comm(), count );
+        TestCollectives<double>( g.Comm(), count );
+        TestCollectives<Complex<double>>( g.Comm(), count );
+        TestSerializedAllReduce( g.Comm() );
+        TestAllReduceAsync<double>( g, m, n );
+        TestAllReduceAsync<Complex<float>>( g, m, n );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <El/core/Profiling.hpp>
+#include <atomic>
+#include <iomanip>
+#include <thread>
+using namespace El;
+
+// Each rank enters the regions a rank-dependent number of times, so the
+// reduced call counts and bytes have closed forms. Times are only checked
+// through the structure of the reports.
+
+void Begin( const char* name ) { BeginRegionProfile( name, Color::NIAGARA ); }
+void End( const char* name ) { EndRegionProfile( name ); }
+
+void RecordRegions( int rank, int size )
+{
+    Begin("TestOuter");
+    for( int k=0; k<=rank; ++k )
+    {
+        Begin("TestInner");
+        End("TestInner");
+    }
+    AddProfileBytes( 100*(rank+1) );
+    End("TestOuter");
+
+    if( rank == size-1 )
+    {
+        Begin("TestLast");
+        End("TestLast");
+    }
+
+    // A region begun while the profiler is disabled must not end the
+    // enclosing recorded region
+    Begin("TestEnclosing");
+    DisableNativeProfiling();
+    Begin("TestHidden");
+    EnableNativeProfiling( true );
+    End("TestHidden");
+    Begin("TestChild");
+    End("TestChild");
+    End("TestEnclosing");
+
+    // A region begun while enabled is ended after the profiler is disabled
+    Begin("TestDisabledEnd");
+    DisableNativeProfiling();
+    End("TestDisabledEnd");
+    EnableNativeProfiling( true );
+    Begin("TestAfter");
+    End("TestAfter");
+
+    std::thread worker( [] { Begin("TestWorker"); End("TestWorker"); } );
+    worker.join();
+}
+
+// The reduced statistics of a region as WriteJSON formats them
+string Stats( double minimum, double average, double maximum )
+{
+    std::ostringstream os;
+    os << std::setprecision(9) << "{\"min\": " << minimum
+       << ", \"avg\": " << average << ", \"max\": " << maximum;
+    return os.str();
+}
+
+string RegionLine( const string& json, const string& path )
+{
+    const string key = "{\"path\": \"" + path + "\", ";
+    const auto begin = json.find( key );
+    if( begin == string::npos )
+        return "";
+    return json.substr( begin, json.find( '\n', begin ) - begin );
+}
+
+void CheckRegion
+( const string& json, const string& path,
+  const string& calls, const string& bytes )
+{
+    const string line = RegionLine( json, path );
+    if( line.empty() )
+        LogicError("The JSON profile has no region ",path);
+    if( line.find( "\"calls\": " + calls ) == string::npos )
+        LogicError("Wrong calls for ",path," (expected ",calls,"): ",line);
+    if( line.find( "\"bytes\": " + bytes ) == string::npos )
+        LogicError("Wrong bytes for ",path," (expected ",bytes,"): ",line);
+}
+
+void CheckReports( int rank, int size )
+{
+    std::ostringstream json, text;
+    ReportProfile( json, ProfileFormat::JSON );
+    ReportProfile( text, ProfileFormat::TEXT );
+    if( rank == 0 )
+    {
+        const string doc = json.str();
+        if( doc.find( BuildString("{\"ranks\": ",size,", ") ) != 0 )
+            LogicError("The JSON profile has the wrong header");
+        const string none = Stats( 0, 0, 0 );
+        CheckRegion
+        ( doc, "TestOuter", Stats(1,1,1),
+          Stats(100,50*(size+1),100*size) );
+        CheckRegion
+        ( doc, "TestOuter/TestInner",
+          Stats(1,(size+1)/2.,size), none );
+        CheckRegion
+        ( doc, "TestLast", Stats(size==1 ? 1 : 0,1./size,1), none );
+        CheckRegion
+        ( doc, "TestEnclosing/TestChild", Stats(1,1,1), none );
+        CheckRegion( doc, "TestAfter", Stats(1,1,1), none );
+        CheckRegion( doc, "TestWorker", Stats(1,1,1), none );
+        if( !RegionLine( doc, "TestChild" ).empty() )
+            LogicError("A disabled region ended its enclosing region");
+        if( doc.find( "TestHidden" ) != string::npos )
+            LogicError("A region begun while disabled was recorded");
+        if( !RegionLine( doc, "TestDisabledEnd/TestAfter" ).empty() )
+            LogicError("A region was not ended after disabling the profiler");
+
+        const string table = text.str();
+        if( table.find( BuildString("Profile over ",size," ranks") ) != 0 )
+            LogicError("The text profile has the wrong header");
+        if( table.find( "\n  TestInner " ) == string::npos )
+            LogicError("The text profile does not indent nested regions");
+    }
+    else if( !json.str().empty() || !text.str().empty() )
+        LogicError("A rank other than the root wrote a reduced profile");
+
+    // The trace holds the events of this rank only, one track per thread
+    std::ostringstream chrome;
+    ReportProfile( chrome, ProfileFormat::CHROME_TRACE );
+    const string trace = chrome.str();
+    if( trace.find( "{\"traceEvents\": [" ) != 0 )
+        LogicError("The Chrome trace has the wrong header");
+    auto eventPrefix = [&]( const string& name )
+    {
+        return BuildString
+          ("{\"name\": \"",name,"\", \"ph\": \"X\", \"pid\": ",rank,
+           ", \"tid\": ");
+    };
+    Int numInner = 0;
+    const string innerPrefix = eventPrefix("TestInner");
+    for( auto pos = trace.find( innerPrefix ); pos != string::npos;
+         pos = trace.find( innerPrefix, pos+1 ) )
+        ++numInner;
+    if( numInner != rank+1 )
+        LogicError("The Chrome trace has ",numInner," inner events");
+    auto tidOf = [&]( const string& name )
+    {
+        const string prefix = eventPrefix( name );
+        const auto pos = trace.find( prefix );
+        if( pos == string::npos )
+            LogicError("The Chrome trace has no event ",name);
+        return std::stoi( trace.substr( pos+prefix.size() ) );
+    };
+    if( tidOf("TestWorker") == tidOf("TestOuter") )
+        LogicError("The Chrome trace put two threads on one track");
+}
+
+// A region which another thread has open during a reset is dropped, and
+// that thread records the regions it begins afterwards
+void CheckResetWithOpenRegion( int rank )
+{
+    std::atomic<int> stage(0);
+    std::thread worker( [&stage]
+    {
+        Begin("TestOpenDuringReset");
+        stage = 1;
+        while( stage != 2 )
+            std::this_thread::yield();
+        End("TestOpenDuringReset");
+        Begin("TestAfterReset");
+        End("TestAfterReset");
+    } );
+    while( stage != 1 )
+        std::this_thread::yield();
+    ResetProfile();
+    stage = 2;
+    worker.join();
+
+    std::ostringstream json;
+    ReportProfile( json, ProfileFormat::JSON );
+    if( rank == 0 )
+    {
+        const string doc = json.str();
+        if( doc.find( "TestOpenDuringReset" ) != string::npos )
+            LogicError("A region open during a reset was recorded");
+        if( RegionLine( doc, "TestAfterReset" ).empty() )
+            LogicError("A region begun after a reset was not recorded");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        const int rank = mpi::Rank( comm );
+        const int size = mpi::Size( comm );
+        OutputFromRoot(comm,"Testing the native profiler");
+        EnableNativeProfiling( true );
+        ResetProfile();
+        RecordRegions( rank, size );
+        CheckReports( rank, size );
+
+        // Resetting discards every region
+        ResetProfile();
+        std::ostringstream json;
+        ReportProfile( json, ProfileFormat::JSON );
+        if( rank == 0 && json.str().find( "Test" ) != string::npos )
+            LogicError("ResetProfile kept the recorded regions");
+        CheckResetWithOpenRegion( rank );
+        DisableNativeProfiling();
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
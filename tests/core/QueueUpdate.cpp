@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every process queues an update of every entry, plus a rank-dependent
+// update of a few entries, so each entry must end up with a known sum. The
+// distributions with a root are tested with the last possible root, where
+// the owners are not the processes of the first redundant copy.
+
+Int ExtraUpdates( Int i, Int j, Int rank )
+{ return ( (i+2*j) % 5 == 0 ? rank+1 : 0 ); }
+
+template<typename T,Dist U,Dist V>
+void TestQueueUpdate
+( const Grid& g, Int m, Int n, int root, bool includeViewers )
+{
+    const string desc =
+      BuildString
+      ("[",DistToString(U),",",DistToString(V),"] with root ",root,
+       includeViewers ? " over the viewing processes" : "");
+    OutputFromRoot(g.Comm(),"Testing ",desc);
+    const Int rank = g.Rank();
+    const Int size = g.Size();
+
+    DistMatrix<T,U,V> A(g,root);
+    Zeros( A, m, n );
+    A.Reserve( m*n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            A.QueueUpdate( i, j, T(1) );
+            const Int extra = ExtraUpdates( i, j, rank );
+            if( extra != 0 )
+                A.QueueUpdate( Entry<T>{ i, j, T(extra) } );
+        }
+    A.ProcessQueues( includeViewers );
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Int numWrong = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            Int expected = size;
+            for( Int q=0; q<size; ++q )
+                expected += ExtraUpdates( i, j, q );
+            if( A_STAR_STAR.GetLocal(i,j) != T(expected) )
+                ++numWrong;
+        }
+    numWrong = mpi::AllReduce( numWrong, g.Comm(), SyncInfo<Device::CPU>{} );
+    if( numWrong != 0 )
+        LogicError("QueueUpdate over ",desc," had ",numWrong," wrong entries");
+}
+
+template<typename T>
+void TestDistributions( const Grid& g, Int m, Int n )
+{
+    for( const bool includeViewers : { false, true } )
+    {
+        TestQueueUpdate<T,MC,MR>( g, m, n, 0, includeViewers );
+        TestQueueUpdate<T,STAR,STAR>( g, m, n, 0, includeViewers );
+        TestQueueUpdate<T,VC,STAR>( g, m, n, 0, includeViewers );
+        TestQueueUpdate<T,CIRC,CIRC>( g, m, n, 0, includeViewers );
+        TestQueueUpdate<T,CIRC,CIRC>( g, m, n, g.Size()-1, includeViewers );
+        TestQueueUpdate<T,MD,STAR>( g, m, n, 0, includeViewers );
+        TestQueueUpdate<T,MD,STAR>( g, m, n, g.GCD()-1, includeViewers );
+        TestQueueUpdate<T,STAR,MD>( g, m, n, g.GCD()-1, includeViewers );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--m","height of A",21);
+        const Int n = Input("--n","width of A",13);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+        TestDistributions<double>( g, m, n );
+        TestDistributions<Complex<float>>( g, m, n );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Random matrices are generated from their global indices, so after
+// reseeding with SetRandomSeed the same sequence of matrices must be
+// generated no matter which grids and distributions they use.
+
+template<typename T>
+Matrix<T> Gathered( const AbstractDistMatrix<T>& A )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    return A_STAR_STAR.Matrix();
+}
+
+template<typename T>
+Int CountDifferences( const Matrix<T>& A, const Matrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        return Max(A.Height()*A.Width(),B.Height()*B.Width()) + 1;
+    Int numDiffs = 0;
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A(i,j) != B(i,j) )
+                ++numDiffs;
+    return numDiffs;
+}
+
+// Generate a uniform and a Gaussian matrix of the given distribution
+template<typename T,Dist U,Dist V>
+void Generate
+( Int m, Int n, const Grid& g, Matrix<T>& uniform, Matrix<T>& gaussian )
+{
+    DistMatrix<T,U,V> A(g), B(g);
+    Uniform( A, m, n );
+    Gaussian( B, m, n );
+    uniform = Gathered( A );
+    gaussian = Gathered( B );
+}
+
+template<typename T>
+void TestReproducibility( Int m, Int n, const Grid& g, const Grid& gFlat )
+{
+    const std::uint64_t seed = 17;
+    Matrix<T> uniform, gaussian, uniformOther, gaussianOther;
+
+    SetRandomSeed( seed );
+    Generate<T,MC,MR>( m, n, g, uniform, gaussian );
+    if( CountDifferences( uniform, gaussian ) == 0 )
+        LogicError("Consecutive random matrices were identical");
+
+    SetRandomSeed( seed );
+    Generate<T,VC,STAR>( m, n, gFlat, uniformOther, gaussianOther );
+    Int numDiffs = CountDifferences( uniform, uniformOther ) +
+                   CountDifferences( gaussian, gaussianOther );
+    if( numDiffs != 0 )
+        LogicError
+        (numDiffs," entries differed between grids of height ",g.Height(),
+         " and ",gFlat.Height());
+
+    // Filling a matrix on another grid before reseeding does not matter
+    Matrix<T> unused;
+    Generate<T,MR,MC>( m, n, g, unused, unused );
+    SetRandomSeed( seed );
+    Generate<T,STAR,VR>( m, n, g, uniformOther, gaussianOther );
+    numDiffs = CountDifferences( uniform, uniformOther ) +
+               CountDifferences( gaussian, gaussianOther );
+    if( numDiffs != 0 )
+        LogicError
+        (numDiffs," entries differed between [MC,MR] and [STAR,VR]");
+
+    // A different seed gives a different matrix
+    SetRandomSeed( seed+1 );
+    Generate<T,MC,MR>( m, n, g, uniformOther, gaussianOther );
+    if( CountDifferences( uniform, uniformOther ) == 0 )
+        LogicError("Different seeds generated the same matrix");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::NewWorldComm();
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",47);
+        const Int n = Input("--n","width of matrix",31);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( std::move(comm) );
+        const Grid gFlat( mpi::NewWorldComm(), 1 );
+        OutputFromRoot(g.Comm(),"Testing reproducibility across grids");
+        TestReproducibility<float>( m, n, g, gFlat );
+        TestReproducibility<double>( m, n, g, gFlat );
+        TestReproducibility<Complex<double>>( m, n, g, gFlat );
+    }
+    catch( std::exception& e )
+    {
+        ReportException(e);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,161 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <hydrogen/device/CPUStreams.hpp>
+
+// Other includes
+#include <El.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+void Pause()
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+}
+}// namespace <anon>
+
+TEST_CASE("Testing CPU streams","[seq][stream]")
+{
+    auto stream = hydrogen::CreateCPUStream();
+    auto event = hydrogen::CreateCPUEvent();
+
+    GIVEN("Tasks enqueued on one stream")
+    {
+        std::vector<int> order;
+        for (int i = 0; i < 100; ++i)
+            hydrogen::CPUStreamEnqueue(
+                stream,
+                [&order, i]
+                {
+                    if (i == 0)
+                        Pause();
+                    order.push_back(i);
+                });
+        hydrogen::CPUStreamSynchronize(stream);
+
+        THEN ("They run in submission order.")
+        {
+            REQUIRE(order.size() == 100);
+            for (int i = 0; i < 100; ++i)
+                CHECK(order[i] == i);
+        }
+    }
+
+    GIVEN("A stream waiting on an event of another stream")
+    {
+        auto other = hydrogen::CreateCPUStream();
+        std::atomic<bool> produced{false};
+        bool sawProduced = false;
+        hydrogen::CPUStreamEnqueue(
+            other, [&produced] { Pause(); produced = true; });
+        hydrogen::CPUEventRecord(event, other);
+        hydrogen::CPUStreamWaitEvent(stream, event);
+        hydrogen::CPUStreamEnqueue(
+            stream, [&] { sawProduced = produced; });
+        hydrogen::CPUStreamSynchronize(stream);
+
+        THEN ("Its later tasks run after the event is reached.")
+        {
+            CHECK(sawProduced);
+            hydrogen::CPUEventSynchronize(event);
+            CHECK(produced);
+        }
+        hydrogen::DestroyCPUStream(other);
+    }
+
+    GIVEN("A task which throws")
+    {
+        bool ranAfter = false;
+        hydrogen::CPUStreamEnqueue(
+            stream, [] { throw std::runtime_error("task failed"); });
+        hydrogen::CPUStreamEnqueue(stream, [&ranAfter] { ranAfter = true; });
+
+        THEN ("The next synchronization rethrows it once.")
+        {
+            CHECK_THROWS_AS(
+                hydrogen::CPUStreamSynchronize(stream), std::runtime_error);
+            CHECK(ranAfter);
+            CHECK_NOTHROW(hydrogen::CPUStreamSynchronize(stream));
+        }
+
+        THEN ("A non-throwing wait leaves it pending.")
+        {
+            hydrogen::CPUStreamWait(stream);
+            CHECK(ranAfter);
+            CHECK_THROWS_AS(
+                hydrogen::CPUStreamSynchronize(stream), std::runtime_error);
+        }
+    }
+
+    GIVEN("A matrix on a stream whose task throws")
+    {
+        {
+            El::Matrix<double> A(10, 10);
+            A.SetStream(stream);
+            A.SetEvent(event);
+            hydrogen::CPUStreamEnqueue(
+                stream, [] { throw std::runtime_error("task failed"); });
+            // The destructor frees the buffer and must not throw
+        }
+
+        THEN ("The error is reported by the next synchronization.")
+        {
+            CHECK_THROWS_AS(
+                hydrogen::CPUStreamSynchronize(stream), std::runtime_error);
+        }
+    }
+
+    GIVEN("A matrix on a stream")
+    {
+        El::Matrix<double> B(8, 6);
+        El::Fill(B, 1.);
+        B.SetStream(stream);
+        B.SetEvent(event);
+
+        THEN ("Its views use the same stream and event.")
+        {
+            El::Matrix<double> A;
+            El::View(A, B);
+            CHECK(A.Stream() == stream);
+            CHECK(A.Event() == event);
+
+            El::Matrix<double> C;
+            El::LockedView(C, B, El::IR(1,4), El::ALL);
+            CHECK(C.Stream() == stream);
+            CHECK(C.Event() == event);
+
+            auto D = B(El::IR(2,5), El::IR(1,3));
+            CHECK(D.Stream() == stream);
+            CHECK(D.Event() == event);
+
+            auto E = std::move(D);
+            CHECK(E.Stream() == stream);
+            CHECK(E.Event() == event);
+        }
+
+        THEN ("Kernels on a view are ordered with those on the matrix.")
+        {
+            auto top = B(El::IR(0,4), El::ALL);
+            El::Matrix<double> X(4, 6);
+            El::Fill(X, 2.);
+            El::Axpy(1., X, top);
+            El::Matrix<double> Y;
+            Y.SetStream(stream);
+            El::Copy(B, Y);
+            El::Synchronize(El::SyncInfoFromMatrix(B));
+            for (El::Int j = 0; j < 6; ++j)
+                for (El::Int i = 0; i < 8; ++i)
+                    CHECK(Y(i,j) == (i < 4 ? 3. : 1.));
+        }
+    }
+
+    hydrogen::DestroyCPUEvent(event);
+    hydrogen::DestroyCPUStream(stream);
+}
@@ -0,0 +1,246 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <El/core/MemoryPool.hpp>
+
+// Other includes
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Testing the host memory pool","[seq][memorypool]")
+{
+    using pool_type = El::MemoryPool<false>;
+
+    GIVEN("A memory pool")
+    {
+        pool_type pool;
+
+        THEN ("Allocations honor the requested alignment.")
+        {
+            pool_type aligned_pool(1.6, 1, 1<<26, 16, 256);
+            CHECK(aligned_pool.Alignment() == 256);
+            for (size_t size : {1, 7, 100, 4096, 1<<27})
+            {
+                void* ptr = aligned_pool.Allocate(size);
+                CHECK(reinterpret_cast<std::uintptr_t>(ptr) % 256 == 0);
+                aligned_pool.Free(ptr);
+            }
+            CHECK(pool.Alignment() == 64);
+        }
+
+        THEN ("A non-power-of-two alignment is rejected.")
+        {
+            CHECK_THROWS(pool_type(1.6, 1, 1<<26, 16, 48));
+        }
+
+        WHEN ("An unknown pointer is freed")
+        {
+            // Free reads the header before the pointer, so keep it in bounds
+            alignas(64) char buffer[256] = {};
+            THEN ("The pool throws.")
+            {
+                CHECK_THROWS(pool.Free(buffer + 128));
+                CHECK_THROWS(pool.Free(nullptr));
+            }
+        }
+
+        WHEN ("A pointer of another pool is freed")
+        {
+            pool_type other;
+            void* ptr = other.Allocate(32);
+            THEN ("The pool throws.")
+            {
+                CHECK_THROWS(pool.Free(ptr));
+                other.Free(ptr);
+            }
+        }
+
+        WHEN ("A pointer is freed twice")
+        {
+            void* ptr = pool.Allocate(32);
+            pool.Free(ptr);
+            THEN ("The second free throws.")
+            {
+                CHECK_THROWS(pool.Free(ptr));
+            }
+        }
+
+        WHEN ("A block is freed and reallocated")
+        {
+            void* ptr = pool.Allocate(100);
+            pool.Free(ptr);
+            void* again = pool.Allocate(100);
+            THEN ("The cached block is reused.")
+            {
+                CHECK(again == ptr);
+                auto const stats = pool.Statistics();
+                CHECK(stats.bytes_requested == 100);
+                pool.Free(again);
+            }
+        }
+
+        WHEN ("Blocks are freed by another thread")
+        {
+            std::vector<void*> ptrs;
+            for (int i = 0; i < 64; ++i)
+                ptrs.push_back(pool.Allocate(1000));
+            std::thread([&]() { for (void* ptr : ptrs) pool.Free(ptr); })
+                .join();
+
+            THEN ("The exited thread's cache is discarded, but its blocks "
+                  "and counters are kept.")
+            {
+                CHECK(pool.NumThreadCaches() == 1);
+                auto stats = pool.Statistics();
+                CHECK(stats.bytes_in_use == 0);
+                CHECK(stats.bytes_cached > 0);
+                size_t misses = 0;
+                for (const auto& bin : stats.bins)
+                    misses += bin.misses;
+                CHECK(misses == 64);
+
+                void* ptr = pool.Allocate(1000);
+                CHECK(pool.Statistics().bytes_cached < stats.bytes_cached);
+                pool.Free(ptr);
+            }
+        }
+
+        WHEN ("Many short-lived threads use the pool")
+        {
+            for (int i = 0; i < 32; ++i)
+                std::thread([&]() { pool.Free(pool.Allocate(64)); }).join();
+            THEN ("The number of thread caches stays bounded.")
+            {
+                CHECK(pool.NumThreadCaches() == 0);
+            }
+        }
+
+        WHEN ("Another live thread holds cached blocks")
+        {
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool freed = false, done = false;
+            std::thread worker([&]() {
+                pool.Free(pool.Allocate(512));
+                std::unique_lock<std::mutex> lock(mutex);
+                freed = true;
+                cv.notify_all();
+                cv.wait(lock, [&]() { return done; });
+            });
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() { return freed; });
+            }
+            CHECK(pool.Statistics().bytes_cached > 0);
+            pool.FreeAllUnused();
+
+            THEN ("FreeAllUnused releases it.")
+            {
+                CHECK(pool.Statistics().bytes_cached == 0);
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done = true;
+            }
+            cv.notify_all();
+            worker.join();
+        }
+    }
+}
+
+TEST_CASE("Testing the memory pool cache cap","[seq][memorypool]")
+{
+    using pool_type = El::MemoryPool<false>;
+    constexpr size_t block_size = 4096;
+    constexpr size_t max_cached = 16*block_size;
+
+    GIVEN("A memory pool whose cached blocks are capped")
+    {
+        pool_type pool;
+        pool.SetMaxCachedBytes(max_cached);
+
+        WHEN ("The cap is exceeded")
+        {
+            std::vector<void*> ptrs;
+            for (int i = 0; i < 17; ++i)
+                ptrs.push_back(pool.Allocate(block_size));
+            for (void* ptr : ptrs)
+                pool.Free(ptr);
+
+            THEN ("Trimming leaves headroom below the cap.")
+            {
+                auto const stats = pool.Statistics();
+                CHECK(stats.bytes_cached <= max_cached - max_cached/4);
+                CHECK(stats.bytes_trimmed >= max_cached/4);
+            }
+        }
+
+        WHEN ("Another live thread holds most of the cached blocks")
+        {
+            std::vector<void*> ptrs;
+            for (int i = 0; i < 17; ++i)
+                ptrs.push_back(pool.Allocate(block_size));
+
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool freed = false, done = false;
+            std::thread worker([&]() {
+                for (int i = 0; i < 15; ++i)
+                    pool.Free(ptrs[i]);
+                std::unique_lock<std::mutex> lock(mutex);
+                freed = true;
+                cv.notify_all();
+                cv.wait(lock, [&]() { return done; });
+            });
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() { return freed; });
+            }
+            CHECK(pool.Statistics().bytes_trimmed == 0);
+            pool.Free(ptrs[15]);
+            pool.Free(ptrs[16]);
+
+            THEN ("Exceeding the cap releases the other thread's blocks.")
+            {
+                CHECK(pool.Statistics().bytes_cached
+                      <= max_cached - max_cached/4);
+            }
+            AND_WHEN ("The cap is lowered")
+            {
+                pool.SetMaxCachedBytes(0);
+                THEN ("Every cached block is released.")
+                {
+                    CHECK(pool.Statistics().bytes_cached == 0);
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done = true;
+            }
+            cv.notify_all();
+            worker.join();
+        }
+    }
+}
+
+TEST_CASE("Testing byte count parsing","[seq][memorypool]")
+{
+    size_t bytes = 7;
+    CHECK(El::details::ParseByteCount("1048576", bytes));
+    CHECK(bytes == 1048576);
+    CHECK(El::details::ParseByteCount("0", bytes));
+    CHECK(bytes == 0);
+
+    bytes = 7;
+    for (char const* bad : {"", "abc", "12abc", "-1", " 12", "1e6",
+                            "99999999999999999999999"})
+    {
+        CHECK_FALSE(El::details::ParseByteCount(bad, bytes));
+        CHECK(bytes == 7);
+    }
+    CHECK_FALSE(El::details::ParseByteCount(nullptr, bytes));
+}
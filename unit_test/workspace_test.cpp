@@ -0,0 +1,166 @@
+// MUST include this
+#include <catch2/catch.hpp>
+
+// File being tested
+#include <El/core/Workspace.hpp>
+
+// Other includes
+#include <El.hpp>
+#include <hydrogen/utils/SimpleBuffer.hpp>
+
+#include <memory>
+
+TEST_CASE("Testing the workspace arena","[seq][workspace]")
+{
+    using buffer_type = hydrogen::simple_buffer<double, El::Device::CPU>;
+
+    GIVEN("No open workspace scope")
+    {
+        THEN ("The arena is inactive.")
+        {
+            CHECK_FALSE(El::workspace::Active());
+        }
+    }
+
+    GIVEN("An open workspace scope")
+    {
+        El::WorkspaceScope scope;
+        CHECK(El::workspace::Active());
+
+        WHEN ("Blocks are released in LIFO order")
+        {
+            void* first = El::workspace::Allocate(100);
+            void* second = El::workspace::Allocate(200);
+            El::workspace::Release(second, 200);
+            El::workspace::Release(first, 100);
+
+            THEN ("The memory is reused.")
+            {
+                void* again = El::workspace::Allocate(100);
+                CHECK(again == first);
+                El::workspace::Release(again, 100);
+                CHECK(El::workspace::NumOutstanding() == 0);
+            }
+        }
+
+        WHEN ("Simple buffers are created")
+        {
+            const double* firstData;
+            {
+                buffer_type first(10), second(20);
+                firstData = first.data();
+                CHECK(second.data() != first.data());
+            }
+            THEN ("They are carved from the arena and released on "
+                  "destruction.")
+            {
+                buffer_type buffer(10);
+                CHECK(buffer.data() == firstData);
+            }
+        }
+
+        WHEN ("A scope closes")
+        {
+            void* outer = El::workspace::Allocate(64);
+            void* inner;
+            {
+                El::WorkspaceScope innerScope;
+                inner = El::workspace::Allocate(1000);
+                (void) inner;
+            }
+            THEN ("Everything allocated within it is reclaimed.")
+            {
+                void* next = El::workspace::Allocate(1000);
+                CHECK(next == inner);
+                El::workspace::Release(next, 1000);
+                El::workspace::Release(outer, 64);
+            }
+        }
+
+        WHEN ("The arena needs more than one chunk")
+        {
+            const size_t chunk = El::workspace::Capacity();
+            void* small = El::workspace::Allocate(64);
+            void* large = El::workspace::Allocate(2*chunk);
+            THEN ("The allocations remain valid.")
+            {
+                CHECK(El::workspace::Capacity() > chunk);
+                static_cast<char*>(large)[2*chunk-1] = 1;
+                El::workspace::Release(large, 2*chunk);
+                El::workspace::Release(small, 64);
+            }
+        }
+
+#ifndef EL_RELEASE
+        WHEN ("Blocks are released out of order")
+        {
+            void* first = El::workspace::Allocate(100);
+            void* second = El::workspace::Allocate(200);
+            THEN ("Debug builds throw.")
+            {
+                CHECK_THROWS_AS(
+                    El::workspace::Release(first, 100), std::logic_error);
+                El::workspace::Release(second, 200);
+                El::workspace::Release(first, 100);
+            }
+        }
+
+        WHEN ("A block outlives its scope")
+        {
+            void* stale;
+            {
+                El::WorkspaceScope innerScope;
+                stale = El::workspace::Allocate(100);
+            }
+            void* next = El::workspace::Allocate(100);
+            THEN ("Debug builds keep its memory and throw on its release.")
+            {
+                CHECK(next != stale);
+                CHECK(El::workspace::NumOutstanding() == 1);
+                CHECK_THROWS_AS(
+                    El::workspace::Release(stale, 100), std::logic_error);
+                El::workspace::Release(next, 100);
+            }
+        }
+
+        WHEN ("Simple buffers are released out of order")
+        {
+            std::unique_ptr<buffer_type> first(new buffer_type(10));
+            double* firstData = first->data();
+            {
+                buffer_type second(20);
+                THEN ("Debug builds throw when one is reallocated.")
+                {
+                    CHECK_THROWS_AS(first->allocate(1000), std::logic_error);
+                    CHECK(first->data() == nullptr);
+                }
+                THEN ("Destroying one reports the error without throwing.")
+                {
+                    CHECK_NOTHROW(first.reset());
+                }
+                CHECK(El::workspace::NumOutstanding() == 2);
+            }
+            // Release the block which the first buffer could not
+            El::workspace::Release(firstData, 10*sizeof(double));
+            CHECK(El::workspace::NumOutstanding() == 0);
+        }
+
+        WHEN ("A block of unknown size is released")
+        {
+            void* ptr = El::workspace::Allocate(100);
+            THEN ("Debug builds throw.")
+            {
+                CHECK_THROWS_AS(
+                    El::workspace::Release(ptr, 1000), std::logic_error);
+                El::workspace::Release(ptr, 100);
+            }
+        }
+#endif // EL_RELEASE
+    }
+
+    THEN ("Closing every scope leaves nothing outstanding.")
+    {
+        CHECK(El::workspace::NumOutstanding() == 0);
+        CHECK_FALSE(El::workspace::Active());
+    }
+}